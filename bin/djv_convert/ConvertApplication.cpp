@@ -30,9 +30,13 @@
 #include <djv_convert/ConvertApplication.h>
 
 #include <djv_convert/ConvertContext.h>
+#include <djv_convert/ConvertPipeline.h>
 
+#include <djvAV/CPUImage.h>
 #include <djvAV/IO.h>
+#include <djvAV/PixelDataUtil.h>
 
+#include <djvCore/BoxUtil.h>
 #include <djvCore/Sequence.h>
 #include <djvCore/Time.h>
 #include <djvCore/Timer.h>
@@ -41,6 +45,9 @@
 #include <QDir>
 #include <QTimer>
 
+#include <algorithm>
+#include <thread>
+
 namespace djv
 {
     namespace convert
@@ -304,38 +311,165 @@ namespace djv
                     return;
                 }
             }
+
+            // Open the loaders and savers used by the pipeline threads. Movies
+            // are read by a single thread since they are decoded sequentially,
+            // and frames are only written out of order when the output is a
+            // sequence of files.
             const qint64 length = static_cast<qint64>(saveInfo.sequence.frames.count());
-            float    progressAccum = 0.f;
-            Core::Timer progressTimer;
-            progressTimer.start();
-            for (qint64 i = 0; i < length; ++i)
+            const int threads =
+                options.threads > 0 ?
+                options.threads :
+                std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+            const int queueDepth = options.queueDepth > 0 ? options.queueDepth : (threads * 2);
+            const bool inputSequence =
+                input.file.isSequenceValid() &&
+                Core::FileInfo::sequenceExtensions.contains(input.file.extension());
+            const bool outputSequence =
+                output.file.isSequenceValid() &&
+                Core::FileInfo::sequenceExtensions.contains(output.file.extension());
+            std::vector<std::unique_ptr<AV::Save> > saves;
+            saves.push_back(std::move(save));
+            auto closeSaves = [&saves]
+            {
+                for (auto & i : saves)
+                {
+                    try
+                    {
+                        i->close();
+                    }
+                    catch (const Core::Error &)
+                    {}
+                }
+            };
+            std::vector<std::unique_ptr<AV::Load> > loads;
+            loads.push_back(std::move(load));
+            try
+            {
+                const qint64 readers = inputSequence ? std::min(static_cast<qint64>(threads), length) : 1;
+                for (qint64 i = 1; i < readers; ++i)
+                {
+                    auto clone = loads[0]->clone();
+                    if (!clone)
+                    {
+                        AV::IOInfo info;
+                        clone = _context->ioFactory()->load(input.file, info);
+                    }
+                    loads.push_back(std::move(clone));
+                }
+            }
+            catch (Core::Error error)
+            {
+                error.add(
+                    errorLabels()[ERROR_OPEN_INPUT].
+                    arg(QDir::toNativeSeparators(input.file)));
+                _context->printError(error);
+                closeSaves();
+                exit(1);
+                return;
+            }
+
+            // When the CPU image processing backend is used the frames are
+            // converted by the reader threads and written by the writer
+            // threads, otherwise they are converted and written by this thread
+            // since the conversions need its OpenGL context.
+            const bool processThreads = AV::OpenGLImageBackend::CPU == AV::OpenGLImageBackend::backend();
+            try
+            {
+                const qint64 writers = processThreads && outputSequence ? std::min(static_cast<qint64>(threads), length) : 1;
+                for (qint64 i = 1; i < writers; ++i)
+                {
+                    saves.push_back(_context->ioFactory()->save(output.file, saveInfo));
+                }
+            }
+            catch (Core::Error error)
             {
-                Core::Timer frameTimer;
-                frameTimer.start();
+                error.add(
+                    errorLabels()[ERROR_OPEN_OUTPUT].
+                    arg(QDir::toNativeSeparators(output.file)));
+                _context->printError(error);
+                closeSaves();
+                exit(1);
+                return;
+            }
+
+            std::vector<std::unique_ptr<AV::CPUImage> > cpuImages;
+            if (processThreads)
+            {
+                for (size_t i = 0; i < loads.size(); ++i)
+                {
+                    cpuImages.push_back(std::unique_ptr<AV::CPUImage>(new AV::CPUImage));
+                    cpuImages.back()->setThreadCount(1);
+                }
+            }
+
+            // When the images are only cropped and the input plugin can read
+            // regions, only the cropped region of each image is read. The crop
+            // is given in display coordinates, so it is mirrored by the image's
+            // own mirror to get the region in pixel data coordinates.
+            Core::Box2i region;
+            if (options.crop.isValid() &&
+                !input.proxy &&
+                scaleSize == loadInfo.layers[0].size &&
+                options.mirror == AV::PixelDataInfo::Mirror() &&
+                Core::BoxUtil::intersect(Core::Box2i(loadInfo.layers[layer].size), options.crop) == options.crop &&
+                _context->ioFactory()->canReadRegion(input.file))
+            {
+                region = AV::PixelDataUtil::mirror(
+                    options.crop,
+                    loadInfo.layers[layer].size,
+                    loadInfo.layers[layer].mirror);
+                position = glm::vec2(0.f, 0.f);
+            }
+            //DJV_DEBUG_PRINT("region = " << region);
 
-                // Load the current image.
-                AV::Image image;
+            imageOptions.xform.position = position;
+            imageOptions.xform.scale = glm::vec2(scaleSize) / glm::vec2(loadInfo.layers[0].size);
+            auto process = [&](std::unique_ptr<AV::Image> & image, AV::CPUImage * cpuImage)
+            {
+                AV::OpenGLImageOptions _imageOptions = imageOptions;
+                _imageOptions.colorProfile = image->colorProfile;
+                if (image->info() != static_cast<AV::PixelDataInfo>(saveInfo.layers[0]) ||
+                    _imageOptions != AV::OpenGLImageOptions())
+                {
+                    std::unique_ptr<AV::Image> tmp(new AV::Image(saveInfo.layers[0]));
+                    if (cpuImage)
+                    {
+                        cpuImage->copy(*image, *tmp, _imageOptions);
+                    }
+                    else
+                    {
+                        openGLImage->copy(*image, *tmp, _imageOptions);
+                    }
+                    tmp->tags = image->tags;
+                    image = std::move(tmp);
+                }
+            };
+
+            // Load the images.
+            auto read = [&](int reader, qint64 i, std::unique_ptr<AV::Image> & image)
+            {
+                Core::Error error;
                 int timeout = input.timeout;
-                while (!image.isValid())
+                while (!image->isValid())
                 {
                     try
                     {
-                        load->read(
-                            image,
-                            AV::ImageIOInfo(
-                                loadInfo.sequence.frames.count() ?
-                                loadInfo.sequence.frames[i] :
-                                -1,
-                                layer,
-                                input.proxy));
+                        AV::ImageIOInfo frame(
+                            loadInfo.sequence.frames.count() ?
+                            loadInfo.sequence.frames[i] :
+                            -1,
+                            layer,
+                            input.proxy);
+                        frame.region = region;
+                        loads[reader]->read(*image, frame);
                     }
                     catch (const Core::Error & in)
                     {
                         error = in;
                     }
-                    if (!image.isValid() && timeout > 0)
+                    if (!image->isValid() && timeout > 0)
                     {
-                        //print("Timeout...");
                         --timeout;
                         Core::Time::sleep(1);
                     }
@@ -344,60 +478,27 @@ namespace djv
                         break;
                     }
                 }
-                if (!image.isValid())
+                if (!image->isValid())
                 {
                     error.add(
                         errorLabels()[ERROR_READ_INPUT].
                         arg(QDir::toNativeSeparators(input.file)));
-                    _context->printError(error);
-                    save->close();
-                    exit(1);
-                    return;
+                    throw error;
                 }
                 //DJV_DEBUG_PRINT("image = " << *image);
-
-                // Process the tags.
-                AV::Tags tags = output.tags;
-                tags.add(image.tags);
-                if (output.tagsAuto)
+                if (processThreads)
                 {
-                    tags[AV::Tags::tagLabels()[AV::Tags::CREATOR]] =
-                        Core::User::current();
-                    tags[AV::Tags::tagLabels()[AV::Tags::TIME]] =
-                        Core::Time::timeToString(Core::Time::current());
-                    tags[AV::Tags::tagLabels()[AV::Tags::TIMECODE]] =
-                        Core::Time::timecodeToString(
-                            Core::Time::frameToTimecode(
-                                saveInfo.sequence.frames.count() ?
-                                saveInfo.sequence.frames[i] :
-                                0,
-                                saveInfo.sequence.speed));
+                    process(image, cpuImages[reader].get());
                 }
+            };
 
-                // Convert.
-                AV::Image * p = &image;
-                AV::Image tmp;
-                imageOptions.xform.position = position;
-                imageOptions.xform.scale = glm::vec2(scaleSize) / glm::vec2(loadInfo.layers[0].size);
-                imageOptions.colorProfile = image.colorProfile;
-                if (p->info() != static_cast<AV::PixelDataInfo>(saveInfo.layers[0]) ||
-                    imageOptions != AV::OpenGLImageOptions())
-                {
-                    tmp.set(saveInfo.layers[0]);
-                    openGLImage->copy(
-                        image,
-                        tmp,
-                        imageOptions);
-                    p = &tmp;
-                }
-                p->tags = tags;
-
-                // Save the image.
-                //DJV_DEBUG_PRINT("output = " << tmp);
+            // Save the images.
+            auto write = [&](int writer, qint64 i, const AV::Image & image)
+            {
                 try
                 {
-                    save->write(
-                        *p,
+                    saves[writer]->write(
+                        image,
                         AV::ImageIOInfo(
                             saveInfo.sequence.frames.count() ?
                             saveInfo.sequence.frames[i] :
@@ -408,30 +509,85 @@ namespace djv
                     error.add(
                         errorLabels()[ERROR_WRITE_OUTPUT].
                         arg(QDir::toNativeSeparators(output.file)));
-                    _context->printError(error);
-                    save->close();
-                    exit(1);
-                    return;
+                    throw error;
                 }
+            };
 
-                // Statistics.
-                timer.check();
-                frameTimer.check();
-                progressAccum += frameTimer.seconds();
-                progressTimer.check();
-                if (length > 1 && progressTimer.seconds() > 3.f)
+            // Convert the images.
+            try
+            {
+                Pipeline pipeline(
+                    length,
+                    static_cast<int>(loads.size()),
+                    processThreads ? static_cast<int>(saves.size()) : 0,
+                    queueDepth,
+                    !outputSequence,
+                    read,
+                    write);
+                Core::Timer pipelineTimer;
+                pipelineTimer.start();
+                Core::Timer progressTimer;
+                progressTimer.start();
+                qint64 i = 0;
+                qint64 count = 0;
+                std::unique_ptr<AV::Image> image;
+                while (pipeline.pop(i, image))
                 {
-                    const float estimate =
-                        progressAccum /
-                        static_cast<float>(i + 1) * (length - (i + 1));
-                    _context->print(qApp->translate("djv::convert::Application",
-                        "[%1%] Estimated = %2 (%3 Frames/Second)").
-                        arg(static_cast<int>(
-                            i / static_cast<float>(length) * 100.f), 3).
-                        arg(Core::Time::labelTime(estimate)).
-                        arg(i / timer.seconds(), 0, 'f', 2));
-                    progressTimer.start();
+                    if (!processThreads)
+                    {
+                        process(image, nullptr);
+                    }
+
+                    // Process the tags.
+                    AV::Tags tags = output.tags;
+                    tags.add(image->tags);
+                    if (output.tagsAuto)
+                    {
+                        tags[AV::Tags::tagLabels()[AV::Tags::CREATOR]] =
+                            Core::User::current();
+                        tags[AV::Tags::tagLabels()[AV::Tags::TIME]] =
+                            Core::Time::timeToString(Core::Time::current());
+                        tags[AV::Tags::tagLabels()[AV::Tags::TIMECODE]] =
+                            Core::Time::timecodeToString(
+                                Core::Time::frameToTimecode(
+                                    saveInfo.sequence.frames.count() ?
+                                    saveInfo.sequence.frames[i] :
+                                    0,
+                                    saveInfo.sequence.speed));
+                    }
+                    image->tags = tags;
+
+                    pipeline.push(i, std::move(image));
+                    ++count;
+
+                    // Statistics.
+                    timer.check();
+                    pipelineTimer.check();
+                    progressTimer.check();
+                    if (length > 1 && progressTimer.seconds() > 3.f)
+                    {
+                        const float estimate =
+                            pipelineTimer.seconds() /
+                            static_cast<float>(count) * (length - count);
+                        _context->print(qApp->translate("djv::convert::Application",
+                            "[%1%] Estimated = %2 (%3 Frames/Second, Threads = %4, Queue Depth = %5)").
+                            arg(static_cast<int>(
+                                count / static_cast<float>(length) * 100.f), 3).
+                            arg(Core::Time::labelTime(estimate)).
+                            arg(count / pipelineTimer.seconds(), 0, 'f', 2).
+                            arg(threads).
+                            arg(queueDepth));
+                        progressTimer.start();
+                    }
                 }
+                pipeline.finish();
+            }
+            catch (const Core::Error & error)
+            {
+                _context->printError(error);
+                closeSaves();
+                exit(1);
+                return;
             }
 
             if (length > 1)
@@ -441,7 +597,10 @@ namespace djv
 
             try
             {
-                save->close();
+                for (auto & i : saves)
+                {
+                    i->close();
+                }
             }
             catch (Core::Error error)
             {
@@ -147,6 +147,14 @@ namespace djv
                     {
                         in >> _options.channel;
                     }
+                    else if (qApp->translate("djv::convert::Context", "-threads") == arg)
+                    {
+                        in >> _options.threads;
+                    }
+                    else if (qApp->translate("djv::convert::Context", "-queue_depth") == arg)
+                    {
+                        in >> _options.queueDepth;
+                    }
 
                     // Parse the input options.
                     else if (qApp->translate("djv::convert::Context", "-layer") == arg)
@@ -254,7 +262,8 @@ namespace djv
                 "    Example of converting an image sequence to a movie:\n"
                 "    > djv_convert input.1-100.tga output.mp4\n"
                 "\n"
-                "    Note that djv_convert requires OpenGL in order to run.\n"
+                "    Note that djv_convert requires OpenGL in order to run unless the CPU "
+                "render backend is used (-render_backend CPU).\n"
                 "\n"
                 "Usage\n"
                 "\n"
@@ -289,33 +298,39 @@ namespace djv
                 "        Crop the image using floating point values (1.0 = 100%).\n"
                 "    -channel (value)\n"
                 "        Show only specific image channels: %1. Default = %2.\n"
+                "    -threads (value)\n"
+                "        Set the number of threads used to read and write frames "
+                "(0 = number of cores). Default = %3.\n"
+                "    -queue_depth (value)\n"
+                "        Set the maximum number of frames waiting in each stage of the "
+                "conversion (0 = twice the number of threads). Default = %4.\n"
                 "\n"
                 "Input Options\n"
                 "\n"
                 "    -layer (value)\n"
                 "        Set the input layer.\n"
                 "    -proxy (value)\n"
-                "        Set the proxy scale: %3. Default = %4.\n"
+                "        Set the proxy scale: %5. Default = %6.\n"
                 "    -time (start) (end)\n"
                 "        Set the start and end time.\n"
                 "    -slate (input) (frames)\n"
                 "        Set the slate.\n"
                 "    -timeout (value)\n"
                 "        Set the maximum number of seconds to wait for each input frame. "
-                "Default = %5.\n"
+                "Default = %7.\n"
                 "\n"
                 "Output Options\n"
                 "\n"
                 "    -pixel (value)\n"
-                "        Convert the pixel type: %6.\n"
+                "        Convert the pixel type: %8.\n"
                 "    -speed (value)\n"
-                "        Set the speed: %7.\n"
+                "        Set the speed: %9.\n"
                 "    -tag (name) (value)\n"
                 "        Set an image tag.\n"
                 "    -tags_auto (value)\n"
-                "        Automatically generate image tags (e.g., timecode): %8. "
-                "Default = %9.\n"
-                "%10"
+                "        Automatically generate image tags (e.g., timecode): %10. "
+                "Default = %11.\n"
+                "%12"
                 "\n"
                 "Examples\n"
                 "\n"
@@ -360,6 +375,8 @@ namespace djv
             return QString(label).
                 arg(AV::OpenGLImageOptions::channelLabels().join(", ")).
                 arg(channelLabel.join(", ")).
+                arg(_options.threads).
+                arg(_options.queueDepth).
                 arg(AV::PixelDataInfo::proxyLabels().join(", ")).
                 arg(proxyLabel.join(", ")).
                 arg(_input.timeout).
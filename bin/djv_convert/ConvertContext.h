@@ -50,6 +50,8 @@ namespace djv
             glm::ivec2 size = glm::ivec2(0, 0);
             Core::Box2i crop;
             Core::Box2f cropPercent;
+            int threads = 0;
+            int queueDepth = 0;
         };
 
         //! This struct provides input options.
@@ -0,0 +1,323 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djv_convert/ConvertPipeline.h>
+
+#include <djvCore/Error.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace djv
+{
+    namespace convert
+    {
+        struct Pipeline::Private
+        {
+            qint64 length = 0;
+            size_t queueDepth = 1;
+            bool ordered = true;
+            ReadCallback read;
+            WriteCallback write;
+
+            std::mutex mutex;
+            std::condition_variable readCV;
+            std::condition_variable readyCV;
+            std::condition_variable writeCV;
+            std::condition_variable writeQueueCV;
+            qint64 readNext = 0;
+            qint64 popped = 0;
+            std::map<qint64, std::unique_ptr<AV::Image> > ready;
+            qint64 writeNext = 0;
+            std::map<qint64, std::unique_ptr<AV::Image> > writeQueue;
+            bool pushDone = false;
+            bool stop = false;
+            bool error = false;
+            Core::Error errorValue;
+
+            std::vector<std::thread> readers;
+            std::vector<std::thread> writers;
+
+            void setError(const Core::Error & value)
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (!error)
+                {
+                    error = true;
+                    errorValue = value;
+                }
+                stop = true;
+                readCV.notify_all();
+                readyCV.notify_all();
+                writeCV.notify_all();
+                writeQueueCV.notify_all();
+            }
+
+            void join()
+            {
+                for (auto & thread : readers)
+                {
+                    if (thread.joinable())
+                    {
+                        thread.join();
+                    }
+                }
+                for (auto & thread : writers)
+                {
+                    if (thread.joinable())
+                    {
+                        thread.join();
+                    }
+                }
+            }
+        };
+
+        Pipeline::Pipeline(
+            qint64                length,
+            int                   readers,
+            int                   writers,
+            int                   queueDepth,
+            bool                  ordered,
+            const ReadCallback &  read,
+            const WriteCallback & write) :
+            _p(new Private)
+        {
+            //DJV_DEBUG("Pipeline::Pipeline");
+            //DJV_DEBUG_PRINT("length = " << length);
+            //DJV_DEBUG_PRINT("readers = " << readers);
+            //DJV_DEBUG_PRINT("writers = " << writers);
+            //DJV_DEBUG_PRINT("queue depth = " << queueDepth);
+            //DJV_DEBUG_PRINT("ordered = " << ordered);
+            _p->length = length;
+            _p->queueDepth = static_cast<size_t>(std::max(queueDepth, 1));
+            _p->ordered = ordered;
+            _p->read = read;
+            _p->write = write;
+            readers = static_cast<int>(std::max(std::min(static_cast<qint64>(readers), length), qint64(1)));
+            writers = ordered ? std::min(writers, 1) : std::max(writers, 0);
+            for (int i = 0; i < readers; ++i)
+            {
+                _p->readers.push_back(std::thread(&Pipeline::readerThread, this, i));
+            }
+            for (int i = 0; i < writers; ++i)
+            {
+                _p->writers.push_back(std::thread(&Pipeline::writerThread, this, i));
+            }
+        }
+
+        Pipeline::~Pipeline()
+        {
+            {
+                std::unique_lock<std::mutex> lock(_p->mutex);
+                _p->stop = true;
+                _p->readCV.notify_all();
+                _p->writeCV.notify_all();
+                _p->writeQueueCV.notify_all();
+            }
+            _p->join();
+        }
+
+        bool Pipeline::pop(qint64 & index, std::unique_ptr<AV::Image> & image)
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            _p->readyCV.wait(lock, [this]
+            {
+                return
+                    _p->error ||
+                    _p->popped >= _p->length ||
+                    (_p->ordered ? _p->ready.count(_p->popped) > 0 : !_p->ready.empty());
+            });
+            if (_p->error || _p->popped >= _p->length)
+                return false;
+            auto i = _p->ordered ? _p->ready.find(_p->popped) : _p->ready.begin();
+            index = i->first;
+            image = std::move(i->second);
+            _p->ready.erase(i);
+            ++_p->popped;
+            _p->readCV.notify_all();
+            return true;
+        }
+
+        void Pipeline::push(qint64 index, std::unique_ptr<AV::Image> image)
+        {
+            if (_p->writers.empty())
+            {
+                {
+                    std::unique_lock<std::mutex> lock(_p->mutex);
+                    if (_p->error)
+                        return;
+                }
+                try
+                {
+                    _p->write(0, index, *image);
+                }
+                catch (const Core::Error & error)
+                {
+                    _p->setError(error);
+                }
+                catch (const std::exception & error)
+                {
+                    _p->setError(Core::Error(error.what()));
+                }
+                return;
+            }
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            _p->writeQueueCV.wait(lock, [this]
+            {
+                return _p->error || _p->writeQueue.size() < _p->queueDepth;
+            });
+            if (_p->error)
+                return;
+            _p->writeQueue[index] = std::move(image);
+            _p->writeCV.notify_all();
+        }
+
+        void Pipeline::finish()
+        {
+            {
+                std::unique_lock<std::mutex> lock(_p->mutex);
+                _p->pushDone = true;
+                _p->writeCV.notify_all();
+            }
+            for (auto & thread : _p->writers)
+            {
+                if (thread.joinable())
+                {
+                    thread.join();
+                }
+            }
+            {
+                std::unique_lock<std::mutex> lock(_p->mutex);
+                _p->stop = true;
+                _p->readCV.notify_all();
+            }
+            _p->join();
+            if (_p->error)
+            {
+                throw _p->errorValue;
+            }
+        }
+
+        void Pipeline::readerThread(int reader)
+        {
+            while (1)
+            {
+                // Wait for room in the queue.
+                qint64 index = 0;
+                {
+                    std::unique_lock<std::mutex> lock(_p->mutex);
+                    _p->readCV.wait(lock, [this]
+                    {
+                        return
+                            _p->stop ||
+                            _p->readNext >= _p->length ||
+                            _p->readNext < _p->popped + static_cast<qint64>(_p->queueDepth);
+                    });
+                    if (_p->stop || _p->readNext >= _p->length)
+                        break;
+                    index = _p->readNext++;
+                }
+
+                // Read the frame.
+                std::unique_ptr<AV::Image> image(new AV::Image);
+                try
+                {
+                    _p->read(reader, index, image);
+                }
+                catch (const Core::Error & error)
+                {
+                    _p->setError(error);
+                    break;
+                }
+                catch (const std::exception & error)
+                {
+                    _p->setError(Core::Error(error.what()));
+                    break;
+                }
+
+                std::unique_lock<std::mutex> lock(_p->mutex);
+                _p->ready[index] = std::move(image);
+                _p->readyCV.notify_all();
+            }
+        }
+
+        void Pipeline::writerThread(int writer)
+        {
+            while (1)
+            {
+                // Wait for a frame to write.
+                qint64 index = 0;
+                std::unique_ptr<AV::Image> image;
+                {
+                    std::unique_lock<std::mutex> lock(_p->mutex);
+                    auto available = [this]
+                    {
+                        return _p->ordered ?
+                            _p->writeQueue.count(_p->writeNext) > 0 :
+                            !_p->writeQueue.empty();
+                    };
+                    _p->writeCV.wait(lock, [this, available]
+                    {
+                        return _p->stop || _p->pushDone || available();
+                    });
+                    if (_p->stop || !available())
+                        break;
+                    auto i = _p->ordered ? _p->writeQueue.find(_p->writeNext) : _p->writeQueue.begin();
+                    index = i->first;
+                    image = std::move(i->second);
+                    _p->writeQueue.erase(i);
+                    ++_p->writeNext;
+                    _p->writeQueueCV.notify_all();
+                }
+
+                // Write the frame.
+                try
+                {
+                    _p->write(writer, index, *image);
+                }
+                catch (const Core::Error & error)
+                {
+                    _p->setError(error);
+                    break;
+                }
+                catch (const std::exception & error)
+                {
+                    _p->setError(Core::Error(error.what()));
+                    break;
+                }
+            }
+        }
+
+    } // namespace convert
+} // namespace djv
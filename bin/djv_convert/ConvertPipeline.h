@@ -0,0 +1,102 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <djvAV/Image.h>
+
+#include <functional>
+#include <memory>
+
+namespace djv
+{
+    namespace convert
+    {
+        //! This class provides a bounded, multi-threaded conversion pipeline.
+        //!
+        //! Frames are read by a pool of reader threads and handed to the
+        //! calling thread with pop(). The calling thread processes the frames
+        //! and hands them back with push(), where they are written by a pool of
+        //! writer threads. When the pipeline is ordered frames are popped and
+        //! written in order and there is only a single writer. When there are
+        //! no writers the frames are written by the calling thread in push(),
+        //! for example when the savers need the calling thread's OpenGL
+        //! context.
+        class Pipeline
+        {
+        public:
+            //! This typedef provides a callback for reading a frame. The first
+            //! argument is the reader thread index. The image may be replaced
+            //! by the callback.
+            //!
+            //! Throws:
+            //! - Core::Error
+            typedef std::function<void(int, qint64, std::unique_ptr<AV::Image> &)> ReadCallback;
+
+            //! This typedef provides a callback for writing a frame. The first
+            //! argument is the writer thread index.
+            //!
+            //! Throws:
+            //! - Core::Error
+            typedef std::function<void(int, qint64, const AV::Image &)> WriteCallback;
+
+            Pipeline(
+                qint64                length,
+                int                   readers,
+                int                   writers,
+                int                   queueDepth,
+                bool                  ordered,
+                const ReadCallback &  read,
+                const WriteCallback & write);
+            ~Pipeline();
+
+            //! Get the next frame that has been read. Returns false when all of
+            //! the frames have been read or an error has occurred.
+            bool pop(qint64 &, std::unique_ptr<AV::Image> &);
+
+            //! Add a frame to be written. This blocks while the write queue is
+            //! full, or while the frame is written when there are no writers.
+            void push(qint64, std::unique_ptr<AV::Image>);
+
+            //! Wait for the remaining frames to be written.
+            //!
+            //! Throws:
+            //! - Core::Error
+            void finish();
+
+        private:
+            void readerThread(int);
+            void writerThread(int);
+
+            struct Private;
+            std::unique_ptr<Private> _p;
+        };
+
+    } // namespace convert
+} // namespace djv
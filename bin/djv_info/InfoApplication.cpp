@@ -339,7 +339,7 @@ namespace djv
 
             // Read the directory contents.
             Core::FileInfoList items;
-            items = Core::FileInfoUtil::list(in, Core::Sequence::format());
+            items = Core::FileInfoUtil::list(in, Core::Sequence::format(), false);
 
             // Process the items.
             Core::FileInfoUtil::filter(items, Core::FileInfoUtil::FILTER_DIRECTORIES);
@@ -372,7 +372,7 @@ namespace djv
             // Recurse.
             if (_context->hasRecurse())
             {
-                Core::FileInfoList list = Core::FileInfoUtil::list(in, Core::Sequence::format());
+                Core::FileInfoList list = Core::FileInfoUtil::list(in, Core::Sequence::format(), false);
                 Core::FileInfoUtil::filter(
                     list,
                     Core::FileInfoUtil::FILTER_FILES | Core::FileInfoUtil::FILTER_HIDDEN);
@@ -245,7 +245,12 @@ namespace djv
             // Read the directory contents.
             if (!QDir(in.path()).exists())
                 return false;
-            Core::FileInfoList items = Core::FileInfoUtil::list(in, Core::Sequence::format());
+            // File system information is only needed for display and sorting.
+            const bool stat =
+                _context->hasFileInfo() ||
+                (_context->sort() != Core::FileInfoUtil::SORT_NAME &&
+                 _context->sort() != Core::FileInfoUtil::SORT_TYPE);
+            Core::FileInfoList items = Core::FileInfoUtil::list(in, Core::Sequence::format(), stat);
 
             // Process the items.
             process(items);
@@ -269,7 +274,7 @@ namespace djv
             bool r = true;
             if (_context->hasRecurse())
             {
-                Core::FileInfoList items = Core::FileInfoUtil::list(in, Core::Sequence::format());
+                Core::FileInfoList items = Core::FileInfoUtil::list(in, Core::Sequence::format(), false);
                 Core::FileInfoUtil::filter(
                     items,
                     Core::FileInfoUtil::FILTER_FILES |
@@ -68,6 +68,7 @@
 #include <QOpenGLContext>
 #include <QOpenGLDebugLogger>
 #include <QScopedPointer>
+#include <QThread>
 #include <QVector>
 
 #include <sstream>
@@ -94,9 +95,9 @@ namespace djv
             qRegisterMetaType<Image>("djv::AV::Image");
             qRegisterMetaType<IOInfo>("djv::AV::IOInfo");
 
-            // Create the default OpenGL context.
-            DJV_LOG(debugLog(), "djv::AV::AVContext", "Creating the default OpenGL context...");
-
+            // Set the default OpenGL surface format. The OpenGL context itself
+            // is not created until it is first needed, so that tools which only
+            // read file information do not require OpenGL.
             QSurfaceFormat defaultFormat;
             defaultFormat.setRenderableType(QSurfaceFormat::OpenGL);
             defaultFormat.setMajorVersion(4);
@@ -108,48 +109,14 @@ namespace djv
                 defaultFormat.setOption(QSurfaceFormat::DebugContext);
             }
             QSurfaceFormat::setDefaultFormat(defaultFormat);
-
-            _p->offscreenSurface.reset(new QOffscreenSurface);
-            QSurfaceFormat surfaceFormat = QSurfaceFormat::defaultFormat();
-            surfaceFormat.setSwapBehavior(QSurfaceFormat::SingleBuffer);
-            surfaceFormat.setSamples(1);
-            _p->offscreenSurface->setFormat(surfaceFormat);
-            _p->offscreenSurface->create();
-            _p->openGLContext.reset(new QOpenGLContext);
-            _p->openGLContext->setFormat(surfaceFormat);
-            if (!_p->openGLContext->create())
-            {
-                throw Core::Error(
-                    "djv::AV::AVContext",
-                    qApp->translate("djv::AV::AVContext", "Cannot create OpenGL context, found version %1.%2").
-                    arg(_p->openGLContext->format().majorVersion()).arg(_p->openGLContext->format().minorVersion()));
-            }
-            _p->openGLContext->makeCurrent(_p->offscreenSurface.data());
-            DJV_LOG(debugLog(), "djv::AV::AVContext",
-                QString("OpenGL context valid = %1").arg(_p->openGLContext->isValid()));
-            DJV_LOG(debugLog(), "djv::AV::AVContext",
-                QString("OpenGL version = %1.%2").
-                arg(_p->openGLContext->format().majorVersion()).
-                arg(_p->openGLContext->format().minorVersion()));
-            if (!_p->openGLContext->versionFunctions<QOpenGLFunctions_3_3_Core>())
-            {
-                throw Core::Error(
-                    "djv::AV::AVContext",
-                    qApp->translate("djv::AV::AVContext", "Cannot find OpenGL 3.3 functions, found version %1.%2").
-                    arg(_p->openGLContext->format().majorVersion()).arg(_p->openGLContext->format().minorVersion()));
-            }
-
-            _p->openGLDebugLogger.reset(new QOpenGLDebugLogger);
-            connect(
-                _p->openGLDebugLogger.data(),
-                &QOpenGLDebugLogger::messageLogged,
-                this,
-                &AVContext::debugLogMessage);
-            if (_p->openGLContext->format().testOption(QSurfaceFormat::DebugContext))
+            OpenGLImage::setContextCallback([this]
             {
-                _p->openGLDebugLogger->initialize();
-                _p->openGLDebugLogger->startLogging();
-            }
+                // The offscreen surface can only be created in the GUI thread.
+                if (QThread::currentThread() == qApp->thread())
+                {
+                    makeGLContextCurrent();
+                }
+            });
 
             //! Create the I/O plugins.
             DJV_LOG(debugLog(), "djv::AV::AVContext", "Loading I/O plugins...");
@@ -189,6 +156,7 @@ namespace djv
         AVContext::~AVContext()
         {
             //DJV_DEBUG("AVContext::~AVContext");
+            OpenGLImage::setContextCallback(nullptr);
 #if defined(DJV_WINDOWS)
             //! \todo On Windows deleting the factory causes the application
             //! to hang on exit.
@@ -203,14 +171,21 @@ namespace djv
 
         QPointer<QOpenGLContext> AVContext::openGLContext() const
         {
+            const_cast<AVContext *>(this)->_initOpenGL();
             return _p->openGLContext.data();
         }
 
         void AVContext::makeGLContextCurrent()
         {
+            _initOpenGL();
             _p->openGLContext->makeCurrent(_p->offscreenSurface.data());
         }
 
+        bool AVContext::hasGLContext() const
+        {
+            return !_p->openGLContext.isNull();
+        }
+
         QString AVContext::info() const
         {
             static const QString label = qApp->translate("djv::AV::AVContext",
@@ -218,22 +193,30 @@ namespace djv
                 "\n"
                 "OpenGL\n"
                 "\n"
-                "    Version: %2.%3\n"
+                "    Version: %2\n"
                 "    Render filter: %4, %5\n"
+                "    Render backend: %6\n"
                 "\n"
                 "I/O\n"
                 "\n"
-                "    Plugins: %6\n");
+                "    Plugins: %7\n");
             QStringList filterMinLabel;
             filterMinLabel << OpenGLImageFilter::filter().min;
             QStringList filterMagLabel;
             filterMagLabel << OpenGLImageFilter::filter().mag;
+            QStringList backendLabel;
+            backendLabel << OpenGLImageBackend::backend();
+            const QString openGLVersion = _p->openGLContext ?
+                QString("%1.%2").
+                arg(_p->openGLContext->format().majorVersion()).
+                arg(_p->openGLContext->format().minorVersion()) :
+                qApp->translate("djv::AV::AVContext", "Not initialized");
             return QString(label).
                 arg(Core::CoreContext::info()).
-                arg(_p->openGLContext->format().majorVersion()).
-                arg(_p->openGLContext->format().minorVersion()).
+                arg(openGLVersion).
                 arg(filterMinLabel.join(", ")).
                 arg(filterMagLabel.join(", ")).
+                arg(backendLabel.join(", ")).
                 arg(_p->ioFactory->names().join(", "));
         }
 
@@ -245,10 +228,24 @@ namespace djv
             if (!Core::CoreContext::commandLineParse(in))
                 return false;
 
-            Q_FOREACH(Core::Plugin * plugin, _p->ioFactory->plugins())
+            // The I/O plugins are only loaded to parse their options when there
+            // are options left on the command line.
+            bool options = false;
+            Q_FOREACH(const QString & arg, in)
             {
-                auto io = static_cast<IOPlugin *>(plugin);
-                io->commandLine(in);
+                if (arg.startsWith('-'))
+                {
+                    options = true;
+                    break;
+                }
+            }
+            if (options)
+            {
+                Q_FOREACH(Core::Plugin * plugin, _p->ioFactory->plugins())
+                {
+                    auto io = static_cast<IOPlugin *>(plugin);
+                    io->commandLine(in);
+                }
             }
 
             QStringList tmp;
@@ -270,6 +267,12 @@ namespace djv
                     {
                         OpenGLImageFilter::setFilter(OpenGLImageFilter::filterHighQuality());
                     }
+                    else if (qApp->translate("djv::AV::AVContext", "-render_backend") == arg)
+                    {
+                        OpenGLImageBackend::BACKEND value = static_cast<OpenGLImageBackend::BACKEND>(0);
+                        in >> value;
+                        OpenGLImageBackend::setBackend(value);
+                    }
 
                     // Leftovers.
                     else
@@ -305,7 +308,9 @@ namespace djv
                 "        Set the render filter: %2. Default = %3, %4.\n"
                 "    -render_filter_high\n"
                 "        Set the render filter to high quality settings (%5, %6).\n"
-                "%7");
+                "    -render_backend (value)\n"
+                "        Set the image processing backend: %7. Default = %8.\n"
+                "%9");
             QStringList filterMinLabel;
             filterMinLabel << OpenGLImageFilter::filter().min;
             QStringList filterMagLabel;
@@ -314,6 +319,8 @@ namespace djv
             filterHighQualityMinLabel << OpenGLImageFilter::filterHighQuality().min;
             QStringList filterHighQualityMagLabel;
             filterHighQualityMagLabel << OpenGLImageFilter::filterHighQuality().mag;
+            QStringList backendLabel;
+            backendLabel << OpenGLImageBackend::backend();
             return QString(label).
                 arg(ioHelp).
                 arg(OpenGLImageFilter::filterLabels().join(", ")).
@@ -321,9 +328,66 @@ namespace djv
                 arg(filterMagLabel.join(", ")).
                 arg(filterHighQualityMinLabel.join(", ")).
                 arg(filterHighQualityMagLabel.join(", ")).
+                arg(OpenGLImageBackend::backendLabels().join(", ")).
+                arg(backendLabel.join(", ")).
                 arg(Core::CoreContext::commandLineHelp());
         }
 
+        void AVContext::_initOpenGL()
+        {
+            if (_p->openGLContext)
+                return;
+
+            DJV_LOG(debugLog(), "djv::AV::AVContext", "Creating the default OpenGL context...");
+
+            std::unique_ptr<QOffscreenSurface> offscreenSurface(new QOffscreenSurface);
+            QSurfaceFormat surfaceFormat = QSurfaceFormat::defaultFormat();
+            surfaceFormat.setSwapBehavior(QSurfaceFormat::SingleBuffer);
+            surfaceFormat.setSamples(1);
+            offscreenSurface->setFormat(surfaceFormat);
+            offscreenSurface->create();
+            std::unique_ptr<QOpenGLContext> openGLContext(new QOpenGLContext);
+            openGLContext->setFormat(surfaceFormat);
+            if (!openGLContext->create())
+            {
+                throw Core::Error(
+                    "djv::AV::AVContext",
+                    qApp->translate("djv::AV::AVContext", "Cannot create OpenGL context, found version %1.%2").
+                    arg(openGLContext->format().majorVersion()).arg(openGLContext->format().minorVersion()));
+            }
+            openGLContext->makeCurrent(offscreenSurface.get());
+            DJV_LOG(debugLog(), "djv::AV::AVContext",
+                QString("OpenGL context valid = %1").arg(openGLContext->isValid()));
+            DJV_LOG(debugLog(), "djv::AV::AVContext",
+                QString("OpenGL version = %1.%2").
+                arg(openGLContext->format().majorVersion()).
+                arg(openGLContext->format().minorVersion()));
+            if (!openGLContext->versionFunctions<QOpenGLFunctions_3_3_Core>())
+            {
+                throw Core::Error(
+                    "djv::AV::AVContext",
+                    qApp->translate("djv::AV::AVContext", "Cannot find OpenGL 3.3 functions, found version %1.%2").
+                    arg(openGLContext->format().majorVersion()).arg(openGLContext->format().minorVersion()));
+            }
+
+            _p->openGLDebugLogger.reset(new QOpenGLDebugLogger);
+            connect(
+                _p->openGLDebugLogger.data(),
+                &QOpenGLDebugLogger::messageLogged,
+                this,
+                &AVContext::debugLogMessage);
+            if (openGLContext->format().testOption(QSurfaceFormat::DebugContext))
+            {
+                _p->openGLDebugLogger->initialize();
+                _p->openGLDebugLogger->startLogging();
+            }
+
+            // Only keep the context once it has been validated, so that a
+            // failure is reported again on the next use.
+            _p->offscreenSurface.reset(offscreenSurface.release());
+            _p->openGLContext.reset(openGLContext.release());
+        }
+
         void AVContext::debugLogMessage(const QOpenGLDebugMessage & message)
         {
             DJV_LOG(debugLog(), "djv::AV::AVContext", message.message());
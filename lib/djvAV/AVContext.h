@@ -41,6 +41,10 @@ namespace djv
         class IOFactory;
 
         //! This class provides the context for the library.
+        //!
+        //! The OpenGL context is created lazily, the first time it is requested
+        //! or an OpenGLImage needs it, so that applications which only read
+        //! file information or use the CPU backend do not require OpenGL.
         class AVContext : public Core::CoreContext
         {
         public:
@@ -50,12 +54,23 @@ namespace djv
             //! Get the I/O factory.    
             QPointer<IOFactory> ioFactory() const;
 
-            //! Get the default OpenGL context.
+            //! Get the default OpenGL context. The context is created on first
+            //! use.
+            //!
+            //! Throws:
+            //! - Core::Error
             QPointer<QOpenGLContext> openGLContext() const;
 
-            //! Make the default OpenGL context current.
+            //! Make the default OpenGL context current, creating it if
+            //! necessary.
+            //!
+            //! Throws:
+            //! - Core::Error
             void makeGLContextCurrent();
 
+            //! Get whether the default OpenGL context has been created.
+            bool hasGLContext() const;
+
             QString info() const override;
 
         protected:
@@ -66,6 +81,8 @@ namespace djv
             void debugLogMessage(const QOpenGLDebugMessage &);
 
         private:
+            void _initOpenGL();
+
             struct Private;
             std::unique_ptr<Private> _p;
         };
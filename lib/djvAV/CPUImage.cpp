@@ -0,0 +1,1093 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvAV/CPUImage.h>
+
+#include <djvAV/ColorUtil.h>
+#include <djvAV/OpenGLImagePrivate.h>
+#include <djvAV/PixelDataUtil.h>
+
+#include <djvCore/Debug.h>
+#include <djvCore/Math.h>
+#include <djvCore/Memory.h>
+#include <djvCore/VectorUtil.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        struct CPUImage::Private
+        {
+            int threadCount = 0;
+        };
+
+        CPUImage::CPUImage() :
+            _p(new Private)
+        {}
+
+        CPUImage::~CPUImage()
+        {}
+
+        int CPUImage::threadCount() const
+        {
+            return _p->threadCount;
+        }
+
+        void CPUImage::setThreadCount(int value)
+        {
+            _p->threadCount = value;
+        }
+
+        namespace
+        {
+            //! The number of scanlines in a tile.
+            const int tileSize = 16;
+
+            int availableThreads(int value)
+            {
+                return value > 0 ?
+                    value :
+                    Core::Math::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+            }
+
+            //! Split the scanlines into tiles and process them in parallel. The
+            //! calling thread also processes tiles.
+            void parallelTiles(int height, int threads, const std::function<void(int, int)> & fnc)
+            {
+                const int tiles = (height + tileSize - 1) / tileSize;
+                threads = Core::Math::min(threads, tiles);
+                std::atomic<int> next(0);
+                auto work = [&]
+                {
+                    int tile = 0;
+                    while ((tile = next++) < tiles)
+                    {
+                        const int y = tile * tileSize;
+                        fnc(y, Core::Math::min(y + tileSize, height));
+                    }
+                };
+                std::vector<std::thread> pool;
+                for (int i = 1; i < threads; ++i)
+                {
+                    pool.push_back(std::thread(work));
+                }
+                work();
+                for (auto & thread : pool)
+                {
+                    thread.join();
+                }
+            }
+
+            bool initAlpha(const Pixel::PIXEL & input, const Pixel::PIXEL & output)
+            {
+                switch (Pixel::format(input))
+                {
+                case Pixel::L:
+                case Pixel::RGB:
+                    switch (Pixel::format(output))
+                    {
+                    case Pixel::LA:
+                    case Pixel::RGBA: return true;
+                    default: break;
+                    }
+                    break;
+                default: break;
+                }
+                return false;
+            }
+
+            //! This struct provides RGBA floating point images for intermediate
+            //! results.
+            struct FloatImage
+            {
+                FloatImage(const glm::ivec2 & size) :
+                    size(size),
+                    data(static_cast<size_t>(size.x) * static_cast<size_t>(size.y))
+                {}
+
+                glm::ivec2             size;
+                std::vector<glm::vec4> data;
+
+                inline glm::vec4 * row(int y)
+                {
+                    return data.data() + static_cast<size_t>(y) * size.x;
+                }
+
+                inline const glm::vec4 * row(int y) const
+                {
+                    return data.data() + static_cast<size_t>(y) * size.x;
+                }
+            };
+
+            //! Convert scanlines to RGBA floating point. This matches the swizzling
+            //! done when the pixel data is used as an OpenGL texture.
+            void readScanlines(const PixelData & in, FloatImage & out, int y0, int y1)
+            {
+                const PixelDataInfo & info = in.info();
+                const int w = info.size.x;
+                const Pixel::FORMAT format = Pixel::format(info.pixel);
+                const int channels = Pixel::channels(format);
+                const Pixel::PIXEL floatPixel = Pixel::pixel(format, Pixel::F32);
+                const bool endian = info.endian != Core::Memory::endian();
+                const int wordSize = Pixel::RGB_U10 == info.pixel ? 4 : Pixel::channelByteCount(info.pixel);
+                std::vector<quint8> endianTmp(endian ? in.scanlineByteCount() : 0);
+                std::vector<Pixel::F32_T> floatTmp(w * channels);
+                for (int y = y0; y < y1; ++y)
+                {
+                    const quint8 * p = in.data(0, y);
+                    if (endian)
+                    {
+                        Core::Memory::convertEndian(p, endianTmp.data(), in.scanlineByteCount() / wordSize, wordSize);
+                        p = endianTmp.data();
+                    }
+                    Pixel::convert(p, info.pixel, floatTmp.data(), floatPixel, w, 1, info.bgr);
+                    const Pixel::F32_T * floatP = floatTmp.data();
+                    glm::vec4 * outP = out.row(y);
+                    for (int x = 0; x < w; ++x, floatP += channels, ++outP)
+                    {
+                        switch (format)
+                        {
+                        case Pixel::L:    *outP = glm::vec4(floatP[0], floatP[0], floatP[0], 1.f); break;
+                        case Pixel::LA:   *outP = glm::vec4(floatP[0], floatP[0], floatP[0], floatP[1]); break;
+                        case Pixel::RGB:  *outP = glm::vec4(floatP[0], floatP[1], floatP[2], 1.f); break;
+                        case Pixel::RGBA: *outP = glm::vec4(floatP[0], floatP[1], floatP[2], floatP[3]); break;
+                        default: break;
+                        }
+                    }
+                }
+            }
+
+            //! Convert a RGBA floating point scanline to the output pixel type.
+            void writeScanline(const glm::vec4 * in, PixelData & out, int y)
+            {
+                const PixelDataInfo & info = out.info();
+                const int w = info.size.x;
+                const Pixel::FORMAT format = Pixel::format(info.pixel);
+                const int channels = Pixel::channels(format);
+                std::vector<Pixel::F32_T> floatTmp(w * channels);
+                Pixel::F32_T * floatP = floatTmp.data();
+                for (int x = 0; x < w; ++x, ++in, floatP += channels)
+                {
+                    switch (format)
+                    {
+                    case Pixel::L:
+                        floatP[0] = (*in)[0];
+                        break;
+                    case Pixel::LA:
+                        floatP[0] = (*in)[0];
+                        floatP[1] = (*in)[3];
+                        break;
+                    case Pixel::RGB:
+                        floatP[0] = (*in)[0];
+                        floatP[1] = (*in)[1];
+                        floatP[2] = (*in)[2];
+                        break;
+                    case Pixel::RGBA:
+                        floatP[0] = (*in)[0];
+                        floatP[1] = (*in)[1];
+                        floatP[2] = (*in)[2];
+                        floatP[3] = (*in)[3];
+                        break;
+                    default: break;
+                    }
+                }
+                quint8 * p = out.data(0, y);
+                Pixel::convert(floatTmp.data(), Pixel::pixel(format, Pixel::F32), p, info.pixel, w, 1, info.bgr);
+                if (info.endian != Core::Memory::endian())
+                {
+                    const int wordSize = Pixel::RGB_U10 == info.pixel ? 4 : Pixel::channelByteCount(info.pixel);
+                    Core::Memory::convertEndian(p, out.scanlineByteCount() / wordSize, wordSize);
+                }
+            }
+
+            inline glm::vec4 sampleNearest(const FloatImage & in, float u, float v)
+            {
+                const int x = Core::Math::min(static_cast<int>(u * in.size.x), in.size.x - 1);
+                const int y = Core::Math::min(static_cast<int>(v * in.size.y), in.size.y - 1);
+                return in.row(y)[x];
+            }
+
+            inline glm::vec4 sampleLinear(const FloatImage & in, float u, float v)
+            {
+                const float fx = u * in.size.x - .5f;
+                const float fy = v * in.size.y - .5f;
+                const int   x = Core::Math::floor(fx);
+                const int   y = Core::Math::floor(fy);
+                const float tx = fx - x;
+                const float ty = fy - y;
+                const int   x0 = Core::Math::clamp(x, 0, in.size.x - 1);
+                const int   x1 = Core::Math::clamp(x + 1, 0, in.size.x - 1);
+                const glm::vec4 * row0 = in.row(Core::Math::clamp(y, 0, in.size.y - 1));
+                const glm::vec4 * row1 = in.row(Core::Math::clamp(y + 1, 0, in.size.y - 1));
+                return
+                    (row0[x0] * (1.f - tx) + row0[x1] * tx) * (1.f - ty) +
+                    (row1[x0] * (1.f - tx) + row1[x1] * tx) * ty;
+            }
+
+            //! This struct provides a floating point lookup table. Values are
+            //! looked up with nearest sampling and clamping to match OpenGLLUT.
+            struct FloatLUT
+            {
+                void init(const PixelData & in)
+                {
+                    channels = in.channels();
+                    size = in.w();
+                    data.resize(size * channels);
+                    Pixel::convert(
+                        in.data(),
+                        in.pixel(),
+                        data.data(),
+                        Pixel::pixel(Pixel::format(in.pixel()), Pixel::F32),
+                        size,
+                        1,
+                        in.info().bgr);
+                }
+
+                inline float operator () (float value, int channel) const
+                {
+                    const int i = Core::Math::min(
+                        static_cast<int>(Core::Math::clamp(value, 0.f, 1.f) * size),
+                        size - 1);
+                    return data[i * channels + channel];
+                }
+
+                void apply(glm::vec4 & value) const
+                {
+                    const FloatLUT & lut = *this;
+                    switch (channels)
+                    {
+                    case 1:
+                        value[0] = lut(value[0], 0);
+                        value[1] = lut(value[1], 0);
+                        value[2] = lut(value[2], 0);
+                        break;
+                    case 2:
+                        value[0] = lut(value[0], 0);
+                        value[1] = lut(value[1], 0);
+                        value[2] = lut(value[2], 0);
+                        value[3] = lut(value[3], 1);
+                        break;
+                    case 3:
+                        value[0] = lut(value[0], 0);
+                        value[1] = lut(value[1], 1);
+                        value[2] = lut(value[2], 2);
+                        break;
+                    case 4:
+                        value[0] = lut(value[0], 0);
+                        value[1] = lut(value[1], 1);
+                        value[2] = lut(value[2], 2);
+                        value[3] = lut(value[3], 3);
+                        break;
+                    default: break;
+                    }
+                }
+
+                int                       channels = 0;
+                int                       size = 0;
+                std::vector<Pixel::F32_T> data;
+            };
+
+            inline float knee(float value, float f)
+            {
+                return Core::Math::log(value * f + 1.f) / f;
+            }
+
+            //! This class provides the color operations of the OpenGL image
+            //! shaders.
+            class ColorPipeline
+            {
+            public:
+                ColorPipeline(const OpenGLImageOptions & options) :
+                    _premultipliedAlpha(options.premultipliedAlpha),
+                    _colorProfile(options.colorProfile.type),
+                    _channel(options.channel)
+                {
+                    switch (_colorProfile)
+                    {
+                    case ColorProfile::LUT:
+                        _colorProfileLut.init(options.colorProfile.lut);
+                        break;
+                    case ColorProfile::GAMMA:
+                        _colorProfileGamma = 1.f / options.colorProfile.gamma;
+                        break;
+                    case ColorProfile::EXPOSURE:
+                        _exposure = OpenGLImageExposure::create(options.colorProfile.exposure);
+                        break;
+                    default: break;
+                    }
+
+                    const OpenGLImageDisplayProfile & displayProfile = options.displayProfile;
+                    _displayProfileLut = displayProfile.lut.isValid();
+                    if (_displayProfileLut)
+                    {
+                        _displayProfileLutData.init(displayProfile.lut);
+                    }
+                    _displayProfileColor = displayProfile.color != OpenGLImageDisplayProfile().color;
+                    if (_displayProfileColor)
+                    {
+                        _displayProfileColorMatrix = OpenGLImageColor::colorMatrix(displayProfile.color);
+                    }
+                    _displayProfileLevels = displayProfile.levels != OpenGLImageDisplayProfile().levels;
+                    if (_displayProfileLevels)
+                    {
+                        _levelsIn0 = displayProfile.levels.inLow;
+                        _levelsIn1 = displayProfile.levels.inHigh - displayProfile.levels.inLow;
+                        _levelsGamma = !Core::Math::fuzzyCompare(displayProfile.levels.gamma, 1.f);
+                        _levelsGammaValue = 1.f / displayProfile.levels.gamma;
+                        _levelsOut0 = displayProfile.levels.outLow;
+                        _levelsOut1 = displayProfile.levels.outHigh - displayProfile.levels.outLow;
+                    }
+                    _softClip = displayProfile.softClip;
+                }
+
+                inline void premultiply(glm::vec4 & value) const
+                {
+                    if (_premultipliedAlpha)
+                    {
+                        value[0] *= value[3];
+                        value[1] *= value[3];
+                        value[2] *= value[3];
+                    }
+                }
+
+                void colorProfile(glm::vec4 & value) const
+                {
+                    switch (_colorProfile)
+                    {
+                    case ColorProfile::LUT:
+                        _colorProfileLut.apply(value);
+                        break;
+                    case ColorProfile::GAMMA:
+                        for (int c = 0; c < 3; ++c)
+                        {
+                            if (value[c] >= 0.f)
+                            {
+                                value[c] = Core::Math::pow(value[c], _colorProfileGamma);
+                            }
+                        }
+                        break;
+                    case ColorProfile::EXPOSURE:
+                        for (int c = 0; c < 3; ++c)
+                        {
+                            value[c] = Core::Math::max(0.f, value[c] - _exposure.d) * _exposure.v;
+                            if (value[c] > _exposure.k)
+                            {
+                                value[c] = _exposure.k + knee(value[c] - _exposure.k, _exposure.f);
+                            }
+                            value[c] *= .332f;
+                        }
+                        break;
+                    default: break;
+                    }
+                }
+
+                void displayProfile(glm::vec4 & value) const
+                {
+                    if (_displayProfileLut)
+                    {
+                        _displayProfileLutData.apply(value);
+                    }
+                    if (_displayProfileColor)
+                    {
+                        const glm::vec4 tmp = glm::vec4(value[0], value[1], value[2], 1.f) * _displayProfileColorMatrix;
+                        value = glm::vec4(tmp[0], tmp[1], tmp[2], value[3]);
+                    }
+                    if (_displayProfileLevels)
+                    {
+                        for (int c = 0; c < 3; ++c)
+                        {
+                            float tmp = (value[c] - _levelsIn0) / _levelsIn1;
+                            if (_levelsGamma && tmp >= 0.f)
+                            {
+                                tmp = Core::Math::pow(tmp, _levelsGammaValue);
+                            }
+                            value[c] = tmp * _levelsOut1 + _levelsOut0;
+                        }
+                    }
+                    if (_softClip != 0.f)
+                    {
+                        const float tmp = 1.f - _softClip;
+                        for (int c = 0; c < 3; ++c)
+                        {
+                            if (value[c] > tmp)
+                            {
+                                value[c] = tmp + (1.f - Core::Math::exp(-(value[c] - tmp) / _softClip)) * _softClip;
+                            }
+                        }
+                    }
+                    if (_channel)
+                    {
+                        value = glm::vec4(value[_channel - 1]);
+                    }
+                }
+
+            private:
+                bool                        _premultipliedAlpha = false;
+                ColorProfile::PROFILE       _colorProfile = ColorProfile::RAW;
+                FloatLUT                    _colorProfileLut;
+                float                       _colorProfileGamma = 1.f;
+                OpenGLImageExposure         _exposure;
+                bool                        _displayProfileLut = false;
+                FloatLUT                    _displayProfileLutData;
+                bool                        _displayProfileColor = false;
+                glm::mat4x4                 _displayProfileColorMatrix;
+                bool                        _displayProfileLevels = false;
+                float                       _levelsIn0 = 0.f;
+                float                       _levelsIn1 = 1.f;
+                bool                        _levelsGamma = false;
+                float                       _levelsGammaValue = 1.f;
+                float                       _levelsOut0 = 0.f;
+                float                       _levelsOut1 = 1.f;
+                float                       _softClip = 0.f;
+                OpenGLImageOptions::CHANNEL _channel = OpenGLImageOptions::CHANNEL_DEFAULT;
+            };
+
+            //! This struct provides the filter contributions for scaling.
+            struct Contrib
+            {
+                Contrib(int input, int output, OpenGLImageFilter::FILTER filter)
+                {
+                    PixelData data;
+                    scaleContrib(input, output, filter, data);
+                    width = data.h();
+                    index.resize(output * width);
+                    weight.resize(output * width);
+                    for (int i = 0; i < output; ++i)
+                    {
+                        for (int j = 0; j < width; ++j)
+                        {
+                            const Pixel::F32_T * p = reinterpret_cast<const Pixel::F32_T *>(data.data(i, j));
+                            index[i * width + j] = Core::Math::clamp(Core::Math::round(p[0] * input), 0, input - 1);
+                            weight[i * width + j] = p[1];
+                        }
+                    }
+                }
+
+                int                width = 0;
+                std::vector<int>   index;
+                std::vector<float> weight;
+            };
+
+        } // namespace
+
+        void CPUImage::copy(
+            const PixelData &          input,
+            PixelData &                output,
+            const OpenGLImageOptions & options)
+        {
+            //DJV_DEBUG("CPUImage::copy");
+            //DJV_DEBUG_PRINT("input = " << input);
+            //DJV_DEBUG_PRINT("output = " << output);
+
+            const PixelDataInfo & info = input.info();
+            const int threads = availableThreads(_p->threadCount);
+            const int proxyScale =
+                options.proxyScale ?
+                PixelDataUtil::proxyScale(info.proxy) :
+                1;
+            const glm::ivec2 scale(
+                Core::Math::ceil(options.xform.scale.x * info.size.x * proxyScale),
+                Core::Math::ceil(options.xform.scale.y * info.size.y * proxyScale));
+            //DJV_DEBUG_PRINT("scale = " << scale);
+            const PixelDataInfo::Mirror mirror(
+                (info.mirror.x != options.xform.mirror.x) != output.info().mirror.x,
+                (info.mirror.y != options.xform.mirror.y) != output.info().mirror.y);
+            const OpenGLImageFilter::FILTER filter = scaleFilter(info.size, scale, options.filter);
+            //DJV_DEBUG_PRINT("filter = " << filter);
+            const ColorPipeline pipeline(options);
+
+            Color background(Pixel::RGB_F32);
+            ColorUtil::convert(options.background, background);
+            const glm::vec4 backgroundValue(
+                background.f32(0),
+                background.f32(1),
+                background.f32(2),
+                initAlpha(input.pixel(), output.pixel()) ? 1.f : 0.f);
+
+            // Make sure the output is not backed by file I/O before the threads
+            // start writing to it.
+            output.data();
+
+            if (!Core::VectorUtil::isSizeValid(info.size) || !Core::VectorUtil::isSizeValid(scale))
+            {
+                parallelTiles(output.h(), threads, [&](int y0, int y1)
+                {
+                    const std::vector<glm::vec4> row(output.w(), backgroundValue);
+                    for (int y = y0; y < y1; ++y)
+                    {
+                        writeScanline(row.data(), output, y);
+                    }
+                });
+                return;
+            }
+
+            switch (filter)
+            {
+            case OpenGLImageFilter::NEAREST:
+            case OpenGLImageFilter::LINEAR:
+            {
+                //DJV_DEBUG_PRINT("single pass");
+                FloatImage source(info.size);
+                parallelTiles(info.size.y, threads, [&](int y0, int y1)
+                {
+                    readScanlines(input, source, y0, y1);
+                });
+
+                // Map the output pixels back to the input with the inverse of
+                // the transform.
+                const glm::mat4x4 m = glm::inverse(OpenGLImageXform::xformMatrix(options.xform));
+                const glm::vec4 dx = m[0];
+                const glm::vec2 size(info.size.x * proxyScale, info.size.y * proxyScale);
+                const bool linear = OpenGLImageFilter::LINEAR == filter;
+                parallelTiles(output.h(), threads, [&](int y0, int y1)
+                {
+                    std::vector<glm::vec4> row(output.w());
+                    for (int y = y0; y < y1; ++y)
+                    {
+                        glm::vec4 p = m * glm::vec4(.5f, y + .5f, 0.f, 1.f);
+                        for (int x = 0; x < output.w(); ++x, p += dx)
+                        {
+                            float u = p.x / size.x;
+                            float v = p.y / size.y;
+                            if (u < 0.f || u >= 1.f || v < 0.f || v >= 1.f)
+                            {
+                                row[x] = backgroundValue;
+                                continue;
+                            }
+                            if (mirror.x)
+                            {
+                                u = 1.f - u;
+                            }
+                            if (mirror.y)
+                            {
+                                v = 1.f - v;
+                            }
+                            glm::vec4 value = linear ? sampleLinear(source, u, v) : sampleNearest(source, u, v);
+                            pipeline.premultiply(value);
+                            pipeline.colorProfile(value);
+                            pipeline.displayProfile(value);
+                            row[x] = value;
+                        }
+                        writeScanline(row.data(), output, y);
+                    }
+                });
+            }
+            break;
+            case OpenGLImageFilter::BOX:
+            case OpenGLImageFilter::TRIANGLE:
+            case OpenGLImageFilter::BELL:
+            case OpenGLImageFilter::BSPLINE:
+            case OpenGLImageFilter::LANCZOS3:
+            case OpenGLImageFilter::CUBIC:
+            case OpenGLImageFilter::MITCHELL:
+            {
+                //DJV_DEBUG_PRINT("two pass");
+                FloatImage source(info.size);
+                parallelTiles(info.size.y, threads, [&](int y0, int y1)
+                {
+                    readScanlines(input, source, y0, y1);
+                    for (int y = y0; y < y1; ++y)
+                    {
+                        glm::vec4 * p = source.row(y);
+                        for (int x = 0; x < info.size.x; ++x, ++p)
+                        {
+                            pipeline.colorProfile(*p);
+                        }
+                    }
+                });
+
+                // Horizontal pass.
+                const Contrib contribX(info.size.x, scale.x, filter);
+                FloatImage scaleX(glm::ivec2(scale.x, info.size.y));
+                parallelTiles(info.size.y, threads, [&](int y0, int y1)
+                {
+                    for (int y = y0; y < y1; ++y)
+                    {
+                        const glm::vec4 * inP = source.row(mirror.y ? (info.size.y - 1 - y) : y);
+                        glm::vec4 * outP = scaleX.row(y);
+                        for (int x = 0; x < scale.x; ++x)
+                        {
+                            const int i = (mirror.x ? (scale.x - 1 - x) : x) * contribX.width;
+                            glm::vec4 value(0.f);
+                            for (int j = 0; j < contribX.width; ++j)
+                            {
+                                value += contribX.weight[i + j] * inP[contribX.index[i + j]];
+                            }
+                            outP[x] = value;
+                        }
+                    }
+                });
+
+                // Vertical pass.
+                const Contrib contribY(info.size.y, scale.y, filter);
+                FloatImage scaleY(scale);
+                parallelTiles(scale.y, threads, [&](int y0, int y1)
+                {
+                    for (int y = y0; y < y1; ++y)
+                    {
+                        glm::vec4 * outP = scaleY.row(y);
+                        for (int x = 0; x < scale.x; ++x)
+                        {
+                            outP[x] = glm::vec4(0.f);
+                        }
+                        const int i = y * contribY.width;
+                        for (int j = 0; j < contribY.width; ++j)
+                        {
+                            const float weight = contribY.weight[i + j];
+                            if (weight != 0.f)
+                            {
+                                const glm::vec4 * inP = scaleX.row(contribY.index[i + j]);
+                                for (int x = 0; x < scale.x; ++x)
+                                {
+                                    outP[x] += weight * inP[x];
+                                }
+                            }
+                        }
+                    }
+                });
+
+                // Place the scaled image with the remainder of the transform.
+                OpenGLImageXform xform = options.xform;
+                xform.scale = glm::vec2(1.f, 1.f);
+                const glm::mat4x4 m = glm::inverse(OpenGLImageXform::xformMatrix(xform));
+                const glm::vec4 dx = m[0];
+                parallelTiles(output.h(), threads, [&](int y0, int y1)
+                {
+                    std::vector<glm::vec4> row(output.w());
+                    for (int y = y0; y < y1; ++y)
+                    {
+                        glm::vec4 p = m * glm::vec4(.5f, y + .5f, 0.f, 1.f);
+                        for (int x = 0; x < output.w(); ++x, p += dx)
+                        {
+                            if (p.x < 0.f || p.y < 0.f || p.x >= scale.x || p.y >= scale.y)
+                            {
+                                row[x] = backgroundValue;
+                                continue;
+                            }
+                            glm::vec4 value = scaleY.row(static_cast<int>(p.y))[static_cast<int>(p.x)];
+                            pipeline.premultiply(value);
+                            pipeline.displayProfile(value);
+                            row[x] = value;
+                        }
+                        writeScanline(row.data(), output, y);
+                    }
+                });
+            }
+            break;
+            default: break;
+            }
+        }
+
+        namespace
+        {
+            template<typename T>
+            void averageScanlines(const PixelData & in, int y0, int y1, const Pixel::Mask & mask, double * accum)
+            {
+                const int w = in.w();
+                const int channels = in.channels();
+                for (int y = y0; y < y1; ++y)
+                {
+                    const T * p = reinterpret_cast<const T *>(in.data(0, y));
+                    for (int x = 0; x < w; ++x, p += channels)
+                    {
+                        for (int c = 0; c < channels; ++c)
+                        {
+                            if (mask[c])
+                            {
+                                accum[c] += static_cast<float>(p[c]);
+                            }
+                        }
+                    }
+                }
+            }
+
+            void averageScanlinesU10(const PixelData & in, int y0, int y1, const Pixel::Mask & mask, double * accum)
+            {
+                const int w = in.w();
+                for (int y = y0; y < y1; ++y)
+                {
+                    const Pixel::U10_S * p = reinterpret_cast<const Pixel::U10_S *>(in.data(0, y));
+                    for (int x = 0; x < w; ++x, ++p)
+                    {
+                        if (mask[0])
+                            accum[0] += p->r;
+                        if (mask[1])
+                            accum[1] += p->g;
+                        if (mask[2])
+                            accum[2] += p->b;
+                    }
+                }
+            }
+
+        } // namespace
+
+        void CPUImage::average(
+            const PixelData &   in,
+            Color &             out,
+            const Pixel::Mask & mask)
+        {
+            //DJV_DEBUG("CPUImage::average");
+            //DJV_DEBUG_PRINT("in = " << in);
+
+            out.setPixel(in.pixel());
+
+            const double area = static_cast<double>(in.w()) * static_cast<double>(in.h());
+            if (area <= 0.0)
+                return;
+            const int channels = Pixel::channels(in.pixel());
+
+            // Accumulate each tile separately and then merge the results.
+            double accum[Pixel::channelsMax] = { 0.0, 0.0, 0.0, 0.0 };
+            std::mutex mutex;
+            parallelTiles(in.h(), availableThreads(_p->threadCount), [&](int y0, int y1)
+            {
+                double tileAccum[Pixel::channelsMax] = { 0.0, 0.0, 0.0, 0.0 };
+                switch (Pixel::type(in.pixel()))
+                {
+                case Pixel::U8:  averageScanlines<Pixel::U8_T>(in, y0, y1, mask, tileAccum); break;
+                case Pixel::U10: averageScanlinesU10(in, y0, y1, mask, tileAccum); break;
+                case Pixel::U16: averageScanlines<Pixel::U16_T>(in, y0, y1, mask, tileAccum); break;
+                case Pixel::F16: averageScanlines<Pixel::F16_T>(in, y0, y1, mask, tileAccum); break;
+                case Pixel::F32: averageScanlines<Pixel::F32_T>(in, y0, y1, mask, tileAccum); break;
+                default: break;
+                }
+                std::unique_lock<std::mutex> lock(mutex);
+                for (int c = 0; c < Pixel::channelsMax; ++c)
+                {
+                    accum[c] += tileAccum[c];
+                }
+            });
+
+            for (int c = 0; c < channels; ++c)
+            {
+                const double value = accum[c] / area;
+                switch (Pixel::type(in.pixel()))
+                {
+                case Pixel::U8:  out.setU8(static_cast<int>(value), c); break;
+                case Pixel::U10: out.setU10(static_cast<int>(value), c); break;
+                case Pixel::U16: out.setU16(static_cast<int>(value), c); break;
+                case Pixel::F16: out.setF16(static_cast<Pixel::F16_T>(static_cast<float>(value)), c); break;
+                case Pixel::F32: out.setF32(static_cast<Pixel::F32_T>(value), c); break;
+                default: break;
+                }
+            }
+            //DJV_DEBUG_PRINT("out = " << out);
+        }
+
+        namespace
+        {
+            inline int histogramIndex(Pixel::U8_T value)
+            {
+                return Pixel::u8ToU16(value);
+            }
+
+            inline int histogramIndex(Pixel::U16_T value)
+            {
+                return value;
+            }
+
+            inline int histogramIndex(Pixel::F16_T value)
+            {
+                return Pixel::f16ToU16(value);
+            }
+
+            inline int histogramIndex(Pixel::F32_T value)
+            {
+                return Pixel::f32ToU16(value);
+            }
+
+            //! Count the pixel values. Each tile is counted separately and the
+            //! results are merged. The minimum and maximum values should be
+            //! initialized with a pixel from the input.
+            template<typename T>
+            void histogramTiles(
+                const PixelData &        in,
+                int                      outChannels,
+                const std::vector<int> & indexLut,
+                const Pixel::Mask &      mask,
+                int                      threads,
+                std::vector<int> &       counts,
+                T *                      min,
+                T *                      max)
+            {
+                const int w = in.w();
+                const int channels = in.channels();
+                T minInit[Pixel::channelsMax];
+                T maxInit[Pixel::channelsMax];
+                for (int c = 0; c < channels; ++c)
+                {
+                    minInit[c] = min[c];
+                    maxInit[c] = max[c];
+                }
+                std::mutex mutex;
+                parallelTiles(in.h(), threads, [&](int y0, int y1)
+                {
+                    std::vector<int> tileCounts(counts.size(), 0);
+                    T tileMin[Pixel::channelsMax];
+                    T tileMax[Pixel::channelsMax];
+                    for (int c = 0; c < channels; ++c)
+                    {
+                        tileMin[c] = minInit[c];
+                        tileMax[c] = maxInit[c];
+                    }
+                    for (int y = y0; y < y1; ++y)
+                    {
+                        const T * p = reinterpret_cast<const T *>(in.data(0, y));
+                        for (int x = 0; x < w; ++x, p += channels)
+                        {
+                            for (int c = 0; c < outChannels; ++c)
+                            {
+                                if (mask[c])
+                                {
+                                    ++tileCounts[indexLut[histogramIndex(p[c])] * outChannels + c];
+                                    tileMin[c] = Core::Math::min(p[c], tileMin[c]);
+                                    tileMax[c] = Core::Math::max(p[c], tileMax[c]);
+                                }
+                            }
+                        }
+                    }
+                    std::unique_lock<std::mutex> lock(mutex);
+                    for (size_t i = 0; i < counts.size(); ++i)
+                    {
+                        counts[i] += tileCounts[i];
+                    }
+                    for (int c = 0; c < outChannels; ++c)
+                    {
+                        if (mask[c])
+                        {
+                            min[c] = Core::Math::min(tileMin[c], min[c]);
+                            max[c] = Core::Math::max(tileMax[c], max[c]);
+                        }
+                    }
+                });
+            }
+
+            void histogramTilesU10(
+                const PixelData &        in,
+                const std::vector<int> & indexLut,
+                const Pixel::Mask &      mask,
+                int                      threads,
+                std::vector<int> &       counts,
+                Pixel::U10_S *           min,
+                Pixel::U10_S *           max)
+            {
+                const int w = in.w();
+                const Pixel::U10_S minInit = *min;
+                const Pixel::U10_S maxInit = *max;
+                std::mutex mutex;
+                parallelTiles(in.h(), threads, [&](int y0, int y1)
+                {
+                    std::vector<int> tileCounts(counts.size(), 0);
+                    Pixel::U10_S tileMin = minInit;
+                    Pixel::U10_S tileMax = maxInit;
+                    for (int y = y0; y < y1; ++y)
+                    {
+                        const Pixel::U10_S * p = reinterpret_cast<const Pixel::U10_S *>(in.data(0, y));
+                        for (int x = 0; x < w; ++x, ++p)
+                        {
+                            if (mask[0])
+                            {
+                                ++tileCounts[indexLut[p->r] * 3 + 0];
+                                tileMin.r = Core::Math::min(p->r, tileMin.r);
+                                tileMax.r = Core::Math::max(p->r, tileMax.r);
+                            }
+                            if (mask[1])
+                            {
+                                ++tileCounts[indexLut[p->g] * 3 + 1];
+                                tileMin.g = Core::Math::min(p->g, tileMin.g);
+                                tileMax.g = Core::Math::max(p->g, tileMax.g);
+                            }
+                            if (mask[2])
+                            {
+                                ++tileCounts[indexLut[p->b] * 3 + 2];
+                                tileMin.b = Core::Math::min(p->b, tileMin.b);
+                                tileMax.b = Core::Math::max(p->b, tileMax.b);
+                            }
+                        }
+                    }
+                    std::unique_lock<std::mutex> lock(mutex);
+                    for (size_t i = 0; i < counts.size(); ++i)
+                    {
+                        counts[i] += tileCounts[i];
+                    }
+                    if (mask[0])
+                    {
+                        min->r = Core::Math::min(tileMin.r, min->r);
+                        max->r = Core::Math::max(tileMax.r, max->r);
+                    }
+                    if (mask[1])
+                    {
+                        min->g = Core::Math::min(tileMin.g, min->g);
+                        max->g = Core::Math::max(tileMax.g, max->g);
+                    }
+                    if (mask[2])
+                    {
+                        min->b = Core::Math::min(tileMin.b, min->b);
+                        max->b = Core::Math::max(tileMax.b, max->b);
+                    }
+                });
+            }
+
+        } // namespace
+
+        void CPUImage::histogram(
+            const PixelData &   in,
+            PixelData &         out,
+            int                 size,
+            Color &             min,
+            Color &             max,
+            const Pixel::Mask & mask)
+        {
+            //DJV_DEBUG("CPUImage::histogram");
+            //DJV_DEBUG_PRINT("in = " << in);
+            //DJV_DEBUG_PRINT("size = " << size);
+
+            // Create the output data using a pixel type of U16.
+            Pixel::PIXEL pixel = static_cast<Pixel::PIXEL>(0);
+            switch (in.channels())
+            {
+            case 4:
+            case 3: pixel = Pixel::RGB_U16; break;
+            case 2:
+            case 1: pixel = Pixel::L_U16;   break;
+            default: break;
+            }
+            const int outChannels = Pixel::channels(pixel);
+            out.set(PixelDataInfo(size, 1, pixel));
+            out.zero();
+            //DJV_DEBUG_PRINT("out = " << out);
+
+            // We may need to convert the input data if it's in a weird format so
+            // that we can work directly with the pixels.
+            const PixelData * data = &in;
+            PixelData tmp;
+            const PixelDataInfo info(in.size(), in.pixel());
+            if (in.info() != info)
+            {
+                //DJV_DEBUG_PRINT("convert");
+                tmp.set(info);
+                OpenGLImageOptions options;
+                options.proxyScale = false;
+                copy(in, tmp, options);
+                data = &tmp;
+            }
+
+            min = Color(info.pixel);
+            max = Color(info.pixel);
+            const int w = info.size.x;
+            const int h = info.size.y;
+            if (!w || !h)
+                return;
+
+            // Create a LUT for mapping input pixel values to the output data
+            // pixel indexes.
+            const int indexLutSize = Pixel::RGB_U10 == info.pixel ? 1024 : (Pixel::u16Max + 1);
+            //DJV_DEBUG_PRINT("index lut size = " << indexLutSize);
+            std::vector<int> indexLut(indexLutSize);
+            for (int i = 0; i < indexLutSize; ++i)
+            {
+                indexLut[i] = Core::Math::floor(
+                    i / static_cast<float>(indexLutSize - 1) * (size - 1));
+            }
+
+            // Initialize the minimum and maximum values with the first pixel
+            // in the input image.
+            const int channels = Pixel::channels(info.pixel);
+            if (Pixel::RGB_U10 == info.pixel)
+            {
+                const Pixel::U10_S * inP = reinterpret_cast<const Pixel::U10_S *>(data->data());
+                Pixel::U10_S * minP = reinterpret_cast<Pixel::U10_S *>(min.data());
+                Pixel::U10_S * maxP = reinterpret_cast<Pixel::U10_S *>(max.data());
+                if (mask[0])
+                    minP->r = maxP->r = inP->r;
+                if (mask[1])
+                    minP->g = maxP->g = inP->g;
+                if (mask[2])
+                    minP->b = maxP->b = inP->b;
+            }
+            else
+            {
+                const quint64 channelByteCount = Pixel::channelByteCount(info.pixel);
+                for (int c = 0; c < channels; ++c)
+                {
+                    if (mask[c])
+                    {
+                        memcpy(min.data() + c * channelByteCount, data->data() + c * channelByteCount, channelByteCount);
+                        memcpy(max.data() + c * channelByteCount, data->data() + c * channelByteCount, channelByteCount);
+                    }
+                }
+            }
+
+            // Iterate over the input pixels counting their values.
+            const int threads = availableThreads(_p->threadCount);
+            std::vector<int> counts(size * outChannels, 0);
+            switch (info.pixel)
+            {
+            case Pixel::RGB_U10:
+                histogramTilesU10(
+                    *data, indexLut, mask, threads, counts,
+                    reinterpret_cast<Pixel::U10_S *>(min.data()),
+                    reinterpret_cast<Pixel::U10_S *>(max.data()));
+                break;
+#define _HISTOGRAM(TYPE) \
+    histogramTiles( \
+        *data, outChannels, indexLut, mask, threads, counts, \
+        reinterpret_cast<Pixel::TYPE *>(min.data()), \
+        reinterpret_cast<Pixel::TYPE *>(max.data()));
+            default:
+                switch (Pixel::type(info.pixel))
+                {
+                case Pixel::U8:  _HISTOGRAM(U8_T);  break;
+                case Pixel::U16: _HISTOGRAM(U16_T); break;
+                case Pixel::F16: _HISTOGRAM(F16_T); break;
+                case Pixel::F32: _HISTOGRAM(F32_T); break;
+                default: break;
+                }
+                break;
+            }
+
+            // Copy the counts to the output, saturating at the maximum value.
+            Pixel::U16_T * outP = reinterpret_cast<Pixel::U16_T *>(out.data());
+            for (size_t i = 0; i < counts.size(); ++i)
+            {
+                outP[i] = Core::Math::min(counts[i], static_cast<int>(Pixel::u16Max));
+            }
+        }
+
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <djvAV/OpenGLImage.h>
+
+#include <memory>
+
+namespace djv
+{
+    namespace AV
+    {
+        //! This class provides CPU image utilities.
+        //!
+        //! The conversions match OpenGLImage::copy() but do not require an
+        //! OpenGL context, so they can be used on machines without a GPU. The
+        //! work is split into tiles of scanlines that are processed in parallel.
+        class CPUImage
+        {
+        public:
+            CPUImage();
+            ~CPUImage();
+
+            //! Get the number of threads used for processing. A value of zero
+            //! uses the number of available cores.
+            int threadCount() const;
+
+            //! Set the number of threads used for processing.
+            void setThreadCount(int);
+
+            //! Copy pixel data.
+            void copy(
+                const PixelData &          input,
+                PixelData &                output,
+                const OpenGLImageOptions & options = OpenGLImageOptions());
+
+            //! Calculate the average color.
+            void average(
+                const PixelData &   input,
+                Color &             output,
+                const Pixel::Mask & mask = Pixel::Mask());
+
+            //! Calculate the histogram.
+            void histogram(
+                const PixelData &   input,
+                PixelData &         output,
+                int                 size,
+                Color &             min,
+                Color &             max,
+                const Pixel::Mask & mask = Pixel::Mask());
+
+        private:
+            struct Private;
+            std::unique_ptr<Private> _p;
+        };
+
+    } // namespace AV
+} // namespace djv
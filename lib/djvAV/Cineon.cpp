@@ -33,6 +33,9 @@
 
 #include <QCoreApplication>
 
+#include <list>
+#include <mutex>
+
 namespace djv
 {
     namespace AV
@@ -49,101 +52,167 @@ namespace djv
             return data;
         }
 
-        PixelData Cineon::linearToFilmPrintLut(const LinearToFilmPrint & value)
+        namespace
         {
-            //DJV_DEBUG("Cineon::linearToFilmPrintLut");
-            //DJV_DEBUG_PRINT("black = " << value.black);
-            //DJV_DEBUG_PRINT("white = " << value.white);
-            //DJV_DEBUG_PRINT("gamma = " << value.gamma);
-            PixelData out(PixelDataInfo(1024, 1, Pixel::L_F32));
-            const int size = out.w();
-            //DJV_DEBUG_PRINT("size = " << size);
-            Pixel::F32_T * data = reinterpret_cast<Pixel::F32_T *>(out.data());
-            const float gain =
-                1.f / (
-                    1.f - Core::Math::pow(
-                        Core::Math::pow(10.f, (value.black - value.white) * .002f / .6f),
-                        value.gamma / 1.7f));
-            const float offset = gain - 1.f;
-            //DJV_DEBUG_PRINT("gain = " << gain * 255);
-            //DJV_DEBUG_PRINT("offset = " << offset * 255);
-            for (int i = 0; i < size; ++i)
-            {
-                data[i] = i / Pixel::F32_T(size - 1);
-            }
-            for (int i = 0; i < size; ++i)
+            //! The number of LUTs to cache. Savers and loaders ask for the same
+            //! LUT for every frame, so only a few are needed.
+            const size_t lutCacheMax = 4;
+
+            std::mutex lutCacheMutex;
+
+            template<typename T>
+            bool lutCacheGet(
+                std::list<std::pair<T, PixelData> > & cache,
+                const T &                              key,
+                PixelData &                            out)
             {
-                data[i] = Pixel::F32_T(
-                    value.white / 1023.f +
-                    Core::Math::log10(
-                        Core::Math::pow((data[i] + offset) / gain, 1.7f / value.gamma)) /
-                        (2.048f / .6f));
-                //DJV_DEBUG_PRINT("lut[" << i << "] = " <<
-                //    data[i] << " " << static_cast<int>(data[i] * 1024));
+                std::lock_guard<std::mutex> lock(lutCacheMutex);
+                for (auto i = cache.begin(); i != cache.end(); ++i)
+                {
+                    if (i->first == key)
+                    {
+                        cache.splice(cache.begin(), cache, i);
+                        out = cache.front().second;
+                        return true;
+                    }
+                }
+                return false;
             }
-            return out;
-        }
 
-        PixelData Cineon::filmPrintToLinearLut(const FilmPrintToLinear & value)
-        {
-            //DJV_DEBUG("Cineon::filmPrintToLinearLut");
-            //DJV_DEBUG_PRINT("black = " << value.black);
-            //DJV_DEBUG_PRINT("white = " << value.white);
-            //DJV_DEBUG_PRINT("gamma = " << value.gamma);
-            //DJV_DEBUG_PRINT("soft clip = " << value.softClip);
-            PixelData out(PixelDataInfo(1024, 1, Pixel::L_F32));
-            const int size = out.w();
-            //DJV_DEBUG_PRINT("size = " << size);
-            Pixel::F32_T * data = reinterpret_cast<Pixel::F32_T *>(out.data());
-            const float gain =
-                1.f / (
-                    1.f - Core::Math::pow(
-                        Core::Math::pow(10.f, (value.black - value.white) * .002f / .6f),
-                        value.gamma / 1.7f));
-            const float offset = gain - 1.f;
-            //DJV_DEBUG_PRINT("gain = " << gain * 255);
-            //DJV_DEBUG_PRINT("offset = " << offset * 255);
-            const int breakPoint = value.white - value.softClip;
-            const float kneeOffset =
-                Core::Math::pow(
-                    Core::Math::pow(10.f, (breakPoint - value.white) * .002f / .6f),
-                    value.gamma / 1.7f
-                ) *
-                gain - offset;
-            const float kneeGain =
-                (
-                (255 - (kneeOffset * 255)) /
-                    Core::Math::pow(5.f * value.softClip, value.softClip / 100.f)
-                    ) / 255.f;
-            //DJV_DEBUG_PRINT("break point = " << breakPoint);
-            //DJV_DEBUG_PRINT("knee offset = " << kneeOffset * 255);
-            //DJV_DEBUG_PRINT("knee gain = " << kneeGain * 255);
-            for (int i = 0; i < size; ++i)
+            template<typename T>
+            void lutCacheAdd(
+                std::list<std::pair<T, PixelData> > & cache,
+                const T &                              key,
+                const PixelData &                      value)
             {
-                data[i] = i / Pixel::F32_T(size - 1);
+                std::lock_guard<std::mutex> lock(lutCacheMutex);
+                cache.push_front(std::make_pair(key, value));
+                while (cache.size() > lutCacheMax)
+                {
+                    cache.pop_back();
+                }
             }
-            for (int i = 0; i < size; ++i)
+
+            PixelData createLinearToFilmPrintLut(const Cineon::LinearToFilmPrint & value)
             {
-                const int tmp = static_cast<int>(data[i] * 1023.f);
-                if (tmp < value.black)
+                //DJV_DEBUG("Cineon::linearToFilmPrintLut");
+                //DJV_DEBUG_PRINT("black = " << value.black);
+                //DJV_DEBUG_PRINT("white = " << value.white);
+                //DJV_DEBUG_PRINT("gamma = " << value.gamma);
+                PixelData out(PixelDataInfo(1024, 1, Pixel::L_F32));
+                const int size = out.w();
+                //DJV_DEBUG_PRINT("size = " << size);
+                Pixel::F32_T * data = reinterpret_cast<Pixel::F32_T *>(out.data());
+                const float gain =
+                    1.f / (
+                        1.f - Core::Math::pow(
+                            Core::Math::pow(10.f, (value.black - value.white) * .002f / .6f),
+                            value.gamma / 1.7f));
+                const float offset = gain - 1.f;
+                //DJV_DEBUG_PRINT("gain = " << gain * 255);
+                //DJV_DEBUG_PRINT("offset = " << offset * 255);
+                for (int i = 0; i < size; ++i)
                 {
-                    data[i] = 0.f;
+                    data[i] = i / Pixel::F32_T(size - 1);
                 }
-                else if (tmp > breakPoint)
+                for (int i = 0; i < size; ++i)
                 {
-                    data[i] = Pixel::F32_T((Core::Math::pow(
-                        static_cast<float>(tmp - breakPoint),
-                        value.softClip / 100.f) *
-                        kneeGain * 255 + kneeOffset * 255) / 255.f);
+                    data[i] = Pixel::F32_T(
+                        value.white / 1023.f +
+                        Core::Math::log10(
+                            Core::Math::pow((data[i] + offset) / gain, 1.7f / value.gamma)) /
+                            (2.048f / .6f));
+                    //DJV_DEBUG_PRINT("lut[" << i << "] = " <<
+                    //    data[i] << " " << static_cast<int>(data[i] * 1024));
                 }
-                else
+                return out;
+            }
+
+            PixelData createFilmPrintToLinearLut(const Cineon::FilmPrintToLinear & value)
+            {
+                //DJV_DEBUG("Cineon::filmPrintToLinearLut");
+                //DJV_DEBUG_PRINT("black = " << value.black);
+                //DJV_DEBUG_PRINT("white = " << value.white);
+                //DJV_DEBUG_PRINT("gamma = " << value.gamma);
+                //DJV_DEBUG_PRINT("soft clip = " << value.softClip);
+                PixelData out(PixelDataInfo(1024, 1, Pixel::L_F32));
+                const int size = out.w();
+                //DJV_DEBUG_PRINT("size = " << size);
+                Pixel::F32_T * data = reinterpret_cast<Pixel::F32_T *>(out.data());
+                const float gain =
+                    1.f / (
+                        1.f - Core::Math::pow(
+                            Core::Math::pow(10.f, (value.black - value.white) * .002f / .6f),
+                            value.gamma / 1.7f));
+                const float offset = gain - 1.f;
+                //DJV_DEBUG_PRINT("gain = " << gain * 255);
+                //DJV_DEBUG_PRINT("offset = " << offset * 255);
+                const int breakPoint = value.white - value.softClip;
+                const float kneeOffset =
+                    Core::Math::pow(
+                        Core::Math::pow(10.f, (breakPoint - value.white) * .002f / .6f),
+                        value.gamma / 1.7f
+                    ) *
+                    gain - offset;
+                const float kneeGain =
+                    (
+                    (255 - (kneeOffset * 255)) /
+                        Core::Math::pow(5.f * value.softClip, value.softClip / 100.f)
+                        ) / 255.f;
+                //DJV_DEBUG_PRINT("break point = " << breakPoint);
+                //DJV_DEBUG_PRINT("knee offset = " << kneeOffset * 255);
+                //DJV_DEBUG_PRINT("knee gain = " << kneeGain * 255);
+                for (int i = 0; i < size; ++i)
+                {
+                    data[i] = i / Pixel::F32_T(size - 1);
+                }
+                for (int i = 0; i < size; ++i)
                 {
-                    data[i] = Pixel::F32_T(Core::Math::pow(
-                        Core::Math::pow(10.f, (tmp - value.white) * .002f / .6f),
-                        value.gamma / 1.7f) * gain - offset);
+                    const int tmp = static_cast<int>(data[i] * 1023.f);
+                    if (tmp < value.black)
+                    {
+                        data[i] = 0.f;
+                    }
+                    else if (tmp > breakPoint)
+                    {
+                        data[i] = Pixel::F32_T((Core::Math::pow(
+                            static_cast<float>(tmp - breakPoint),
+                            value.softClip / 100.f) *
+                            kneeGain * 255 + kneeOffset * 255) / 255.f);
+                    }
+                    else
+                    {
+                        data[i] = Pixel::F32_T(Core::Math::pow(
+                            Core::Math::pow(10.f, (tmp - value.white) * .002f / .6f),
+                            value.gamma / 1.7f) * gain - offset);
+                    }
+                    //DJV_DEBUG_PRINT("lut[" << i << "] = " <<  data[i] << " " << static_cast<int>(data[i] * 255.f));
                 }
-                //DJV_DEBUG_PRINT("lut[" << i << "] = " <<  data[i] << " " << static_cast<int>(data[i] * 255.f));
+                return out;
             }
+
+            std::list<std::pair<Cineon::LinearToFilmPrint, PixelData> > linearToFilmPrintCache;
+            std::list<std::pair<Cineon::FilmPrintToLinear, PixelData> > filmPrintToLinearCache;
+
+        } // namespace
+
+        PixelData Cineon::linearToFilmPrintLut(const LinearToFilmPrint & value)
+        {
+            PixelData out;
+            if (lutCacheGet(linearToFilmPrintCache, value, out))
+                return out;
+            out = createLinearToFilmPrintLut(value);
+            lutCacheAdd(linearToFilmPrintCache, value, out);
+            return out;
+        }
+
+        PixelData Cineon::filmPrintToLinearLut(const FilmPrintToLinear & value)
+        {
+            PixelData out;
+            if (lutCacheGet(filmPrintToLinearCache, value, out))
+                return out;
+            out = createFilmPrintToLinearLut(value);
+            lutCacheAdd(filmPrintToLinearCache, value, out);
             return out;
         }
 
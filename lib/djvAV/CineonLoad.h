@@ -44,15 +44,18 @@ namespace djv
             CineonLoad(const Core::FileInfo &, const Cineon::Options &, const QPointer<Core::CoreContext> &);
             ~CineonLoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
-            void _open(const QString &, IOInfo &, Core::FileIO & io);
+            CineonLoad(const CineonLoad &);
+
+            void _open(const QString &, IOInfo &, Core::FileIO &, bool & filmPrint);
 
             Cineon::Options _options;
             bool            _filmPrint = false;
             PixelData       _filmPrintLut;
-            PixelData       _tmp;
         };
 
     } // namespace AV
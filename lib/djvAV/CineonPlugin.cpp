@@ -59,6 +59,11 @@ namespace djv
             return QStringList() << ".cin";
         }
 
+        bool CineonPlugin::canReadRegion() const
+        {
+            return true;
+        }
+
         QStringList CineonPlugin::option(const QString & in) const
         {
             QStringList out;
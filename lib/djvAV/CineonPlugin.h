@@ -56,6 +56,7 @@ namespace djv
 
             QString pluginName() const override;
             QStringList extensions() const override;
+            bool canReadRegion() const override;
 
             QStringList option(const QString &) const override;
             bool setOption(const QString &, QStringList &) override;
@@ -57,6 +57,16 @@ namespace djv
             //DJV_DEBUG_PRINT("info = " << _info);
 
             _image.set(_info);
+
+            // Set the color profile. This does not change between frames so
+            // the LUT is only created once.
+            if (Cineon::COLOR_PROFILE_FILM_PRINT == _options.outputColorProfile ||
+                Cineon::COLOR_PROFILE_AUTO == _options.outputColorProfile)
+            {
+                //DJV_DEBUG_PRINT("color profile");
+                _colorProfile.type = ColorProfile::LUT;
+                _colorProfile.lut = Cineon::linearToFilmPrintLut(_options.outputFilmPrint);
+            }
         }
 
         CineonSave::~CineonSave()
@@ -68,16 +78,6 @@ namespace djv
             //DJV_DEBUG_PRINT("in = " << in);
             //DJV_DEBUG_PRINT("frame = " << frame);
 
-            // Set the color profile.
-            ColorProfile colorProfile;
-            if (Cineon::COLOR_PROFILE_FILM_PRINT == _options.outputColorProfile ||
-                Cineon::COLOR_PROFILE_AUTO == _options.outputColorProfile)
-            {
-                //DJV_DEBUG_PRINT("color profile");
-                colorProfile.type = ColorProfile::LUT;
-                colorProfile.lut = Cineon::linearToFilmPrintLut(_options.outputFilmPrint);
-            }
-
             // Open the file.
             const QString fileName = _fileInfo.fileName(frame.frame);
             //DJV_DEBUG_PRINT("file name = " << fileName);
@@ -93,13 +93,13 @@ namespace djv
             const PixelData * p = &in;
             if (in.info() != _info ||
                 in.colorProfile.type != ColorProfile::RAW ||
-                colorProfile.type != ColorProfile::RAW)
+                _colorProfile.type != ColorProfile::RAW)
             {
                 //Core::_DEBUG_PRINT("convert = " << _image);
                 _image.zero();
                 OpenGLImageOptions options;
-                options.colorProfile = colorProfile;
-                OpenGLImage().copy(*p, _image, options);
+                options.colorProfile = _colorProfile;
+                openGLImage().copy(*p, _image, options);
                 p = &_image;
             }
 
@@ -54,6 +54,7 @@ namespace djv
             Cineon::Options _options;
             CineonHeader    _header;
             PixelDataInfo   _info;
+            ColorProfile    _colorProfile;
             Image           _image;
         };
 
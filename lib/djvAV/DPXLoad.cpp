@@ -45,7 +45,12 @@ namespace djv
             _options(options)
         {
             Core::FileIO io;
-            _open(_fileInfo.fileName(_fileInfo.sequence().start()), _ioInfo, io);
+            _open(_fileInfo.fileName(_fileInfo.sequence().start()), _ioInfo, io, _filmPrint);
+            if ((Cineon::COLOR_PROFILE_FILM_PRINT == _options.inputColorProfile) ||
+                (Cineon::COLOR_PROFILE_AUTO == _options.inputColorProfile && _filmPrint))
+            {
+                _filmPrintLut = Cineon::filmPrintToLinearLut(_options.inputFilmPrint);
+            }
             if (Core::FileInfo::SEQUENCE == _fileInfo.type())
             {
                 _ioInfo.sequence.frames = _fileInfo.sequence().frames;
@@ -55,17 +60,29 @@ namespace djv
         DPXLoad::~DPXLoad()
         {}
 
-        void DPXLoad::_open(const QString & in, IOInfo & info, Core::FileIO & io)
+        DPXLoad::DPXLoad(const DPXLoad & other) :
+            Load(other),
+            _options(other._options),
+            _filmPrint(other._filmPrint),
+            _filmPrintLut(other._filmPrintLut)
+        {}
+
+        std::unique_ptr<Load> DPXLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new DPXLoad(*this));
+        }
+
+        void DPXLoad::_open(const QString & in, IOInfo & info, Core::FileIO & io, bool & filmPrint)
         {
             //DJV_DEBUG("DPXLoad::_open");
             //DJV_DEBUG_PRINT("in = " << in);
             io.open(in, Core::FileIO::READ);
             info.layers[0].fileName = in;
-            _filmPrint = false;
+            filmPrint = false;
             DPXHeader header;
-            header.load(io, info, _filmPrint);
+            header.load(io, info, filmPrint);
             //DJV_DEBUG_PRINT("info = " << info);
-            //DJV_DEBUG_PRINT("film print = " << _filmPrint);
+            //DJV_DEBUG_PRINT("film print = " << filmPrint);
         }
 
         void DPXLoad::read(Image & image, const ImageIOInfo & frame)
@@ -78,30 +95,42 @@ namespace djv
             //DJV_DEBUG_PRINT("file name = " << fileName);
             IOInfo info;
             QScopedPointer<Core::FileIO> io(new Core::FileIO);
-            _open(fileName, info, *io);
+            bool filmPrint = false;
+            _open(fileName, info, *io, filmPrint);
             image.tags = info.tags;
 
             // Set the color profile.
             if ((Cineon::COLOR_PROFILE_FILM_PRINT == _options.inputColorProfile) ||
-                (Cineon::COLOR_PROFILE_AUTO == _options.inputColorProfile && _filmPrint))
+                (Cineon::COLOR_PROFILE_AUTO == _options.inputColorProfile && filmPrint))
             {
                 //DJV_DEBUG_PRINT("color profile");
                 image.colorProfile.type = ColorProfile::LUT;
-                if (!_filmPrintLut.isValid())
-                {
-                    _filmPrintLut = Cineon::filmPrintToLinearLut(_options.inputFilmPrint);
-                }
-                image.colorProfile.lut = _filmPrintLut;
+                image.colorProfile.lut = _filmPrintLut.isValid() ?
+                    _filmPrintLut :
+                    Cineon::filmPrintToLinearLut(_options.inputFilmPrint);
             }
             else
             {
                 image.colorProfile = ColorProfile();
             }
 
-            // Read the file.
-            io->readAhead();
-            bool mmap = true;
+            // Read the file. When a region or a proxy is requested the file is
+            // not read ahead, so that only the pages that are used are touched.
+            PixelData tmp;
             auto pixelDataInfo = info.layers[0];
+            const Core::Box2i region = Load::region(frame, pixelDataInfo.size);
+            const bool crop = region.size != pixelDataInfo.size;
+            //DJV_DEBUG_PRINT("region = " << region);
+            if (frame.proxy)
+            {
+                Load::readProxy(*io, pixelDataInfo, frame.proxy, image);
+                return;
+            }
+            if (!crop)
+            {
+                io->readAhead();
+            }
+            bool mmap = true;
             if ((io->size() - io->pos()) < PixelDataUtil::dataByteCount(pixelDataInfo))
             {
                 mmap = false;
@@ -109,24 +138,22 @@ namespace djv
             //DJV_DEBUG_PRINT("mmap = " << mmap);
             if (mmap)
             {
-                if (!frame.proxy)
+                if (crop)
                 {
-                    image.set(pixelDataInfo, io->mmapP(), io.data());
-                    io.take();
+                    tmp.set(pixelDataInfo, io->mmapP());
+                    PixelDataUtil::crop(tmp, image, region);
                 }
                 else
                 {
-                    _tmp.set(pixelDataInfo, io->mmapP());
-                    pixelDataInfo.size = PixelDataUtil::proxyScale(pixelDataInfo.size, frame.proxy);
-                    pixelDataInfo.proxy = frame.proxy;
-                    image.set(pixelDataInfo);
-                    PixelDataUtil::proxyScale(_tmp, image, frame.proxy);
+                    image.set(pixelDataInfo, io->mmapP(), io.data());
+                    io.take();
                 }
             }
             else
             {
-                PixelData * data = frame.proxy ? &_tmp : &image;
+                PixelData * data = crop ? &tmp : &image;
                 data->set(pixelDataInfo);
+                data->zero();
                 Core::Error error;
                 bool errorValid = false;
                 try
@@ -143,12 +170,9 @@ namespace djv
                     error = otherError;
                     errorValid = true;
                 }
-                if (frame.proxy)
+                if (crop)
                 {
-                    pixelDataInfo.size = PixelDataUtil::proxyScale(pixelDataInfo.size, frame.proxy);
-                    pixelDataInfo.proxy = frame.proxy;
-                    image.set(pixelDataInfo);
-                    PixelDataUtil::proxyScale(_tmp, image, frame.proxy);
+                    PixelDataUtil::crop(tmp, image, region);
                 }
                 if (errorValid)
                     throw error;
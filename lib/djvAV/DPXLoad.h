@@ -44,15 +44,18 @@ namespace djv
             DPXLoad(const Core::FileInfo &, const DPX::Options &, const QPointer<Core::CoreContext> &);
             ~DPXLoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
-            void _open(const QString &, IOInfo &, Core::FileIO &);
+            DPXLoad(const DPXLoad &);
+
+            void _open(const QString &, IOInfo &, Core::FileIO &, bool & filmPrint);
 
             DPX::Options _options;
             bool         _filmPrint = false;
             PixelData    _filmPrintLut;
-            PixelData    _tmp;
         };
 
     } // namespace AV
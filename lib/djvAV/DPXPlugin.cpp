@@ -56,6 +56,11 @@ namespace djv
             return QStringList() << ".dpx";
         }
 
+        bool DPXPlugin::canReadRegion() const
+        {
+            return true;
+        }
+
         QStringList DPXPlugin::option(const QString & in) const
         {
             QStringList out;
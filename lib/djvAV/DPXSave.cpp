@@ -83,6 +83,16 @@ namespace djv
             //DJV_DEBUG_PRINT("info = " << _info);
 
             _image.set(_info);
+
+            // Set the color profile. This does not change between frames so
+            // the LUT is only created once.
+            if (Cineon::COLOR_PROFILE_FILM_PRINT == _options.outputColorProfile ||
+                Cineon::COLOR_PROFILE_AUTO == _options.outputColorProfile)
+            {
+                //DJV_DEBUG_PRINT("color profile");
+                _colorProfile.type = ColorProfile::LUT;
+                _colorProfile.lut = Cineon::linearToFilmPrintLut(_options.outputFilmPrint);
+            }
         }
 
         DPXSave::~DPXSave()
@@ -93,16 +103,6 @@ namespace djv
             //DJV_DEBUG("DPXSave::write");
             //DJV_DEBUG_PRINT("in = " << in);
 
-            // Set the color profile.
-            ColorProfile colorProfile;
-            if (Cineon::COLOR_PROFILE_FILM_PRINT == _options.outputColorProfile ||
-                Cineon::COLOR_PROFILE_AUTO == _options.outputColorProfile)
-            {
-                //DJV_DEBUG_PRINT("color profile");
-                colorProfile.type = ColorProfile::LUT;
-                colorProfile.lut = Cineon::linearToFilmPrintLut(_options.outputFilmPrint);
-            }
-
             // Open the file.
             const QString fileName = _fileInfo.fileName(frame.frame);
             //DJV_DEBUG_PRINT("file name = " << fileName);
@@ -123,13 +123,13 @@ namespace djv
             const PixelData * p = &in;
             if (in.info() != _info ||
                 in.colorProfile.type != ColorProfile::RAW ||
-                colorProfile.type != ColorProfile::RAW)
+                _colorProfile.type != ColorProfile::RAW)
             {
                 //DJV_DEBUG_PRINT("convert = " << _image);
                 _image.zero();
                 OpenGLImageOptions options;
-                options.colorProfile = colorProfile;
-                OpenGLImage().copy(*p, _image, options);
+                options.colorProfile = _colorProfile;
+                openGLImage().copy(*p, _image, options);
                 p = &_image;
             }
 
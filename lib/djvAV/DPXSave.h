@@ -54,6 +54,7 @@ namespace djv
             DPX::Options  _options;
             DPXHeader     _header;
             PixelDataInfo _info;
+            ColorProfile  _colorProfile;
             Image         _image;
         };
 
@@ -294,6 +294,11 @@ namespace djv
             }
         }
 
+        std::unique_ptr<Load> FFmpegLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new FFmpegLoad(_fileInfo, context()));
+        }
+
         void FFmpegLoad::read(Image & image, const ImageIOInfo & frame)
         {
             //DJV_DEBUG("FFmpegLoad::read");
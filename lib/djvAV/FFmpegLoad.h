@@ -44,6 +44,9 @@ namespace djv
             explicit FFmpegLoad(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             virtual ~FFmpegLoad();
 
+            //! The clone opens its own demuxer and decoder.
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
@@ -53,6 +53,17 @@ namespace djv
         IFFLoad::~IFFLoad()
         {}
 
+        IFFLoad::IFFLoad(const IFFLoad & other) :
+            Load(other),
+            _tiles(other._tiles),
+            _compression(other._compression)
+        {}
+
+        std::unique_ptr<Load> IFFLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new IFFLoad(*this));
+        }
+
         void IFFLoad::read(Image & image, const ImageIOInfo & frame)
         {
             //DJV_DEBUG("IFFLoad::read");
@@ -85,6 +96,7 @@ namespace djv
             io.readAhead();
             PixelData * data = frame.proxy ? &_tmp : &image;
             data->set(info.layers[0]);
+            data->zero();
             tilesRgba = _tiles;
 
             // Read FOR4 <size> TBMP block
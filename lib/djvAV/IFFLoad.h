@@ -46,9 +46,13 @@ namespace djv
             explicit IFFLoad(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             ~IFFLoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
+            IFFLoad(const IFFLoad &);
+
             void _open(const Core::FileInfo &, IOInfo &, Core::FileIO &);
 
             int       _tiles       = 0;
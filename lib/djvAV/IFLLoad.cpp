@@ -84,16 +84,26 @@ namespace djv
             }
             //DJV_DEBUG_PRINT("list = " << _list);
             dynamic_cast<AVContext*>(context.data())->ioFactory()->load(_list.count() ? _list[0] : QString(), _ioInfo);
-            _ioInfo.sequence.frames.resize(_list.count());
-            for (int i = 0; i < _list.count(); ++i)
+            _ioInfo.sequence.frames.clear();
+            if (_list.count())
             {
-                _ioInfo.sequence.frames[i] = i;
+                _ioInfo.sequence.frames = Core::FrameList(0, _list.count() - 1);
             }
         }
 
         IFLLoad::~IFLLoad()
         {}
 
+        IFLLoad::IFLLoad(const IFLLoad & other) :
+            Load(other),
+            _list(other._list)
+        {}
+
+        std::unique_ptr<Load> IFLLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new IFLLoad(*this));
+        }
+
         void IFLLoad::read(Image & image, const ImageIOInfo & frame)
         {
             //DJV_DEBUG("IFLLoad::read");
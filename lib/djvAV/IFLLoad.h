@@ -42,9 +42,13 @@ namespace djv
             explicit IFLLoad(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             ~IFLLoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
+            IFLLoad(const IFLLoad &);
+
             QStringList _list;
         };
 
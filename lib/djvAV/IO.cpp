@@ -30,11 +30,15 @@
 #include <djvAV/IO.h>
 
 #include <djvAV/AVContext.h>
+#include <djvAV/OpenGLImage.h>
+#include <djvAV/PixelDataUtil.h>
 
+#include <djvCore/BoxUtil.h>
 #include <djvCore/CoreContext.h>
 #include <djvCore/Debug.h>
 #include <djvCore/DebugLog.h>
 #include <djvCore/Error.h>
+#include <djvCore/FileIO.h>
 #include <djvCore/FileInfo.h>
 
 #include <QCoreApplication>
@@ -43,6 +47,9 @@
 #include <QPointer>
 
 #include <algorithm>
+#include <vector>
+
+#include <string.h>
 
 namespace djv
 {
@@ -89,7 +96,8 @@ namespace djv
             return
                 frame == other.frame &&
                 layer == other.layer &&
-                proxy == other.proxy;
+                proxy == other.proxy &&
+                region == other.region;
         }
 
         bool ImageIOInfo::operator != (const ImageIOInfo & other) const
@@ -129,9 +137,22 @@ namespace djv
             _p->context = context;
         }
 
+        Load::Load(const Load & other) :
+            _fileInfo(other._fileInfo),
+            _ioInfo(other._ioInfo),
+            _p(new Private)
+        {
+            _p->context = other._p->context;
+        }
+
         Load::~Load()
         {}
 
+        std::unique_ptr<Load> Load::clone() const
+        {
+            return nullptr;
+        }
+
         void Load::read(Image &, const ImageIOInfo &)
         {}
 
@@ -143,9 +164,94 @@ namespace djv
             return _p->context;
         }
 
+        Core::Box2i Load::region(const ImageIOInfo & frame, const glm::ivec2 & size)
+        {
+            const Core::Box2i box(size);
+            if (frame.proxy || !frame.region.isValid())
+                return box;
+            const Core::Box2i out = Core::BoxUtil::intersect(box, frame.region);
+            return out.isValid() ? out : box;
+        }
+
+        void Load::readProxy(
+            Core::FileIO &        io,
+            const PixelDataInfo & info,
+            PixelDataInfo::PROXY  proxy,
+            PixelData &           out)
+        {
+            //DJV_DEBUG("Load::readProxy");
+            //DJV_DEBUG_PRINT("info = " << info);
+            //DJV_DEBUG_PRINT("proxy = " << proxy);
+            PixelDataInfo outInfo = info;
+            outInfo.size = PixelDataUtil::proxyScale(info.size, proxy);
+            outInfo.proxy = proxy;
+            out.set(outInfo);
+
+            const int proxyScale = PixelDataUtil::proxyScale(proxy);
+            const int w = outInfo.size.x;
+            const int h = outInfo.size.y;
+            const quint64 pixelByteCount = out.pixelByteCount();
+            const quint64 inStride = pixelByteCount * proxyScale;
+            const quint64 scanlineByteCount = PixelDataUtil::scanlineByteCount(info);
+            const quint64 rowByteCount = info.size.x * pixelByteCount;
+            const quint64 pos = io.pos();
+            auto copy = [w, pixelByteCount, inStride](const quint8 * inP, quint8 * outP)
+            {
+                for (int x = 0; x < w; ++x, inP += inStride, outP += pixelByteCount)
+                {
+                    memcpy(outP, inP, pixelByteCount);
+                }
+            };
+            if (io.mmapP() && io.size() - pos >= PixelDataUtil::dataByteCount(info))
+            {
+                // Only ask for the pages of the rows that are used, and stop the
+                // operating system from reading the rows in between.
+                io.setRandomAccess();
+                for (int y = 0; y < h; ++y)
+                {
+                    io.readAhead(pos + y * proxyScale * scanlineByteCount, rowByteCount);
+                }
+                const quint8 * p = io.mmapP();
+                for (int y = 0; y < h; ++y)
+                {
+                    copy(p + y * proxyScale * scanlineByteCount, out.data(0, y));
+                }
+            }
+            else
+            {
+                // Keep the rows that could be read from a short file, clear the
+                // rest, and then report the error.
+                std::vector<quint8> row(rowByteCount);
+                Core::Error error;
+                bool errorValid = false;
+                int y = 0;
+                try
+                {
+                    for (; y < h; ++y)
+                    {
+                        io.setPos(pos + y * proxyScale * scanlineByteCount);
+                        io.get(row.data(), rowByteCount);
+                        copy(row.data(), out.data(0, y));
+                    }
+                }
+                catch (const Core::Error & otherError)
+                {
+                    error = otherError;
+                    errorValid = true;
+                }
+                for (; y < h; ++y)
+                {
+                    memset(out.data(0, y), 0, w * pixelByteCount);
+                }
+                if (errorValid)
+                    throw error;
+            }
+        }
+
         struct Save::Private
         {
             QPointer<Core::CoreContext> context;
+            std::unique_ptr<OpenGLImage> openGLImage;
         };
 
         Save::Save(const Core::FileInfo & fileInfo, const IOInfo & ioInfo, const QPointer<Core::CoreContext> & context) :
@@ -165,6 +271,15 @@ namespace djv
         void Save::close()
         {}
 
+        OpenGLImage & Save::openGLImage()
+        {
+            if (!_p->openGLImage)
+            {
+                _p->openGLImage.reset(new OpenGLImage);
+            }
+            return *_p->openGLImage;
+        }
+
         const QPointer<Core::CoreContext> & Save::context() const
         {
             return _p->context;
@@ -187,6 +302,11 @@ namespace djv
             return true;
         }
 
+        bool IOPlugin::canReadRegion() const
+        {
+            return false;
+        }
+
         QStringList IOPlugin::option(const QString &) const
         {
             return QStringList();
@@ -220,6 +340,16 @@ namespace djv
             return nullptr;
         }
 
+        QVariantMap IOPlugin::pluginManifest() const
+        {
+            QVariantMap out;
+            out["extensions"] = extensions();
+            out["isSequence"] = isSequence();
+            out["canReadRegion"] = canReadRegion();
+            out["options"] = options();
+            return out;
+        }
+
         const QStringList & IOPlugin::errorLabels()
         {
             static const QStringList data = QStringList() <<
@@ -234,12 +364,13 @@ namespace djv
 
         struct IOFactory::Private
         {
-            // This map is used to lookup an I/O plugin by it's name.
-            QMap<QString, IOPlugin *> nameMap;
+            // This map is used to lookup an I/O plugin name by it's lower case
+            // name.
+            QMap<QString, QString> nameMap;
 
-            // This map is used to lookup an I/O plugin for a given file
+            // This map is used to lookup an I/O plugin name for a given file
             // extension.
-            QMap<QString, IOPlugin *> extensionMap;
+            QMap<QString, QString> extensionMap;
         };
 
         IOFactory::IOFactory(
@@ -250,13 +381,9 @@ namespace djv
             _p(new Private)
         {
             //DJV_DEBUG("IOFactory::IOFactory");
-            const QList<Core::Plugin *> & plugins = this->plugins();
-            Q_FOREACH(Core::Plugin * plugin, plugins)
+            Q_FOREACH(const QString & name, names())
             {
-                if (auto ioPlugin = dynamic_cast<IOPlugin *>(plugin))
-                {
-                    _addPlugin(ioPlugin);
-                }
+                _addPlugin(name);
             }
         }
 
@@ -267,13 +394,11 @@ namespace djv
 
         QStringList IOFactory::option(const QString & name,  const QString & option) const
         {
-            const QString nameLower = name.toLower();
-            if (_p->nameMap.contains(nameLower))
+            if (auto ioPlugin = _plugin(_p->nameMap, name.toLower()))
             {
                 //DJV_DEBUG("IOFactory::option");
                 //DJV_DEBUG_PRINT("name   = " << name);
                 //DJV_DEBUG_PRINT("option = " << option);
-                auto ioPlugin = _p->nameMap[nameLower];
                 return ioPlugin->option(option);
             }
             return QStringList();
@@ -281,14 +406,12 @@ namespace djv
 
         bool IOFactory::setOption(const QString & name, const QString & option, QStringList & data)
         {
-            const QString nameLower = name.toLower();
-            if (_p->nameMap.contains(nameLower))
+            if (auto ioPlugin = _plugin(_p->nameMap, name.toLower()))
             {
                 //DJV_DEBUG("djvIOFactory::setOption");
                 //DJV_DEBUG_PRINT("name   = " << name);
                 //DJV_DEBUG_PRINT("option = " << option);
                 //DJV_DEBUG_PRINT("data   = " << data);
-                auto ioPlugin = _p->nameMap[nameLower];
                 return ioPlugin->setOption(option, data);
             }
             return false;
@@ -299,10 +422,8 @@ namespace djv
             //DJV_DEBUG("IOFactory::load");
             //DJV_DEBUG_PRINT("fileInfo = " << fileInfo);
             //DJV_LOG("IOFactory", QString("Loading: \"%1\"...").arg(fileInfo));
-            const QString extensionLower = fileInfo.extension().toLower();
-            if (_p->extensionMap.contains(extensionLower))
+            if (auto ioPlugin = _plugin(_p->extensionMap, fileInfo.extension().toLower()))
             {
-                auto ioPlugin = _p->extensionMap[extensionLower];
                 //DJV_LOG("IOFactory", QString("Using plugin: \"%1\"").arg(ioPlugin->pluginName()));
                 if (auto load = ioPlugin->createLoad(fileInfo))
                 {
@@ -329,10 +450,8 @@ namespace djv
             //tmp.clear();
             //tmp << ioInfo.pixel;
             //DJV_LOG("IOFactory", QString("Pixel: %1").arg(tmp.join(", ")));
-            const QString extensionLower = fileInfo.extension().toLower();
-            if (_p->extensionMap.contains(extensionLower))
+            if (auto ioPlugin = _plugin(_p->extensionMap, fileInfo.extension().toLower()))
             {
-                auto ioPlugin = _p->extensionMap[extensionLower];
                 //DJV_LOG("IOFactory", QString("Using plugin: \"%1\"").arg(ioPlugin->pluginName()));
                 if (auto save = ioPlugin->createSave(fileInfo, ioInfo))
                 {
@@ -346,6 +465,14 @@ namespace djv
             return nullptr;
         }
 
+        bool IOFactory::canReadRegion(const Core::FileInfo & fileInfo) const
+        {
+            const auto i = _p->extensionMap.find(fileInfo.extension().toLower());
+            return i != _p->extensionMap.end() ?
+                pluginManifest(i.value())["canReadRegion"].toBool() :
+                false;
+        }
+
         const QStringList & IOFactory::errorLabels()
         {
             static const QStringList data = QStringList() <<
@@ -357,9 +484,21 @@ namespace djv
         void IOFactory::addPlugin(Core::Plugin * plugin)
         {
             Core::PluginFactory::addPlugin(plugin);
+            if (dynamic_cast<IOPlugin *>(plugin))
+            {
+                _addPlugin(plugin->pluginName());
+            }
+        }
+
+        void IOFactory::pluginInit(Core::Plugin * plugin) const
+        {
+            // This callback listens to option changes in the I/O plugins.
             if (auto ioPlugin = dynamic_cast<IOPlugin *>(plugin))
             {
-                _addPlugin(ioPlugin);
+                connect(
+                    ioPlugin,
+                    SIGNAL(optionChanged(const QString &)),
+                    SLOT(pluginOptionCallback(const QString &)));
             }
         }
 
@@ -368,12 +507,15 @@ namespace djv
             Q_EMIT optionChanged();
         }
 
-        void IOFactory::_addPlugin(IOPlugin * plugin)
+        void IOFactory::_addPlugin(const QString & name)
         {
+            const QVariantMap manifest = pluginManifest(name);
+            const QStringList extensions = manifest["extensions"].toStringList();
+
             // Register file sequence extensions.
-            if (plugin->isSequence())
+            if (manifest["isSequence"].toBool())
             {
-                Q_FOREACH(const QString & extension, plugin->extensions())
+                Q_FOREACH(const QString & extension, extensions)
                 {
                     Core::FileInfo::sequenceExtensions.insert(extension.toLower());
                     Core::FileInfo::sequenceExtensions.insert(extension.toUpper());
@@ -381,17 +523,17 @@ namespace djv
             }
 
             // Setup internal maps.
-            _p->nameMap[plugin->pluginName().toLower()] = plugin;
-            Q_FOREACH(const QString & extension, plugin->extensions())
+            _p->nameMap[name.toLower()] = name;
+            Q_FOREACH(const QString & extension, extensions)
             {
-                _p->extensionMap[extension.toLower()] = plugin;
+                _p->extensionMap[extension.toLower()] = name;
             }
+        }
 
-            // This callback listens to option changes in the I/O plugins.
-            connect(
-                plugin,
-                SIGNAL(optionChanged(const QString &)),
-                SLOT(pluginOptionCallback(const QString &)));
+        IOPlugin * IOFactory::_plugin(const QMap<QString, QString> & map, const QString & key) const
+        {
+            const auto i = map.find(key);
+            return i != map.end() ? dynamic_cast<IOPlugin *>(plugin(i.value())) : nullptr;
         }
 
     } // namespace AV
@@ -33,6 +33,7 @@
 #include <djvAV/PixelData.h>
 #include <djvAV/Tags.h>
 
+#include <djvCore/Box.h>
 #include <djvCore/FileInfo.h>
 #include <djvCore/Plugin.h>
 #include <djvCore/Sequence.h>
@@ -54,12 +55,14 @@ namespace djv
     namespace Core
     {
         class CoreContext;
+        class FileIO;
 
     } // namespace Core
 
     namespace AV
     {
         class Image;
+        class OpenGLImage;
 
         //! This struct provides I/O information.
         struct IOInfo
@@ -77,6 +80,12 @@ namespace djv
         };
 
         //! This struct provides image I/O information.
+        //!
+        //! The region is an optional part of the image to read, given in pixel
+        //! data coordinates (the same coordinates as PixelData::data(x, y)). It
+        //! is only used by plugins that support regions (see
+        //! IOPlugin::canReadRegion()), and it is ignored when a proxy is
+        //! requested. An empty region reads the whole image.
         struct ImageIOInfo
         {
             ImageIOInfo();
@@ -88,6 +97,7 @@ namespace djv
             qint64 frame = -1;
             size_t layer = 0;
             PixelDataInfo::PROXY proxy = PixelDataInfo::PROXY_NONE;
+            Core::Box2i region;
 
             bool operator == (const ImageIOInfo &) const;
             bool operator != (const ImageIOInfo &) const;
@@ -108,7 +118,11 @@ namespace djv
 
         //! This class provides the base functionality for loading media.
         //!
-        //! Note that loaders may be run in a separate thread.
+        //! Note that loaders may be run in a separate thread, but a loader is
+        //! not safe to share between threads. To read from multiple threads
+        //! create a loader for each thread with clone(); clones share the
+        //! information parsed when the file was opened but have their own
+        //! scratch buffers and decoder state.
         class Load
         {
         public:
@@ -117,6 +131,14 @@ namespace djv
             explicit Load(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             virtual ~Load() = 0;
 
+            //! Create a loader for the same file that can be used concurrently
+            //! with this one. Returns nullptr if concurrent reads are not
+            //! supported.
+            //!
+            //! Throws:
+            //! - Core::Error
+            virtual std::unique_ptr<Load> clone() const;
+
             //! Get the file information.
             const Core::FileInfo & fileInfo() const { return _fileInfo; }
 
@@ -139,10 +161,34 @@ namespace djv
             const QPointer<Core::CoreContext> & context() const;
 
         protected:
+            //! Copy the file and I/O information, for use by clone().
+            Load(const Load &);
+
+            //! Get the region of an image with the given size to read. The
+            //! requested region is clamped to the image, and the whole image
+            //! is returned when no region or a proxy is requested.
+            static Core::Box2i region(const ImageIOInfo &, const glm::ivec2 &);
+
+            //! Read a proxy image from uncompressed pixel data starting at the
+            //! current file position. Only the rows that are used by the proxy
+            //! are read, and the pixels are copied directly to the output at
+            //! the proxy stride. If the file is too short the rows that were read
+            //! are kept, the others are cleared, and an error is thrown.
+            //!
+            //! Throws:
+            //! - Core::Error
+            static void readProxy(
+                Core::FileIO &,
+                const PixelDataInfo &,
+                PixelDataInfo::PROXY,
+                PixelData &);
+
             Core::FileInfo _fileInfo;
             IOInfo _ioInfo;
 
         private:
+            Load & operator = (const Load &) = delete;
+
             struct Private;
             std::unique_ptr<Private> _p;
         };
@@ -178,6 +224,12 @@ namespace djv
             const QPointer<Core::CoreContext> & context() const;
 
         protected:
+            //! Get the OpenGL image used to convert images before they are
+            //! written. It is created on first use and kept for the lifetime
+            //! of the saver, so that the conversion resources are reused
+            //! between frames.
+            OpenGLImage & openGLImage();
+
             Core::FileInfo _fileInfo;
             IOInfo _ioInfo;
 
@@ -201,6 +253,11 @@ namespace djv
             //! Does the plugin use file sequences?
             virtual bool isSequence() const;
 
+            //! Can the plugin's loaders read a region of an image? Formats with
+            //! random access to scanlines only read the rows and columns in
+            //! the region.
+            virtual bool canReadRegion() const;
+
             //! Get an option.
             virtual QStringList option(const QString &) const;
 
@@ -225,6 +282,11 @@ namespace djv
             //! Get a saver.
             virtual std::unique_ptr<Save> createSave(const Core::FileInfo &, const IOInfo &) const;
 
+            //! Get the plugin manifest information: the extensions, whether the
+            //! plugin uses file sequences, whether it can read regions, and the
+            //! list of options.
+            QVariantMap pluginManifest() const override;
+
             //! This enumeration provides error codes.
             enum ERROR
             {
@@ -246,6 +308,11 @@ namespace djv
         };
 
         //! This class provides a factory for I/O plugins.
+        //!
+        //! File extensions are resolved to plugins using the plugin manifest
+        //! information, so a plugin is only loaded and initialized the first
+        //! time a file is loaded or saved with it, or one of its options is
+        //! used.
         class IOFactory : public Core::PluginFactory
         {
             Q_OBJECT
@@ -275,6 +342,10 @@ namespace djv
             //! - Core::Error
             std::unique_ptr<Save> save(const Core::FileInfo &, const IOInfo &) const;
 
+            //! Get whether the loaders for a file can read a region of an
+            //! image. This does not load the plugin.
+            bool canReadRegion(const Core::FileInfo &) const;
+
             //! This enumeration provides error codes.
             enum ERROR
             {
@@ -288,6 +359,9 @@ namespace djv
 
             void addPlugin(Core::Plugin *) override;
 
+        protected:
+            void pluginInit(Core::Plugin *) const override;
+
         Q_SIGNALS:
             //! This signal is emitted when a plugin option is changed.
             void optionChanged();
@@ -298,7 +372,8 @@ namespace djv
         private:
             DJV_PRIVATE_COPY(IOFactory);
 
-            void _addPlugin(IOPlugin *);
+            void _addPlugin(const QString &);
+            IOPlugin * _plugin(const QMap<QString, QString> &, const QString &) const;
 
             struct Private;
             std::unique_ptr<Private> _p;
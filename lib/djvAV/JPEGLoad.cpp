@@ -55,6 +55,15 @@ namespace djv
             _close();
         }
 
+        JPEGLoad::JPEGLoad(const JPEGLoad & other) :
+            Load(other)
+        {}
+
+        std::unique_ptr<Load> JPEGLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new JPEGLoad(*this));
+        }
+
         namespace
         {
             bool jpegScanline(
@@ -107,6 +116,7 @@ namespace djv
             PixelData * data = frame.proxy ? &_tmp : &image;
             auto pixelDataInfo = info.layers[0];
             data->set(pixelDataInfo);
+            data->zero();
             for (int y = 0; y < pixelDataInfo.size.y; ++y)
             {
                 if (!jpegScanline(
@@ -44,9 +44,13 @@ namespace djv
             explicit JPEGLoad(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             ~JPEGLoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
+            JPEGLoad(const JPEGLoad &);
+
             void _open(const QString &, IOInfo &);
             void _close();
 
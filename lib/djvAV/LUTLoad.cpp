@@ -55,6 +55,17 @@ namespace djv
         LUTLoad::~LUTLoad()
         {}
 
+        LUTLoad::LUTLoad(const LUTLoad & other) :
+            Load(other),
+            _options(other._options),
+            _format(other._format)
+        {}
+
+        std::unique_ptr<Load> LUTLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new LUTLoad(*this));
+        }
+
         void LUTLoad::read(Image & image, const ImageIOInfo & frame)
         {
             //DJV_DEBUG("LUTLoad::read");
@@ -72,6 +83,7 @@ namespace djv
             // Read the file.
             auto pixelDataInfo = info.layers[0];
             image.set(pixelDataInfo);
+            image.zero();
             switch (_format)
             {
             case LUT::FORMAT_INFERNO:
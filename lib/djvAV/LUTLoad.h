@@ -44,9 +44,13 @@ namespace djv
             LUTLoad(const Core::FileInfo &, const LUT::Options &, const QPointer<Core::CoreContext> &);
             ~LUTLoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &)  override;
 
         private:
+            LUTLoad(const LUTLoad &);
+
             void _open(const Core::FileInfo &, IOInfo &, Core::FileIO &);
 
             LUT::Options _options;
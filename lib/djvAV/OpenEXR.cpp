@@ -104,6 +104,25 @@ namespace djv
             return data;
         }
 
+        const QStringList & OpenEXR::storageLabels()
+        {
+            static const QStringList data = QStringList() <<
+                qApp->translate("djv::AV::OpenEXR", "Scanline") <<
+                qApp->translate("djv::AV::OpenEXR", "Tile") <<
+                qApp->translate("djv::AV::OpenEXR", "Mipmap");
+            DJV_ASSERT(data.count() == STORAGE_COUNT);
+            return data;
+        }
+
+        const QStringList & OpenEXR::roundingLabels()
+        {
+            static const QStringList data = QStringList() <<
+                qApp->translate("djv::AV::OpenEXR", "Down") <<
+                qApp->translate("djv::AV::OpenEXR", "Up");
+            DJV_ASSERT(data.count() == ROUNDING_COUNT);
+            return data;
+        }
+
         const QStringList & OpenEXR::channelsLabels()
         {
             static const QStringList data = QStringList() <<
@@ -672,7 +691,10 @@ namespace djv
                 qApp->translate("djv::AV::OpenEXR", "Input Gamma") <<
                 qApp->translate("djv::AV::OpenEXR", "Input Exposure") <<
                 qApp->translate("djv::AV::OpenEXR", "Channels") <<
-                qApp->translate("djv::AV::OpenEXR", "Compression")
+                qApp->translate("djv::AV::OpenEXR", "Compression") <<
+                qApp->translate("djv::AV::OpenEXR", "Storage") <<
+                qApp->translate("djv::AV::OpenEXR", "Tile Size") <<
+                qApp->translate("djv::AV::OpenEXR", "Rounding")
 #if OPENEXR_VERSION_HEX >= 0x02020000
                 << qApp->translate("djv::AV::OpenEXR", "DWA Compression Level");
 #endif // OPENEXR_VERSION_HEX
@@ -686,6 +708,8 @@ namespace djv
     _DJV_STRING_OPERATOR_LABEL(AV::OpenEXR::COLOR_PROFILE, AV::OpenEXR::colorProfileLabels());
     _DJV_STRING_OPERATOR_LABEL(AV::OpenEXR::COMPRESSION, AV::OpenEXR::compressionLabels());
     _DJV_STRING_OPERATOR_LABEL(AV::OpenEXR::CHANNELS, AV::OpenEXR::channelsLabels());
+    _DJV_STRING_OPERATOR_LABEL(AV::OpenEXR::STORAGE, AV::OpenEXR::storageLabels());
+    _DJV_STRING_OPERATOR_LABEL(AV::OpenEXR::ROUNDING, AV::OpenEXR::roundingLabels());
 
     bool compare(const std::vector<Imf::Channel> & in)
     {
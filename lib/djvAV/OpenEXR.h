@@ -111,6 +111,33 @@ namespace djv
             //! Get the compression labels.
             static const QStringList & compressionLabels();
 
+            //! This enumeration provides how images are stored in the file.
+            //! Mipmapped files let the loader read proxy resolutions directly.
+            enum STORAGE
+            {
+                STORAGE_SCANLINE,
+                STORAGE_TILE,
+                STORAGE_MIPMAP,
+
+                STORAGE_COUNT
+            };
+
+            //! Get the storage labels.
+            static const QStringList & storageLabels();
+
+            //! This enumeration provides how mipmap level sizes are rounded.
+            //! Rounding up matches the proxy image sizes.
+            enum ROUNDING
+            {
+                ROUNDING_DOWN,
+                ROUNDING_UP,
+
+                ROUNDING_COUNT
+            };
+
+            //! Get the rounding labels.
+            static const QStringList & roundingLabels();
+
             //! This enumeration provides the channels.
             enum CHANNELS
             {
@@ -189,6 +216,9 @@ namespace djv
                 INPUT_EXPOSURE_OPTION,
                 CHANNELS_OPTION,
                 COMPRESSION_OPTION,
+                STORAGE_OPTION,
+                TILE_SIZE_OPTION,
+                ROUNDING_OPTION,
 #if OPENEXR_VERSION_HEX >= 0x02020000
                 DWA_COMPRESSION_LEVEL_OPTION,
 #endif // OPENEXR_VERSION_HEX
@@ -209,6 +239,9 @@ namespace djv
                 ColorProfile::Exposure inputExposure;
                 OpenEXR::CHANNELS      channels            = OpenEXR::CHANNELS_GROUP_KNOWN;
                 OpenEXR::COMPRESSION   compression         = OpenEXR::COMPRESSION_NONE;
+                OpenEXR::STORAGE       storage             = OpenEXR::STORAGE_SCANLINE;
+                int                    tileSize            = 64;
+                OpenEXR::ROUNDING      rounding            = OpenEXR::ROUNDING_UP;
 #if OPENEXR_VERSION_HEX >= 0x02020000
                 float                  dwaCompressionLevel = 45.f;
 #endif // OPENEXR_VERSION_HEX
@@ -220,6 +253,8 @@ namespace djv
     DJV_STRING_OPERATOR(AV::OpenEXR::COLOR_PROFILE);
     DJV_STRING_OPERATOR(AV::OpenEXR::COMPRESSION);
     DJV_STRING_OPERATOR(AV::OpenEXR::CHANNELS);
+    DJV_STRING_OPERATOR(AV::OpenEXR::STORAGE);
+    DJV_STRING_OPERATOR(AV::OpenEXR::ROUNDING);
 
     bool compare(const std::vector<Imf::Channel> &);
 
@@ -41,6 +41,7 @@
 #include <ImfHeader.h>
 #include <ImfInputFile.h>
 #include <ImfRgbaYca.h>
+#include <ImfTiledInputFile.h>
 
 #include <algorithm>
 
@@ -122,6 +123,22 @@ namespace djv
             _close();
         }
 
+        OpenEXRLoad::OpenEXRLoad(const OpenEXRLoad & other) :
+            Load(other),
+            _options(other._options),
+            _displayWindow(other._displayWindow),
+            _dataWindow(other._dataWindow),
+            _intersectedWindow(other._intersectedWindow),
+            _layers(other._layers),
+            _fast(other._fast),
+            _mipmap(other._mipmap)
+        {}
+
+        std::unique_ptr<Load> OpenEXRLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new OpenEXRLoad(*this));
+        }
+
         void OpenEXRLoad::read(Image & image, const ImageIOInfo & frame)
         {
             //DJV_DEBUG("OpenEXRLoad::read");
@@ -171,43 +188,142 @@ namespace djv
                     image.colorProfile = ColorProfile();
                 }
 
-                // Read the file.
-                PixelData * data = frame.proxy ? &_tmp : &image;
-                data->set(pixelDataInfo);
+                // Read the file. Proxy images are read directly from a mipmap
+                // level when the file has one with the proxy size.
+                if (_readMipmap(image, pixelDataInfo, frame))
+                {
+                    _close();
+                    return;
+                }
                 const int channels = Pixel::channels(pixelDataInfo.pixel);
                 const int byteCount = Pixel::channelByteCount(pixelDataInfo.pixel);
                 //DJV_DEBUG_PRINT("channels = " << channels);
                 //DJV_DEBUG_PRINT("byteCount = " << byteCount);
                 const int cb = channels * byteCount;
-                const int scb = pixelDataInfo.size.x * channels * byteCount;
-                //DJV_DEBUG_PRINT("fast = " << _fast);
-                if (_fast)
+                bool sampled = false;
+                for (int c = 0; c < channels; ++c)
+                {
+                    const glm::ivec2 & sampling = _layers[frame.layer].channels[c].sampling;
+                    if (sampling.x != 1 || sampling.y != 1)
+                    {
+                        sampled = true;
+                    }
+                }
+
+                // Only the scanlines and columns in the region are read. Layers
+                // with subsampled channels are read in full and cropped.
+                const Core::Box2i region = Load::region(frame, pixelDataInfo.size);
+                const bool crop = region.size != pixelDataInfo.size;
+                //DJV_DEBUG_PRINT("region = " << region);
+                const Core::Box2i displayWindow = crop && !sampled ?
+                    Core::Box2i(_displayWindow.position + region.position, region.size) :
+                    _displayWindow;
+                const Core::Box2i window = crop && !sampled ?
+                    Core::BoxUtil::intersect(displayWindow, _dataWindow) :
+                    _intersectedWindow;
+                PixelDataInfo dataInfo = pixelDataInfo;
+                dataInfo.size = displayWindow.size;
+                PixelData * data = (frame.proxy || (crop && sampled)) ? &_tmp : &image;
+                data->set(dataInfo);
+                const int scb = dataInfo.size.x * cb;
+                const bool overlap =
+                    window.size.x > 0 &&
+                    window.size.y > 0 &&
+                    window.x >= displayWindow.x &&
+                    window.y >= displayWindow.y &&
+                    window.x + window.size.x <= displayWindow.x + displayWindow.size.x &&
+                    window.y + window.size.y <= displayWindow.y + displayWindow.size.y;
+                //DJV_DEBUG_PRINT("window = " << window);
+                //DJV_DEBUG_PRINT("overlap = " << overlap);
+                //DJV_DEBUG_PRINT("sampled = " << sampled);
+                if (!overlap)
+                {
+                    data->zero();
+                }
+                else if (!sampled)
                 {
+                    // Zero the borders around the intersection of the data and
+                    // display windows.
+                    const int x0 = window.x - displayWindow.x;
+                    const int x1 = x0 + window.size.x;
+                    const int y0 = window.y - displayWindow.y;
+                    const int y1 = y0 + window.size.y;
+                    if (window != displayWindow)
+                    {
+                        for (int y = 0; y < dataInfo.size.y; ++y)
+                        {
+                            quint8 * p = data->data() + y * scb;
+                            if (y < y0 || y >= y1)
+                            {
+                                memset(p, 0, scb);
+                            }
+                            else
+                            {
+                                memset(p, 0, x0 * cb);
+                                memset(p + x1 * cb, 0, (dataInfo.size.x - x1) * cb);
+                            }
+                        }
+                    }
+
+                    // Read the intersection with a single call so that OpenEXR can
+                    // decode multi-line blocks and use its thread pool. The pixels
+                    // are read directly into the image unless the data window is
+                    // wider than the display window (or the region), in which case
+                    // they are read into a temporary buffer with the width of the
+                    // data window.
+                    const bool direct =
+                        _dataWindow.x >= displayWindow.x &&
+                        _dataWindow.x + _dataWindow.size.x <= displayWindow.x + displayWindow.size.x;
+                    //DJV_DEBUG_PRINT("direct = " << direct);
+                    std::vector<char> buf;
+                    char * base = nullptr;
+                    size_t yStride = 0;
+                    if (direct)
+                    {
+                        yStride = scb;
+                        base = reinterpret_cast<char *>(data->data()) -
+                            displayWindow.x * cb -
+                            displayWindow.y * yStride;
+                    }
+                    else
+                    {
+                        yStride = _dataWindow.size.x * cb;
+                        buf.resize(window.size.y * yStride);
+                        base = buf.data() -
+                            _dataWindow.x * cb -
+                            window.y * yStride;
+                    }
                     Imf::FrameBuffer frameBuffer;
                     for (int c = 0; c < channels; ++c)
                     {
                         const QString & channel = _layers[frame.layer].channels[c].name;
                         //DJV_DEBUG_PRINT("channel = " << channel);
-                        const glm::ivec2 sampling = _layers[frame.layer].channels[c].sampling;
-                        //DJV_DEBUG_PRINT("sampling = " << sampling);
                         frameBuffer.insert(
                             channel.toUtf8().data(),
                             Imf::Slice(
                                 OpenEXR::pixelTypeToImf(Pixel::type(data->pixel())),
-                                (char *)data->data() + (c * byteCount),
+                                base + (c * byteCount),
                                 cb,
-                                scb,
-                                sampling.x,
-                                sampling.y,
+                                yStride,
+                                1,
+                                1,
                                 0.f));
                     }
                     _f->setFrameBuffer(frameBuffer);
-                    _f->readPixels(
-                        _displayWindow.y,
-                        _displayWindow.y + _displayWindow.size.y - 1);
+                    _f->readPixels(window.y, window.y + window.size.y - 1);
+                    if (!direct)
+                    {
+                        const size_t size = window.size.x * cb;
+                        const char * p = buf.data() + (window.x - _dataWindow.x) * cb;
+                        for (int y = y0; y < y1; ++y, p += yStride)
+                        {
+                            memcpy(data->data() + y * scb + x0 * cb, p, size);
+                        }
+                    }
                 }
                 else
                 {
+                    // Subsampled channels are read one scanline at a time.
                     Imf::FrameBuffer frameBuffer;
                     std::vector<char> buf(_dataWindow.size.x * cb);
                     for (int c = 0; c < channels; ++c)
@@ -260,6 +376,10 @@ namespace djv
                     image.set(pixelDataInfo);
                     PixelDataUtil::proxyScale(_tmp, image, frame.proxy);
                 }
+                else if (crop && sampled)
+                {
+                    PixelDataUtil::crop(_tmp, image, region);
+                }
             }
             catch (const std::exception & error)
             {
@@ -292,6 +412,10 @@ namespace djv
                 //DJV_DEBUG_PRINT("data window = " << _dataWindow);
                 //DJV_DEBUG_PRINT("intersected window = " << _intersectedWindow);
                 _fast = _displayWindow == _dataWindow;
+                _mipmap =
+                    _f->header().hasTileDescription() &&
+                    Imf::MIPMAP_LEVELS == _f->header().tileDescription().mode;
+                //DJV_DEBUG_PRINT("mipmap = " << _mipmap);
 
                 // Get the layers.
                 _layers = OpenEXR::layer(_f->header().channels(), _options.channels);
@@ -343,6 +467,68 @@ namespace djv
             }
         }
 
+        bool OpenEXRLoad::_readMipmap(Image & image, PixelDataInfo info, const ImageIOInfo & frame)
+        {
+            //DJV_DEBUG("OpenEXRLoad::_readMipmap");
+            //DJV_DEBUG_PRINT("proxy = " << frame.proxy);
+            if (!frame.proxy || !_mipmap || !_fast)
+                return false;
+            const int channels = Pixel::channels(info.pixel);
+            for (int c = 0; c < channels; ++c)
+            {
+                const glm::ivec2 & sampling = _layers[frame.layer].channels[c].sampling;
+                if (sampling.x != 1 || sampling.y != 1)
+                    return false;
+            }
+
+            // Find the level that matches the proxy size. Levels rounded down
+            // may be a pixel smaller than the proxy image, in which case the
+            // full resolution image is read and scaled instead.
+            _s->seekg(0);
+            Imf::TiledInputFile f(*_s.get());
+            const int proxyScale = PixelDataUtil::proxyScale(frame.proxy);
+            int level = 0;
+            while ((2 << level) <= proxyScale)
+            {
+                ++level;
+            }
+            //DJV_DEBUG_PRINT("level = " << level);
+            if (level >= f.numLevels())
+                return false;
+            const glm::ivec2 size = PixelDataUtil::proxyScale(info.size, frame.proxy);
+            if (f.levelWidth(level) != size.x || f.levelHeight(level) != size.y)
+                return false;
+
+            // Read the level.
+            info.size = size;
+            info.proxy = frame.proxy;
+            image.set(info);
+            const int byteCount = Pixel::channelByteCount(info.pixel);
+            const int cb = channels * byteCount;
+            const int scb = size.x * cb;
+            const Core::Box2i window = OpenEXR::imfToBox(f.dataWindowForLevel(level));
+            char * base = reinterpret_cast<char *>(image.data()) -
+                window.x * cb -
+                window.y * static_cast<size_t>(scb);
+            Imf::FrameBuffer frameBuffer;
+            for (int c = 0; c < channels; ++c)
+            {
+                frameBuffer.insert(
+                    _layers[frame.layer].channels[c].name.toUtf8().data(),
+                    Imf::Slice(
+                        OpenEXR::pixelTypeToImf(Pixel::type(info.pixel)),
+                        base + c * byteCount,
+                        cb,
+                        scb,
+                        1,
+                        1,
+                        0.f));
+            }
+            f.setFrameBuffer(frameBuffer);
+            f.readTiles(0, f.numXTiles(level) - 1, 0, f.numYTiles(level) - 1, level);
+            return true;
+        }
+
         void OpenEXRLoad::_close()
         {
             _f.reset(nullptr);
@@ -67,10 +67,15 @@ namespace djv
             OpenEXRLoad(const Core::FileInfo &, const OpenEXR::Options &, const QPointer<Core::CoreContext> &);
             ~OpenEXRLoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
+            OpenEXRLoad(const OpenEXRLoad &);
+
             void _open(const QString &, IOInfo &);
+            bool _readMipmap(Image &, PixelDataInfo, const ImageIOInfo &);
             void _close();
 
             OpenEXR::Options                     _options;
@@ -82,6 +87,7 @@ namespace djv
             std::vector<OpenEXR::Layer>          _layers;
             PixelData                            _tmp;
             bool                                 _fast = false;
+            bool                                 _mipmap = false;
         };
 
     } // namespace AV
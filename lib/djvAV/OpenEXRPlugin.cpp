@@ -86,6 +86,11 @@ namespace djv
             return QStringList() << ".exr";
         }
 
+        bool OpenEXRPlugin::canReadRegion() const
+        {
+            return true;
+        }
+
         QStringList OpenEXRPlugin::option(const QString & in) const
         {
             QStringList out;
@@ -117,6 +122,18 @@ namespace djv
             {
                 out << _options.compression;
             }
+            else if (0 == in.compare(options()[OpenEXR::STORAGE_OPTION], Qt::CaseInsensitive))
+            {
+                out << _options.storage;
+            }
+            else if (0 == in.compare(options()[OpenEXR::TILE_SIZE_OPTION], Qt::CaseInsensitive))
+            {
+                out << _options.tileSize;
+            }
+            else if (0 == in.compare(options()[OpenEXR::ROUNDING_OPTION], Qt::CaseInsensitive))
+            {
+                out << _options.rounding;
+            }
 #if OPENEXR_VERSION_HEX >= 0x02020000
             else if (0 == in.compare(options()[OpenEXR::DWA_COMPRESSION_LEVEL_OPTION], Qt::CaseInsensitive))
             {
@@ -205,6 +222,36 @@ namespace djv
                         Q_EMIT optionChanged(in);
                     }
                 }
+                else if (0 == in.compare(options()[OpenEXR::STORAGE_OPTION], Qt::CaseInsensitive))
+                {
+                    OpenEXR::STORAGE storage = static_cast<OpenEXR::STORAGE>(0);
+                    data >> storage;
+                    if (storage != _options.storage)
+                    {
+                        _options.storage = storage;
+                        Q_EMIT optionChanged(in);
+                    }
+                }
+                else if (0 == in.compare(options()[OpenEXR::TILE_SIZE_OPTION], Qt::CaseInsensitive))
+                {
+                    int tileSize = 0;
+                    data >> tileSize;
+                    if (tileSize != _options.tileSize)
+                    {
+                        _options.tileSize = tileSize;
+                        Q_EMIT optionChanged(in);
+                    }
+                }
+                else if (0 == in.compare(options()[OpenEXR::ROUNDING_OPTION], Qt::CaseInsensitive))
+                {
+                    OpenEXR::ROUNDING rounding = static_cast<OpenEXR::ROUNDING>(0);
+                    data >> rounding;
+                    if (rounding != _options.rounding)
+                    {
+                        _options.rounding = rounding;
+                        Q_EMIT optionChanged(in);
+                    }
+                }
 #if OPENEXR_VERSION_HEX >= 0x02020000
                 else if (0 == in.compare(options()[OpenEXR::DWA_COMPRESSION_LEVEL_OPTION], Qt::CaseInsensitive))
                 {
@@ -276,6 +323,21 @@ namespace djv
                     {
                         in >> _options.compression;
                     }
+                    else if (
+                        qApp->translate("djv::AV::OpenEXRPlugin", "-exr_storage") == arg)
+                    {
+                        in >> _options.storage;
+                    }
+                    else if (
+                        qApp->translate("djv::AV::OpenEXRPlugin", "-exr_tile_size") == arg)
+                    {
+                        in >> _options.tileSize;
+                    }
+                    else if (
+                        qApp->translate("djv::AV::OpenEXRPlugin", "-exr_rounding") == arg)
+                    {
+                        in >> _options.rounding;
+                    }
 #if OPENEXR_VERSION_HEX >= 0x02020000
                     else if (
                         qApp->translate("djv::AV::OpenEXRPlugin", "-exr_dwa_compression_level") == arg)
@@ -312,6 +374,10 @@ namespace djv
             channelsLabel << _options.channels;
             QStringList compressionLabel;
             compressionLabel << _options.compression;
+            QStringList storageLabel;
+            storageLabel << _options.storage;
+            QStringList roundingLabel;
+            roundingLabel << _options.rounding;
             return qApp->translate("djv::AV::OpenEXRPlugin",
                 "\n"
                 "OpenEXR Options\n"
@@ -335,10 +401,19 @@ namespace djv
                 "    -exr_compression (value)\n"
                 "        Set the file compression used when saving OpenEXR images: "
                 "%9. Default = %10.\n"
+                "    -exr_storage (value)\n"
+                "        Set how images are stored when saving OpenEXR images: "
+                "%11. Default = %12.\n"
+                "    -exr_tile_size (value)\n"
+                "        Set the tile size used when saving tiled OpenEXR images. "
+                "Default = %13.\n"
+                "    -exr_rounding (value)\n"
+                "        Set how mipmap level sizes are rounded when saving OpenEXR images: "
+                "%14. Default = %15.\n"
 #if OPENEXR_VERSION_HEX >= 0x02020000
                 "    -exr_dwa_compression_level (value)\n"
                 "        Set the DWA compression level used when saving OpenEXR images. "
-                "Default = %11.\n"
+                "Default = %16.\n"
 #endif // OPENEXR_VERSION_HEX
             ).
                 arg(threadsEnableLabel.join(", ")).
@@ -350,7 +425,12 @@ namespace djv
                 arg(OpenEXR::channelsLabels().join(", ")).
                 arg(channelsLabel.join(", ")).
                 arg(OpenEXR::compressionLabels().join(", ")).
-                arg(compressionLabel.join(", "))
+                arg(compressionLabel.join(", ")).
+                arg(OpenEXR::storageLabels().join(", ")).
+                arg(storageLabel.join(", ")).
+                arg(_options.tileSize).
+                arg(OpenEXR::roundingLabels().join(", ")).
+                arg(roundingLabel.join(", "))
 #if OPENEXR_VERSION_HEX >= 0x02020000
                 .
                 arg(_options.dwaCompressionLevel)
@@ -61,6 +61,7 @@ namespace djv
             void releasePlugin() override;
             QString pluginName() const override;
             QStringList extensions() const override;
+            bool canReadRegion() const override;
 
             QStringList option(const QString &) const override;
             bool setOption(const QString &, QStringList &) override;
@@ -33,12 +33,14 @@
 
 #include <djvCore/CoreContext.h>
 #include <djvCore/Error.h>
+#include <djvCore/Math.h>
 
 #include <ImfChannelList.h>
 #include <ImfCompressionAttribute.h>
 #include <ImfHeader.h>
 #include <ImfOutputFile.h>
 #include <ImfStandardAttributes.h>
+#include <ImfTiledOutputFile.h>
 
 namespace djv
 {
@@ -100,33 +102,40 @@ namespace djv
                 {
                     //DJV_DEBUG_PRINT("convert = " << _tmp);
                     _tmp.zero();
-                    OpenGLImage().copy(in, _tmp);
+                    openGLImage().copy(in, _tmp);
                     p = &_tmp;
                 }
 
                 // Write the file.
-                const int w = p->w();
-                const int h = p->h();
-                const int channels = p->channels();
-                const int byteCount = Pixel::channelByteCount(p->pixel());
-                Imf::FrameBuffer frameBuffer;
-                for (int c = 0; c < channels; ++c)
+                if (_tiledF)
                 {
-                    const QString & channel = _channels[c];
-                    //DJV_DEBUG_PRINT("channel = " << channel);
-                    frameBuffer.insert(
-                        channel.toUtf8().data(),
-                        Imf::Slice(
-                            OpenEXR::pixelTypeToImf(Pixel::type(p->pixel())),
-                            (char *)p->data() + c * byteCount,
-                            channels * byteCount,
-                            w * channels * byteCount,
-                            1,
-                            1,
-                            0.f));
+                    _writeTiles(*p);
+                }
+                else
+                {
+                    const int w = p->w();
+                    const int h = p->h();
+                    const int channels = p->channels();
+                    const int byteCount = Pixel::channelByteCount(p->pixel());
+                    Imf::FrameBuffer frameBuffer;
+                    for (int c = 0; c < channels; ++c)
+                    {
+                        const QString & channel = _channels[c];
+                        //DJV_DEBUG_PRINT("channel = " << channel);
+                        frameBuffer.insert(
+                            channel.toUtf8().data(),
+                            Imf::Slice(
+                                OpenEXR::pixelTypeToImf(Pixel::type(p->pixel())),
+                                (char *)p->data() + c * byteCount,
+                                channels * byteCount,
+                                w * channels * byteCount,
+                                1,
+                                1,
+                                0.f));
+                    }
+                    _f->setFrameBuffer(frameBuffer);
+                    _f->writePixels(h);
                 }
-                _f->setFrameBuffer(frameBuffer);
-                _f->writePixels(h);
 
             }
             catch (const std::exception & error)
@@ -139,6 +148,60 @@ namespace djv
             _close();
         }
 
+        void OpenEXRSave::_writeTiles(const PixelData & in)
+        {
+            //DJV_DEBUG("OpenEXRSave::_writeTiles");
+            //DJV_DEBUG_PRINT("levels = " << _tiledF->numLevels());
+            const int channels = in.channels();
+            const int byteCount = Pixel::channelByteCount(in.pixel());
+            const Imf::PixelType pixelType = OpenEXR::pixelTypeToImf(Pixel::type(in.pixel()));
+            for (int level = 0; level < _tiledF->numLevels(); ++level)
+            {
+                // Scale the image down to the size of the level. The first
+                // level is the full resolution image.
+                const PixelData * p = &in;
+                const glm::ivec2 levelSize(
+                    _tiledF->levelWidth(level),
+                    _tiledF->levelHeight(level));
+                //DJV_DEBUG_PRINT("level size = " << levelSize);
+                if (levelSize != in.size())
+                {
+                    PixelDataInfo info(_info);
+                    info.size = levelSize;
+                    _levelTmp.set(info);
+                    _levelTmp.zero();
+                    OpenGLImageOptions options;
+                    options.xform.scale = glm::vec2(
+                        levelSize.x / static_cast<float>(in.w()),
+                        levelSize.y / static_cast<float>(in.h()));
+                    options.filter = OpenGLImageFilter::filterHighQuality();
+                    openGLImage().copy(in, _levelTmp, options);
+                    p = &_levelTmp;
+                }
+
+                // Write the tiles.
+                Imf::FrameBuffer frameBuffer;
+                for (int c = 0; c < channels; ++c)
+                {
+                    frameBuffer.insert(
+                        _channels[c].toUtf8().data(),
+                        Imf::Slice(
+                            pixelType,
+                            (char *)p->data() + c * byteCount,
+                            channels * byteCount,
+                            p->w() * channels * byteCount,
+                            1,
+                            1,
+                            0.f));
+                }
+                _tiledF->setFrameBuffer(frameBuffer);
+                _tiledF->writeTiles(
+                    0, _tiledF->numXTiles(level) - 1,
+                    0, _tiledF->numYTiles(level) - 1,
+                    level);
+            }
+        }
+
         void OpenEXRSave::_open(const QString & in, const IOInfo & info)
         {
             //DJV_DEBUG("OpenEXRSave::_open");
@@ -207,7 +270,24 @@ namespace djv
                 OpenEXR::saveTags(info, header);
 
                 // Open the file.
-                _f = new Imf::OutputFile(in.toUtf8().data(), header);
+                switch (_options.storage)
+                {
+                case OpenEXR::STORAGE_TILE:
+                case OpenEXR::STORAGE_MIPMAP:
+                {
+                    const int tileSize = Core::Math::max(1, _options.tileSize);
+                    header.setTileDescription(Imf::TileDescription(
+                        tileSize,
+                        tileSize,
+                        OpenEXR::STORAGE_MIPMAP == _options.storage ? Imf::MIPMAP_LEVELS : Imf::ONE_LEVEL,
+                        OpenEXR::ROUNDING_UP == _options.rounding ? Imf::ROUND_UP : Imf::ROUND_DOWN));
+                    _tiledF = new Imf::TiledOutputFile(in.toUtf8().data(), header);
+                    break;
+                }
+                default:
+                    _f = new Imf::OutputFile(in.toUtf8().data(), header);
+                    break;
+                }
 
             }
             catch (const std::exception & error)
@@ -222,6 +302,8 @@ namespace djv
         {
             delete _f;
             _f = nullptr;
+            delete _tiledF;
+            _tiledF = nullptr;
         }
 
     } // namespace AV
@@ -36,6 +36,7 @@
 #include <djvCore/FileInfo.h>
 
 #include <ImfOutputFile.h>
+#include <ImfTiledOutputFile.h>
 
 namespace djv
 {
@@ -51,14 +52,17 @@ namespace djv
 
         private:
             void _open(const QString &, const IOInfo &);
+            void _writeTiles(const PixelData &);
             void _close();
 
-            OpenEXR::Options  _options;
-            Imf::OutputFile * _f = nullptr;
-            PixelDataInfo     _info;
-            QStringList       _channels;
-            Core::Speed       _speed;
-            PixelData         _tmp;
+            OpenEXR::Options       _options;
+            Imf::OutputFile *      _f = nullptr;
+            Imf::TiledOutputFile * _tiledF = nullptr;
+            PixelDataInfo          _info;
+            QStringList            _channels;
+            Core::Speed            _speed;
+            PixelData              _tmp;
+            PixelData              _levelTmp;
         };
 
     } // namespace AV
@@ -29,6 +29,7 @@
 
 #include <djvAV/OpenGLImage.h>
 
+#include <djvAV/CPUImage.h>
 #include <djvAV/ColorUtil.h>
 #include <djvAV/OpenGLImagePrivate.h>
 #include <djvAV/OpenGLOffscreenBuffer.h>
@@ -207,6 +208,31 @@ namespace djv
             _filter = filter;
         }
 
+        const QStringList & OpenGLImageBackend::backendLabels()
+        {
+            static const QStringList data = QStringList() <<
+                qApp->translate("djv::AV::OpenGLImageBackend", "OpenGL") <<
+                qApp->translate("djv::AV::OpenGLImageBackend", "CPU");
+            DJV_ASSERT(data.count() == BACKEND_COUNT);
+            return data;
+        }
+
+        namespace
+        {
+            OpenGLImageBackend::BACKEND _backend = OpenGLImageBackend::OPENGL;
+
+        } // namespace
+
+        OpenGLImageBackend::BACKEND OpenGLImageBackend::backend()
+        {
+            return _backend;
+        }
+
+        void OpenGLImageBackend::setBackend(BACKEND backend)
+        {
+            _backend = backend;
+        }
+
         const QStringList & OpenGLImageOptions::channelLabels()
         {
             static const QStringList data = QStringList() <<
@@ -219,18 +245,17 @@ namespace djv
             return data;
         }
 
+        namespace
+        {
+            std::function<void()> _contextCallback;
+
+        } // namespace
+
         OpenGLImage::OpenGLImage() :
             _p(new Private)
         {
-            _p->texture.reset(new OpenGLTexture);
-            _p->shader.reset(new OpenGLShader);
-            _p->scaleXContrib.reset(new OpenGLTexture);
-            _p->scaleYContrib.reset(new OpenGLTexture);
-            _p->scaleXShader.reset(new OpenGLShader);
-            _p->scaleYShader.reset(new OpenGLShader);
             _p->lutColorProfile.reset(new OpenGLLUT);
             _p->lutDisplayProfile.reset(new OpenGLLUT);
-            _p->mesh.reset(new OpenGLImageMesh);
         }
 
         OpenGLImage::~OpenGLImage()
@@ -268,6 +293,17 @@ namespace djv
             //DJV_DEBUG_PRINT("output = " << output);
             //DJV_DEBUG_PRINT("scale = " << options.xform.scale);
 
+            if (OpenGLImageBackend::CPU == OpenGLImageBackend::backend())
+            {
+                if (!_p->cpuImage)
+                {
+                    _p->cpuImage.reset(new CPUImage);
+                }
+                _p->cpuImage->copy(input, output, options);
+                return;
+            }
+
+            _initContext();
             auto glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
 
             if (!_p->buffer || (_p->buffer && _p->buffer->info() != output.info()))
@@ -323,6 +359,37 @@ namespace djv
             }
         }
 
+        const QStringList & OpenGLImage::errorLabels()
+        {
+            static const QStringList data = QStringList() <<
+                qApp->translate("djv::AV::OpenGLImage", "Cannot create texture") <<
+                qApp->translate("djv::AV::OpenGLImage", "Cannot initialize texture") <<
+                qApp->translate("djv::AV::OpenGLImage", "No OpenGL context available");
+            DJV_ASSERT(ERROR_COUNT == data.count());
+            return data;
+        }
+
+        void OpenGLImage::setContextCallback(const std::function<void()> & value)
+        {
+            _contextCallback = value;
+        }
+
+        void OpenGLImage::_initContext()
+        {
+            if (QOpenGLContext::currentContext())
+                return;
+            if (_contextCallback)
+            {
+                _contextCallback();
+            }
+            if (!QOpenGLContext::currentContext())
+            {
+                throw Core::Error(
+                    "djv::AV::OpenGLImage",
+                    errorLabels()[ERROR_NO_CONTEXT]);
+            }
+        }
+
         void OpenGLImage::stateUnpack(const PixelDataInfo & in, const glm::ivec2 & offset)
         {
             auto glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
@@ -348,98 +415,11 @@ namespace djv
             Color &             out,
             const Pixel::Mask & mask)
         {
-            //DJV_DEBUG("average");
-            //DJV_DEBUG_PRINT("in = " << in);
-
-            out.setPixel(in.pixel());
-
-            const int   w = in.w();
-            const int   h = in.h();
-            const float area = w * h;
-            const int   channels = Pixel::channels(in.pixel());
-            switch (Pixel::type(in.pixel()))
+            if (!_p->cpuImage)
             {
-#define _AVERAGE(TYPE) \
-    const Pixel::TYPE * p = reinterpret_cast<const Pixel::TYPE *>(in.data()); \
-    float accum [Pixel::channelsMax]; \
-    for (int c = 0; c < channels; ++c) \
-    { \
-        accum[c] = 0.f; \
-    } \
-    for (int y = 0; y < h; ++y) \
-    { \
-        for (int x = 0; x < w; ++x, p += channels) \
-        { \
-            for (int c = 0; c < channels; ++c) \
-            { \
-                if (mask[c]) \
-                { \
-                    accum[c] += p[c] / area; \
-                } \
-            } \
-        } \
-    }
-            case Pixel::U8:
-            {
-                _AVERAGE(U8_T)
-                    for (int c = 0; c < channels; ++c)
-                    {
-                        out.setU8(int(accum[c]), c);
-                    }
-            }
-            break;
-            case Pixel::U16:
-            {
-                _AVERAGE(U16_T)
-                    for (int c = 0; c < channels; ++c)
-                    {
-                        out.setU16(int(accum[c]), c);
-                    }
+                _p->cpuImage.reset(new CPUImage);
             }
-            break;
-            case Pixel::F16:
-            {
-                _AVERAGE(F16_T)
-                    for (int c = 0; c < channels; ++c)
-                    {
-                        out.setF16(static_cast<Pixel::F16_T>(accum[c]), c);
-                    }
-            }
-            break;
-            case Pixel::F32:
-            {
-                _AVERAGE(F32_T)
-                    for (int c = 0; c < channels; ++c)
-                    {
-                        out.setF32(static_cast<Pixel::F32_T>(accum[c]), c);
-                    }
-            }
-            break;
-            case Pixel::U10:
-            {
-                const Pixel::U10_S * p = reinterpret_cast <const Pixel::U10_S *> (in.data());
-                float accum[3] = { 0.f, 0.f, 0.f };
-                for (int y = 0; y < h; ++y)
-                {
-                    for (int x = 0; x < w; ++x, ++p)
-                    {
-                        if (mask[0])
-                            accum[0] += p->r / area;
-                        if (mask[1])
-                            accum[1] += p->g / area;
-                        if (mask[2])
-                            accum[2] += p->b / area;
-                    }
-                }
-                for (int c = 0; c < 3; ++c)
-                {
-                    out.setU10(static_cast<int>(accum[c]), c);
-                }
-            }
-            break;
-            default: break;
-            }
-            //DJV_DEBUG_PRINT("out = " << out);
+            _p->cpuImage->average(in, out, mask);
         }
 
         void OpenGLImage::histogram(
@@ -450,206 +430,11 @@ namespace djv
             Color &             max,
             const Pixel::Mask & mask)
         {
-            //DJV_DEBUG("histogram");
-            //DJV_DEBUG_PRINT("in = " << in);
-            //DJV_DEBUG_PRINT("size = " << size);
-
-            // Create the output data using a pixel type of U16.
-            Pixel::PIXEL pixel = static_cast<Pixel::PIXEL>(0);
-            switch (in.channels())
+            if (!_p->cpuImage)
             {
-            case 4:
-            case 3: pixel = Pixel::RGB_U16; break;
-            case 2:
-            case 1: pixel = Pixel::L_U16;   break;
-            default: break;
+                _p->cpuImage.reset(new CPUImage);
             }
-
-            const int outChannels = Pixel::channels(pixel);
-            out.set(PixelDataInfo(size, 1, pixel));
-            out.zero();
-            //DJV_DEBUG_PRINT("out = " << out);
-
-            // We may need to convert the input data if it's in a weird format so
-            // that we can work directly with the pixels.
-            const PixelData * data = &in;
-            PixelData tmp;
-            PixelDataInfo info(in.size(), in.pixel());
-            if (in.info() != info)
-            {
-                //DJV_DEBUG_PRINT("convert");
-                copy(in, tmp);
-                data = &tmp;
-            }
-
-            min = Color(info.pixel);
-            max = Color(info.pixel);
-
-            // Create a LUT for mapping input pixel values to the output data
-            // pixel indexes.
-            const int indexLutSize = Pixel::RGB_U10 == info.pixel ? 1024 : (Pixel::u16Max + 1);
-            //DJV_DEBUG_PRINT("index lut size = " << indexLutSize);    
-            int * indexLut = new int[indexLutSize];
-            for (int i = 0; i < indexLutSize; ++i)
-            {
-                indexLut[i] = Core::Math::floor(
-                    i / static_cast<float>(indexLutSize - 1) * (size - 1));
-            }
-
-            // Iterate over the input pixels counting their values.    
-            const int w = info.size.x;
-            const int h = info.size.y;
-            const int channels = Pixel::channels(info.pixel);
-            const int pixelMax = Pixel::u16Max;
-            switch (info.pixel)
-            {
-            case Pixel::RGB_U10:
-            {
-                // Setup data pointers.
-                const Pixel::U10_S * inP = reinterpret_cast<const Pixel::U10_S *>(data->data());
-                const Pixel::U10_S * const end = inP + w * h;
-                Pixel::U16_T * const outP = reinterpret_cast<Pixel::U16_T *>(out.data());
-                Pixel::U10_S * const minP = reinterpret_cast<Pixel::U10_S *>(min.data());
-                Pixel::U10_S * const maxP = reinterpret_cast<Pixel::U10_S *>(max.data());
-
-                // Initialize the minimum and maximum values with the first pixel
-                // in the input image.            
-                if (w && h)
-                {
-                    if (mask[0])
-                        minP->r = maxP->r = inP->r;
-                    if (mask[1])
-                        minP->g = maxP->g = inP->g;
-                    if (mask[2])
-                        minP->b = maxP->b = inP->b;
-                }
-
-                // Go...
-                for (; inP < end; ++inP)
-                {
-                    int i = 0;
-                    if (mask[0])
-                    {
-                        i = indexLut[inP->r] * outChannels + 0;
-                        outP[i] = Core::Math::min(outP[i] + 1, pixelMax);
-                        minP->r = Core::Math::min(inP->r, minP->r);
-                        maxP->r = Core::Math::max(inP->r, maxP->r);
-                    }
-                    if (mask[1])
-                    {
-                        i = indexLut[inP->g] * outChannels + 1;
-                        outP[i] = Core::Math::min(outP[i] + 1, pixelMax);
-                        minP->g = Core::Math::min(inP->g, minP->g);
-                        maxP->g = Core::Math::max(inP->g, maxP->g);
-                    }
-                    if (mask[2])
-                    {
-                        i = indexLut[inP->b] * outChannels + 2;
-                        outP[i] = Core::Math::min(outP[i] + 1, pixelMax);
-                        minP->b = Core::Math::min(inP->b, minP->b);
-                        maxP->b = Core::Math::max(inP->b, maxP->b);
-                    }
-                }
-            }
-            break;
-#define _HISTOGRAM(TYPE) \
-    const Pixel::TYPE##_T * inP = reinterpret_cast<const Pixel::TYPE##_T *>(data->data()); \
-    const Pixel::TYPE##_T * const end = inP + w * h * channels; \
-    Pixel::U16_T * const outP = reinterpret_cast<Pixel::U16_T *>(out.data()); \
-    Pixel::TYPE##_T * const minP = reinterpret_cast<Pixel::TYPE##_T *>(min.data()); \
-    Pixel::TYPE##_T * const maxP = reinterpret_cast<Pixel::TYPE##_T *>(max.data()); \
-    if (w && h) \
-    { \
-        for (int c = 0; c < channels; ++c) \
-        { \
-            if (mask[c]) \
-            { \
-                minP[c] = maxP[c] = inP[c]; \
-            } \
-        } \
-    } \
-    for (; inP < end; inP += channels) \
-    { \
-        int i = 0; \
-        switch (outChannels) \
-        { \
-            case 4: \
-                if (mask[3]) \
-                { \
-                    minP[3] = Core::Math::min(inP[3], minP[3]); \
-                    maxP[3] = Core::Math::max(inP[3], maxP[3]); \
-                } \
-            case 3: \
-                if (mask[2]) \
-                { \
-                    i = indexLut[PIXEL_##TYPE##_TO_U16(inP[2])] * outChannels + 2; \
-                    outP[i] = Core::Math::min(outP[i] + 1, pixelMax); \
-                    \
-                    minP[2] = Core::Math::min(inP[2], minP[2]); \
-                    maxP[2] = Core::Math::max(inP[2], maxP[2]); \
-                } \
-            \
-            case 2: \
-                if (mask[1]) \
-                { \
-                    i = indexLut[PIXEL_##TYPE##_TO_U16(inP[1])] * outChannels + 1; \
-                    outP[i] = Core::Math::min(outP[i] + 1, pixelMax); \
-                    minP[1] = Core::Math::min(inP[1], minP[1]); \
-                    maxP[1] = Core::Math::max(inP[1], maxP[1]); \
-                } \
-            case 1: \
-                if (mask[0]) \
-                { \
-                    i = indexLut[PIXEL_##TYPE##_TO_U16(inP[0])] * outChannels + 0; \
-                    outP[i] = Core::Math::min(outP[i] + 1, pixelMax); \
-                    minP[0] = Core::Math::min(inP[0], minP[0]); \
-                    maxP[0] = Core::Math::max(inP[0], maxP[0]); \
-                } \
-                break; \
-        } \
-    }
-            case Pixel::L_U8:
-            case Pixel::LA_U8:
-            case Pixel::RGB_U8:
-            case Pixel::RGBA_U8:
-            {
-                _HISTOGRAM(U8);
-            }
-            break;
-            case Pixel::L_U16:
-            case Pixel::LA_U16:
-            case Pixel::RGB_U16:
-            case Pixel::RGBA_U16:
-            {
-                _HISTOGRAM(U16);
-            }
-            break;
-            case Pixel::L_F16:
-            case Pixel::LA_F16:
-            case Pixel::RGB_F16:
-            case Pixel::RGBA_F16:
-            {
-                _HISTOGRAM(F16);
-            }
-            break;
-            case Pixel::L_F32:
-            case Pixel::LA_F32:
-            case Pixel::RGB_F32:
-            case Pixel::RGBA_F32:
-            {
-                _HISTOGRAM(F32);
-            }
-            break;
-            default: break;
-            }
-            //DJV_DEBUG_PRINT("min = " << min);
-            //DJV_DEBUG_PRINT("max = " << max);
-
-            delete[] indexLut;
-
-            //Core::Pixel::U16_T * const outP = reinterpret_cast<Core::Pixel::U16_T *>(out.data());
-            //for (int i = 0; i < size; ++i)
-            //    DJV_DEBUG_PRINT(i << " = " << outP[i * 3]);
+            _p->cpuImage->histogram(in, out, size, min, max, mask);
         }
 
         QPixmap OpenGLImage::toQt(
@@ -859,6 +644,9 @@ namespace djv
     _DJV_STRING_OPERATOR_LABEL(
         AV::OpenGLImageFilter::FILTER,
         AV::OpenGLImageFilter::filterLabels());
+    _DJV_STRING_OPERATOR_LABEL(
+        AV::OpenGLImageBackend::BACKEND,
+        AV::OpenGLImageBackend::backendLabels());
     _DJV_STRING_OPERATOR_LABEL(
         AV::OpenGLImageOptions::CHANNEL,
         AV::OpenGLImageOptions::channelLabels());
@@ -904,6 +692,13 @@ namespace djv
         return debug << tmp;
     }
 
+    Core::Debug & operator << (Core::Debug & debug, const AV::OpenGLImageBackend::BACKEND & in)
+    {
+        QStringList tmp;
+        tmp << in;
+        return debug << tmp;
+    }
+
     Core::Debug & operator << (Core::Debug & debug, const AV::OpenGLImageOptions & in)
     {
         return debug << "xform = [" << in.xform << "], premultiplied alpha = " << in.premultipliedAlpha <<
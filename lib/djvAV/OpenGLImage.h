@@ -40,6 +40,8 @@
 
 #include <QMetaType>
 
+#include <functional>
+
 class QPixmap;
 
 #if defined DJV_WINDOWS
@@ -157,6 +159,32 @@ namespace djv
             static void setFilter(const OpenGLImageFilter &);
         };
 
+        //! This class provides OpenGL image processing backend options.
+        class OpenGLImageBackend
+        {
+            Q_GADGET
+
+        public:
+            //! This enumeration provides the image processing backends.
+            enum BACKEND
+            {
+                OPENGL,
+                CPU,
+
+                BACKEND_COUNT
+            };
+            Q_ENUM(BACKEND);
+
+            //! Get the image processing backend labels.
+            static const QStringList & backendLabels();
+
+            //! Get the global image processing backend.
+            static BACKEND backend();
+
+            //! Set the global image processing backend.
+            static void setBackend(BACKEND);
+        };
+
         //! This class provides OpenGL image options.
         class OpenGLImageOptions
         {
@@ -221,7 +249,18 @@ namespace djv
                 const OpenGLImageOptions & options = OpenGLImageOptions(),
                 Pixel::FORMAT              outputFormat = Pixel::RGBA);
 
-            //! Copy pixel data.
+            //! Stage pixel data that is expected to be drawn next, so that it is
+            //! uploaded while the current image is displayed. This does nothing
+            //! if a texture for the pixel data has not been allocated yet. The
+            //! pixel data must not be changed or freed until it is drawn.
+            //!
+            //! Throws:
+            //! - Core::Error
+            void stage(const PixelData &);
+
+            //! Copy pixel data. When the global backend is set to
+            //! OpenGLImageBackend::CPU the copy is done with CPUImage and
+            //! no OpenGL context is required.
             //!
             //! Throws:
             //! - Core::Error
@@ -240,7 +279,7 @@ namespace djv
                 const PixelDataInfo & info,
                 const glm::ivec2 &    offset = glm::ivec2(0, 0));
 
-            //! Calculate the average color.
+            //! Calculate the average color. This uses CPUImage::average().
             //!
             //! \todo Use a GPU implementation.
             //!
@@ -251,7 +290,7 @@ namespace djv
                 Color &             output,
                 const Pixel::Mask & mask = Pixel::Mask());
 
-            //! Calculate the histogram.
+            //! Calculate the histogram. This uses CPUImage::histogram().
             //!
             //! \todo Use a GPU implementation.
             //!
@@ -275,6 +314,7 @@ namespace djv
             {
                 ERROR_CREATE_TEXTURE,
                 ERROR_CREATE_TEXTURE2,
+                ERROR_NO_CONTEXT,
 
                 ERROR_COUNT
             };
@@ -282,7 +322,18 @@ namespace djv
             //! Get the error code labels.
             static const QStringList & errorLabels();
 
+            //! Set the callback used to make an OpenGL context current when an
+            //! image operation needs one and none is current. AVContext uses
+            //! this to create its OpenGL context on first use.
+            static void setContextCallback(const std::function<void()> &);
+
         private:
+            //! Make sure there is a current OpenGL context.
+            //!
+            //! Throws:
+            //! - Core::Error
+            static void _initContext();
+
             struct Private;
             std::unique_ptr<Private> _p;
         };
@@ -301,6 +352,7 @@ namespace djv
     DJV_STRING_OPERATOR(AV::OpenGLImageLevels);
     DJV_STRING_OPERATOR(AV::OpenGLImageFilter);
     DJV_STRING_OPERATOR(AV::OpenGLImageFilter::FILTER);
+    DJV_STRING_OPERATOR(AV::OpenGLImageBackend::BACKEND);
     DJV_STRING_OPERATOR(AV::OpenGLImageOptions::CHANNEL);
 
     DJV_DEBUG_OPERATOR(AV::OpenGLImageXform);
@@ -309,6 +361,7 @@ namespace djv
     DJV_DEBUG_OPERATOR(AV::OpenGLImageDisplayProfile);
     DJV_DEBUG_OPERATOR(AV::OpenGLImageFilter);
     DJV_DEBUG_OPERATOR(AV::OpenGLImageFilter::FILTER);
+    DJV_DEBUG_OPERATOR(AV::OpenGLImageBackend::BACKEND);
     DJV_DEBUG_OPERATOR(AV::OpenGLImageOptions);
     DJV_DEBUG_OPERATOR(AV::OpenGLImageOptions::CHANNEL);
 
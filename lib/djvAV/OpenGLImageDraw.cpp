@@ -337,80 +337,90 @@ namespace djv
                 return Core::Math::clamp(in, 0, size - 1);
             }
 
-            void scaleContrib(
-                int                       input,
-                int                       output,
-                OpenGLImageFilter::FILTER filter,
-                PixelData &               data)
+        } // namespace
+
+        void scaleContrib(
+            int                       input,
+            int                       output,
+            OpenGLImageFilter::FILTER filter,
+            PixelData &               data)
+        {
+            //DJV_DEBUG("scaleContrib");
+            //DJV_DEBUG_PRINT("scale = " << input << " " << output);
+            //DJV_DEBUG_PRINT("filter = " << filter);
+
+            // Filter function.
+            FilterFnc * fnc = filterFnc(filter);
+            const float support = filterSupport(filter);
+            //DJV_DEBUG_PRINT("support = " << support);
+            const float scale = static_cast<float>(output) / static_cast<float>(input);
+            //DJV_DEBUG_PRINT("scale = " << scale);
+            const float radius = support * (scale >= 1.f ? 1.f : (1.f / scale));
+            //DJV_DEBUG_PRINT("radius = " << radius);
+
+            // Initialize.
+            const int width = Core::Math::ceil(radius * 2.f + 1.f);
+            //DJV_DEBUG_PRINT("width = " << width);
+            data.set(PixelDataInfo(output, width, Pixel::LA_F32));
+
+            // Work.
+            for (int i = 0; i < output; ++i)
             {
-                //DJV_DEBUG("scaleContrib");
-                //DJV_DEBUG_PRINT("scale = " << input << " " << output);
-                //DJV_DEBUG_PRINT("filter = " << filter);
-
-                // Filter function.
-                FilterFnc * fnc = filterFnc(filter);
-                const float support = filterSupport(filter);
-                //DJV_DEBUG_PRINT("support = " << support);
-                const float scale = static_cast<float>(output) / static_cast<float>(input);
-                //DJV_DEBUG_PRINT("scale = " << scale);
-                const float radius = support * (scale >= 1.f ? 1.f : (1.f / scale));
-                //DJV_DEBUG_PRINT("radius = " << radius);
-
-                // Initialize.
-                const int width = Core::Math::ceil(radius * 2.f + 1.f);
-                //DJV_DEBUG_PRINT("width = " << width);
-                data.set(PixelDataInfo(output, width, Pixel::LA_F32));
-
-                // Work.
-                for (int i = 0; i < output; ++i)
+                const float center = i / scale;
+                const int   left   = Core::Math::ceil(center - radius);
+                const int   right  = Core::Math::floor(center + radius);
+                //DJV_DEBUG_PRINT(i << " = " << left << " " << center << " " << right);
+
+                float sum = 0.f;
+                int   pixel = 0;
+                int j = 0;
+                for (int k = left; j < width && k <= right; ++j, ++k)
                 {
-                    const float center = i / scale;
-                    const int   left   = Core::Math::ceil(center - radius);
-                    const int   right  = Core::Math::floor(center + radius);
-                    //DJV_DEBUG_PRINT(i << " = " << left << " " << center << " " << right);
-
-                    float sum = 0.f;
-                    int   pixel = 0;
-                    int j = 0;
-                    for (int k = left; j < width && k <= right; ++j, ++k)
-                    {
-                        Pixel::F32_T * p = reinterpret_cast<Pixel::F32_T *>(data.data(i, j));
-                        pixel = edge(k, input);
-                        const float x = (center - k) * (scale < 1.f ? scale : 1.f);
-                        const float w = (scale < 1.f) ? ((*fnc)(x) * scale) : (*fnc)(x);
-                        //DJV_DEBUG_PRINT("w = " << w);
-                        p[0] = static_cast<Pixel::F32_T>(pixel / static_cast<float>(input));
-                        p[1] = static_cast<Pixel::F32_T>(w);
-                        sum += w;
-                    }
+                    Pixel::F32_T * p = reinterpret_cast<Pixel::F32_T *>(data.data(i, j));
+                    pixel = edge(k, input);
+                    const float x = (center - k) * (scale < 1.f ? scale : 1.f);
+                    const float w = (scale < 1.f) ? ((*fnc)(x) * scale) : (*fnc)(x);
+                    //DJV_DEBUG_PRINT("w = " << w);
+                    p[0] = static_cast<Pixel::F32_T>(pixel / static_cast<float>(input));
+                    p[1] = static_cast<Pixel::F32_T>(w);
+                    sum += w;
+                }
 
-                    for (; j < width; ++j)
-                    {
-                        Pixel::F32_T * p = reinterpret_cast<Pixel::F32_T *>(data.data(i, j));
-                        p[0] = static_cast<Pixel::F32_T>(pixel / static_cast<float>(input));
-                        p[1] = 0.f;
-                    }
+                for (; j < width; ++j)
+                {
+                    Pixel::F32_T * p = reinterpret_cast<Pixel::F32_T *>(data.data(i, j));
+                    p[0] = static_cast<Pixel::F32_T>(pixel / static_cast<float>(input));
+                    p[1] = 0.f;
+                }
 
-                    for (j = 0; j < width; ++j)
-                    {
-                        Pixel::F32_T * p = reinterpret_cast<Pixel::F32_T *>(data.data(i, j));
-                        //DJV_DEBUG_PRINT(p[0] << " = " << p[1]);
-                    }
-                    //DJV_DEBUG_PRINT("sum = " << sum);
+                for (j = 0; j < width; ++j)
+                {
+                    Pixel::F32_T * p = reinterpret_cast<Pixel::F32_T *>(data.data(i, j));
+                    //DJV_DEBUG_PRINT(p[0] << " = " << p[1]);
+                }
+                //DJV_DEBUG_PRINT("sum = " << sum);
 
-                    //! \todo Why is it necessary to average the scale contributions?
-                    //! Without this the values don't always add up to zero causing image
-                    //! artifacts.
-                    for (j = 0; j < width; ++j)
-                    {
-                        Pixel::F32_T * p = reinterpret_cast<Pixel::F32_T *>(data.data(i, j));
-                        p[1] /= static_cast<Pixel::F32_T>(sum);
-                        //DJV_DEBUG_PRINT(p[1]);
-                    }
+                //! \todo Why is it necessary to average the scale contributions?
+                //! Without this the values don't always add up to zero causing image
+                //! artifacts.
+                for (j = 0; j < width; ++j)
+                {
+                    Pixel::F32_T * p = reinterpret_cast<Pixel::F32_T *>(data.data(i, j));
+                    p[1] /= static_cast<Pixel::F32_T>(sum);
+                    //DJV_DEBUG_PRINT(p[1]);
                 }
             }
+        }
 
-        } // namespace
+        OpenGLImageFilter::FILTER scaleFilter(
+            const glm::ivec2 &        input,
+            const glm::ivec2 &        output,
+            const OpenGLImageFilter & filter)
+        {
+            return
+                input == output ? OpenGLImageFilter::NEAREST :
+                (output.x * output.y < input.x * input.y ? filter.min : filter.mag);
+        }
 
         namespace
         {
@@ -574,12 +584,12 @@ namespace djv
                 "vec4 scaleX()\n"
                 "{\n"
                 "    vec4 value = vec4(0.0);\n"
-                "    for (int i = 0; i < %1; ++i)\n"
+                "    for (int i = 0; i < inScaleSize; ++i)\n"
                 "    {\n"
-                "        float t = float(i) / float(%2 - 1);\n"
+                "        float t = float(i) / float(inScaleSize - 1);\n"
                 "        vec4 tmp = texture(inScaleContrib, vec2(TextureCoord.s, t));\n"
                 "        vec2 position = vec2(tmp[0], TextureCoord.t);\n"
-                "        value += tmp[1] * %3;\n"
+                "        value += tmp[1] * %1;\n"
                 "    }\n"
                 "    return value;\n"
                 "}\n"
@@ -589,9 +599,9 @@ namespace djv
                 "vec4 scaleY()\n"
                 "{\n"
                 "    vec4 value = vec4(0.0);\n"
-                "    for (int i = 0; i < %1; ++i)\n"
+                "    for (int i = 0; i < inScaleSize; ++i)\n"
                 "    {\n"
-                "        float t = float(i) / float(%2 - 1);\n"
+                "        float t = float(i) / float(inScaleSize - 1);\n"
                 "        vec4 tmp = texture(inScaleContrib, vec2(TextureCoord.t, t));\n"
                 "        vec2 position = vec2(TextureCoord.s, tmp[0]);\n"
                 "        value += tmp[1] * texture(inTexture, position);\n"
@@ -612,27 +622,16 @@ namespace djv
 
         namespace
         {
-            QString sourceFragment(
-                Pixel::FORMAT                     inFormat,
-                Pixel::FORMAT                     outFormat,
-                bool                              premultiplyAlpha,
-                ColorProfile                      colorProfile,
-                const OpenGLImageDisplayProfile & displayProfile,
-                OpenGLImageOptions::CHANNEL       channel,
-                bool                              multipassFilter,
-                int                               scaleSize,
-                bool                              scaleX)
+            QString sourceFragment(const OpenGLImageShaderKey & key)
             {
                 //DJV_DEBUG("sourceFragment");
-                //DJV_DEBUG_PRINT("in format = " << inFormat);
-                //DJV_DEBUG_PRINT("out format = " << outFormat);
-                //DJV_DEBUG_PRINT("premultiply alpha = " << premultiplyAlpha);
-                //DJV_DEBUG_PRINT("colorProfile = " << colorProfile);
-                //DJV_DEBUG_PRINT("displayProfile = " << displayProfile);
-                //DJV_DEBUG_PRINT("channel = " << channel);
-                //DJV_DEBUG_PRINT("multipass filter = " << multipassFilter);
-                //DJV_DEBUG_PRINT("scale size = " << scaleSize);
-                //DJV_DEBUG_PRINT("scale x = " << scaleX);
+                //DJV_DEBUG_PRINT("in format = " << key.inFormat);
+                //DJV_DEBUG_PRINT("out format = " << key.outFormat);
+                //DJV_DEBUG_PRINT("premultiply alpha = " << key.premultipliedAlpha);
+                //DJV_DEBUG_PRINT("colorProfile = " << key.colorProfile);
+                //DJV_DEBUG_PRINT("channel = " << key.channel);
+                //DJV_DEBUG_PRINT("multipass filter = " << key.multipassFilter);
+                //DJV_DEBUG_PRINT("scale x = " << key.scaleX);
 
                 QString header;
                 QString main;
@@ -645,7 +644,7 @@ namespace djv
 
                 // Input swizzle.
                 QString inSwizzle = "";
-                switch (inFormat)
+                switch (key.inFormat)
                 {
                 case Pixel::FORMAT::L: inSwizzle = ".rrra"; break;
                 case Pixel::FORMAT::LA: inSwizzle = ".rrrg"; break;
@@ -656,17 +655,17 @@ namespace djv
                 QString sample = QString("texture(inTexture, TextureCoord)%1").arg(inSwizzle);
 
                 // Pre-multiply alpha.
-                if (premultiplyAlpha)
+                if (key.premultipliedAlpha)
                 {
                     sample = QString("premultiplyAlpha(%1)").arg(sample);
                 }
 
                 // Color profile.
-                switch (colorProfile.type)
+                switch (key.colorProfile)
                 {
                 case ColorProfile::LUT:
                     header += "uniform sampler2D inColorProfileLut;\n";
-                    switch (colorProfile.lut.channels())
+                    switch (key.colorProfileLut)
                     {
                     case 1: sample = QString("lut1(%1, inColorProfileLut)").arg(sample); break;
                     case 2: sample = QString("lut2(%1, inColorProfileLut)").arg(sample); break;
@@ -686,35 +685,31 @@ namespace djv
                 }
 
                 // Image filter.
-                if (!multipassFilter)
+                if (!key.multipassFilter)
                 {
                     main += QString("color = %1;\n").arg(sample);
                 }
                 else
                 {
                     header += "uniform sampler2D inScaleContrib;\n";
-                    if (scaleX)
+                    header += "uniform int inScaleSize;\n";
+                    if (key.scaleX)
                     {
-                        header += QString(sourceFragmentScaleX).
-                            arg(scaleSize).
-                            arg(scaleSize).
-                            arg(sample);
+                        header += QString(sourceFragmentScaleX).arg(sample);
                         main += "color = scaleX();\n";
                     }
                     else
                     {
-                        header += QString(sourceFragmentScaleY).
-                            arg(scaleSize).
-                            arg(scaleSize);
+                        header += sourceFragmentScaleY;
                         main += "color = scaleY();\n";
                     }
                 }
 
                 // Display profile.
-                if (displayProfile.lut.isValid())
+                if (key.displayProfileLut)
                 {
                     header += "uniform sampler2D inDisplayProfileLut;\n";
-                    switch (displayProfile.lut.channels())
+                    switch (key.displayProfileLut)
                     {
                     case 1: main += "color = lut1(color, inDisplayProfileLut);\n"; break;
                     case 2: main += "color = lut2(color, inDisplayProfileLut);\n"; break;
@@ -722,29 +717,27 @@ namespace djv
                     case 4: main += "color = lut4(color, inDisplayProfileLut);\n"; break;
                     }
                 }
-                if (displayProfile.color != OpenGLImageDisplayProfile().color)
+                if (key.displayProfileColor)
                 {
                     header += "uniform mat4 inDisplayProfileColor;\n";
                     main += "color = displayProfileColor(color, inDisplayProfileColor);\n";
                 }
-                if (displayProfile.levels != OpenGLImageDisplayProfile().levels)
+                if (key.displayProfileLevels)
                 {
-                    header += sourceFragmentLevels.
-                        arg(!Core::Math::fuzzyCompare(displayProfile.levels.gamma, 1.f) ?
-                            sourceGamma : "");
+                    header += sourceFragmentLevels.arg(key.displayProfileGamma ? sourceGamma : "");
                     header += "uniform Levels inDisplayProfileLevels;\n";
                     main += "color = levels(color, inDisplayProfileLevels);\n";
                 }
-                if (displayProfile.softClip != OpenGLImageDisplayProfile().softClip)
+                if (key.displayProfileSoftClip)
                 {
                     header += "uniform float inDisplayProfileSoftClip;\n";
                     main += "color = softClip(color, inDisplayProfileSoftClip);\n";
                 }
 
                 // Image channel.
-                if (channel)
+                if (key.channel)
                 {
-                    main += QString("color = vec4(color[%1]);\n").arg(channel - 1);
+                    main += QString("color = vec4(color[%1]);\n").arg(key.channel - 1);
                 }
 
                 // Clamp pixel values.
@@ -752,7 +745,7 @@ namespace djv
                 //    main += "color = clamp(color, vec4(0.f), vec4(1.f));\n";
 
                 // Output swizzle.
-                switch (outFormat)
+                switch (key.outFormat)
                 {
                 case Pixel::FORMAT::L:
                     main += "color = color.rrrr;\n";
@@ -805,6 +798,22 @@ namespace djv
                 return (f0 + f1) / 2.f;
             }
 
+        } // namespace
+
+        OpenGLImageExposure OpenGLImageExposure::create(const ColorProfile::Exposure & in)
+        {
+            OpenGLImageExposure out;
+            out.v = Core::Math::pow(2.f, in.value + 2.47393f);
+            out.d = in.defog;
+            out.k = Core::Math::pow(2.f, in.kneeLow);
+            out.f = knee2(
+                Core::Math::pow(2.f, in.kneeHigh) - out.k,
+                Core::Math::pow(2.f, 3.5f) - out.k);
+            return out;
+        }
+
+        namespace
+        {
             void colorProfileInit(
                 const OpenGLImageOptions & options,
                 OpenGLShader &             shader,
@@ -829,22 +838,7 @@ namespace djv
                 break;
                 case ColorProfile::EXPOSURE:
                 {
-                    struct Exposure
-                    {
-                        float v, d, k, f;
-                    };
-                    Exposure exposure;
-                    exposure.v = Core::Math::pow(
-                        2.f,
-                        options.colorProfile.exposure.value + 2.47393f);
-                    exposure.d = options.colorProfile.exposure.defog;
-                    exposure.k = Core::Math::pow(
-                        2.f,
-                        options.colorProfile.exposure.kneeLow);
-                    exposure.f = knee2(
-                        Core::Math::pow(2.f, options.colorProfile.exposure.kneeHigh) -
-                        exposure.k,
-                        Core::Math::pow(2.f, 3.5f) - exposure.k);
+                    const OpenGLImageExposure exposure = OpenGLImageExposure::create(options.colorProfile.exposure);
                     //DJV_DEBUG_PRINT("exposure");
                     //DJV_DEBUG_PRINT("  v = " << exposure.v);
                     //DJV_DEBUG_PRINT("  d = " << exposure.d);
@@ -915,6 +909,136 @@ namespace djv
 
         } // namespace
         
+        OpenGLImageShaderKey::OpenGLImageShaderKey(
+            Pixel::FORMAT                     inFormat,
+            Pixel::FORMAT                     outFormat,
+            bool                              premultipliedAlpha,
+            const ColorProfile &              colorProfile,
+            const OpenGLImageDisplayProfile & displayProfile,
+            OpenGLImageOptions::CHANNEL       channel,
+            bool                              multipassFilter,
+            bool                              scaleX) :
+            inFormat(inFormat),
+            outFormat(outFormat),
+            premultipliedAlpha(premultipliedAlpha),
+            colorProfile(colorProfile.type),
+            colorProfileLut(ColorProfile::LUT == colorProfile.type ? colorProfile.lut.channels() : 0),
+            displayProfileLut(displayProfile.lut.isValid() ? displayProfile.lut.channels() : 0),
+            displayProfileColor(displayProfile.color != OpenGLImageDisplayProfile().color),
+            displayProfileLevels(displayProfile.levels != OpenGLImageDisplayProfile().levels),
+            displayProfileGamma(
+                displayProfileLevels &&
+                !Core::Math::fuzzyCompare(displayProfile.levels.gamma, 1.f)),
+            displayProfileSoftClip(displayProfile.softClip != OpenGLImageDisplayProfile().softClip),
+            channel(channel),
+            multipassFilter(multipassFilter),
+            scaleX(scaleX)
+        {}
+
+        bool OpenGLImageShaderKey::operator == (const OpenGLImageShaderKey & other) const
+        {
+            return
+                inFormat == other.inFormat &&
+                outFormat == other.outFormat &&
+                premultipliedAlpha == other.premultipliedAlpha &&
+                colorProfile == other.colorProfile &&
+                colorProfileLut == other.colorProfileLut &&
+                displayProfileLut == other.displayProfileLut &&
+                displayProfileColor == other.displayProfileColor &&
+                displayProfileLevels == other.displayProfileLevels &&
+                displayProfileGamma == other.displayProfileGamma &&
+                displayProfileSoftClip == other.displayProfileSoftClip &&
+                channel == other.channel &&
+                multipassFilter == other.multipassFilter &&
+                scaleX == other.scaleX;
+        }
+
+        bool OpenGLImageTextureKey::operator == (const OpenGLImageTextureKey & other) const
+        {
+            return
+                info == other.info &&
+                min == other.min &&
+                mag == other.mag;
+        }
+
+        bool OpenGLImageScaleContribKey::operator == (const OpenGLImageScaleContribKey & other) const
+        {
+            return
+                input == other.input &&
+                output == other.output &&
+                filter == other.filter;
+        }
+
+        OpenGLImage::Private::Private() :
+            shaders(16),
+            textures(2),
+            scaleContribs(4)
+        {}
+
+        OpenGLShader * OpenGLImage::Private::shader(const OpenGLImageShaderKey & key)
+        {
+            OpenGLShader * out = shaders.get(key);
+            if (!out)
+            {
+                //DJV_DEBUG("OpenGLImage::Private::shader");
+                std::unique_ptr<OpenGLShader> shader(new OpenGLShader);
+                shader->init(sourceVertex, sourceFragment(key));
+                out = shaders.add(key, std::move(shader));
+            }
+            return out;
+        }
+
+        OpenGLTexture * OpenGLImage::Private::texture(const PixelDataInfo & info, GLenum filter)
+        {
+            OpenGLImageTextureKey key;
+            key.info = info;
+            key.min = filter;
+            key.mag = filter;
+            OpenGLTexture * out = textures.get(key);
+            if (!out)
+            {
+                //DJV_DEBUG("OpenGLImage::Private::texture");
+                std::unique_ptr<OpenGLTexture> texture(new OpenGLTexture);
+                texture->init(info, GL_TEXTURE_2D, filter, filter);
+                out = textures.add(key, std::move(texture));
+            }
+            return out;
+        }
+
+        OpenGLTexture * OpenGLImage::Private::scaleContrib(
+            int                       input,
+            int                       output,
+            OpenGLImageFilter::FILTER filter)
+        {
+            OpenGLImageScaleContribKey key;
+            key.input = input;
+            key.output = output;
+            key.filter = filter;
+            OpenGLTexture * out = scaleContribs.get(key);
+            if (!out)
+            {
+                //DJV_DEBUG("OpenGLImage::Private::scaleContrib");
+                PixelData contrib;
+                AV::scaleContrib(input, output, filter, contrib);
+                std::unique_ptr<OpenGLTexture> texture(new OpenGLTexture);
+                texture->init(contrib, GL_TEXTURE_2D, GL_NEAREST, GL_NEAREST);
+                out = scaleContribs.add(key, std::move(texture));
+            }
+            return out;
+        }
+
+        void OpenGLImage::stage(const PixelData & data)
+        {
+            //DJV_DEBUG("OpenGLImage::stage");
+            //DJV_DEBUG_PRINT("data = " << data);
+            const PixelDataInfo & info = data.info();
+            if (auto texture = _p->textures.find(
+                [info](const OpenGLImageTextureKey & key) { return key.info == info; }))
+            {
+                texture->stage(data);
+            }
+        }
+
         void OpenGLImage::draw(
             const PixelData &          data,
             const glm::mat4x4&         viewMatrix,
@@ -925,6 +1049,7 @@ namespace djv
             //DJV_DEBUG_PRINT("data = " << data);
             //DJV_DEBUG_PRINT("color profile = " << options.colorProfile);
 
+            _initContext();
             auto glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
 
             const PixelDataInfo & info = data.info();
@@ -940,91 +1065,72 @@ namespace djv
             //DJV_DEBUG_PRINT("scale tmp = " << scaleTmp);
 
             // Initialize.
-            const OpenGLImageFilter::FILTER filter =
-                info.size == scale ? OpenGLImageFilter::NEAREST :
-                (scale.x * scale.y < info.size.x * info.size.y ?
-                    options.filter.min : options.filter.mag);
+            const OpenGLImageFilter::FILTER filter = scaleFilter(info.size, scale, options.filter);
             //DJV_DEBUG_PRINT("filter min = " << options.filter.min);
             //DJV_DEBUG_PRINT("filter mag = " << options.filter.mag);
             //DJV_DEBUG_PRINT("filter = " << filter);
 
-            if (!_p->init || _p->info != info || _p->options != options)
+            if (!_p->mesh)
             {
-                _p->init = true;
-                _p->info = info;
-                _p->options = options;
-                switch (filter)
-                {
-                case OpenGLImageFilter::NEAREST:
-                case OpenGLImageFilter::LINEAR:
-                {
-                    //DJV_DEBUG_PRINT("init single pass");
-                    _p->texture->init(
-                        data.info(),
-                        GL_TEXTURE_2D,
-                        OpenGLImageFilter::toGl(filter),
-                        OpenGLImageFilter::toGl(filter));
-                    _p->shader->init(
-                        sourceVertex,
-                        sourceFragment(
-                            Pixel::format(info.pixel),
-                            outputFormat,
-                            options.premultipliedAlpha,
-                            options.colorProfile,
-                            options.displayProfile,
-                            options.channel,
-                            false,
-                            0,
-                            false));
-                }
-                break;
-                case OpenGLImageFilter::BOX:
-                case OpenGLImageFilter::TRIANGLE:
-                case OpenGLImageFilter::BELL:
-                case OpenGLImageFilter::BSPLINE:
-                case OpenGLImageFilter::LANCZOS3:
-                case OpenGLImageFilter::CUBIC:
-                case OpenGLImageFilter::MITCHELL:
-                {
-                    //DJV_DEBUG_PRINT("init two pass");
-                    _p->texture->init(data.info(), GL_TEXTURE_2D, GL_NEAREST, GL_NEAREST);
-
-                    // Initialize horizontal pass.
-                    PixelData contrib;
-                    scaleContrib(data.w(), scale.x, filter, contrib);
-                    _p->scaleXContrib->init(contrib, GL_TEXTURE_2D, GL_NEAREST, GL_NEAREST);
-                    _p->scaleXShader->init(
-                        sourceVertex,
-                        sourceFragment(
-                            Pixel::format(info.pixel),
-                            outputFormat,
-                            false,
-                            options.colorProfile,
-                            OpenGLImageDisplayProfile(),
-                            OpenGLImageOptions::CHANNEL_DEFAULT,
-                            true,
-                            contrib.h(),
-                            true));
-
-                    // Initialize vertical pass.
-                    scaleContrib(data.h(), scale.y, filter, contrib);
-                    _p->scaleYContrib->init(contrib, GL_TEXTURE_2D, GL_NEAREST, GL_NEAREST);
-                    _p->scaleYShader->init(
-                        sourceVertex,
-                        sourceFragment(
-                            Pixel::format(info.pixel),
-                            outputFormat,
-                            options.premultipliedAlpha,
-                            ColorProfile(),
-                            options.displayProfile,
-                            options.channel,
-                            true,
-                            contrib.h(),
-                            false));
-                }
-                break;
-                default: break;
-                }
+                _p->mesh.reset(new OpenGLImageMesh);
+            }
+            OpenGLTexture * texture = nullptr;
+            OpenGLShader * shader = nullptr;
+            OpenGLTexture * scaleXContrib = nullptr;
+            OpenGLShader * scaleXShader = nullptr;
+            OpenGLTexture * scaleYContrib = nullptr;
+            OpenGLShader * scaleYShader = nullptr;
+            switch (filter)
+            {
+            case OpenGLImageFilter::NEAREST:
+            case OpenGLImageFilter::LINEAR:
+            {
+                texture = _p->texture(info, OpenGLImageFilter::toGl(filter));
+                shader = _p->shader(OpenGLImageShaderKey(
+                    Pixel::format(info.pixel),
+                    outputFormat,
+                    options.premultipliedAlpha,
+                    options.colorProfile,
+                    options.displayProfile,
+                    options.channel));
+            }
+            break;
+            case OpenGLImageFilter::BOX:
+            case OpenGLImageFilter::TRIANGLE:
+            case OpenGLImageFilter::BELL:
+            case OpenGLImageFilter::BSPLINE:
+            case OpenGLImageFilter::LANCZOS3:
+            case OpenGLImageFilter::CUBIC:
+            case OpenGLImageFilter::MITCHELL:
+            {
+                texture = _p->texture(info, GL_NEAREST);
+
+                // Initialize horizontal pass.
+                scaleXContrib = _p->scaleContrib(data.w(), scale.x, filter);
+                scaleXShader = _p->shader(OpenGLImageShaderKey(
+                    Pixel::format(info.pixel),
+                    outputFormat,
+                    false,
+                    options.colorProfile,
+                    OpenGLImageDisplayProfile(),
+                    OpenGLImageOptions::CHANNEL_DEFAULT,
+                    true,
+                    true));
+
+                // Initialize vertical pass.
+                scaleYContrib = _p->scaleContrib(data.h(), scale.y, filter);
+                scaleYShader = _p->shader(OpenGLImageShaderKey(
+                    Pixel::format(info.pixel),
+                    outputFormat,
+                    options.premultipliedAlpha,
+                    ColorProfile(),
+                    options.displayProfile,
+                    options.channel,
+                    true,
+                    false));
+            }
+            break;
+            default: break;
             }
 
             // Render.
@@ -1039,17 +1145,17 @@ namespace djv
             {
                 //DJV_DEBUG_PRINT("draw single pass");
 
-                _p->shader->bind();
+                shader->bind();
 
                 // Initialize color and display profiles.
-                colorProfileInit(options, *(_p->shader), *(_p->lutColorProfile));
-                displayProfileInit(options, *_p->shader, *_p->lutDisplayProfile);
+                colorProfileInit(options, *shader, *(_p->lutColorProfile));
+                displayProfileInit(options, *shader, *_p->lutDisplayProfile);
 
                 // Draw.
                 glFuncs->glActiveTexture(GL_TEXTURE0);
-                _p->shader->setUniform("inTexture", 0);
-                _p->texture->copy(data);
-                _p->shader->setUniform("transform.mvp", viewMatrix * OpenGLImageXform::xformMatrix(options.xform));
+                shader->setUniform("inTexture", 0);
+                texture->copy(data);
+                shader->setUniform("transform.mvp", viewMatrix * OpenGLImageXform::xformMatrix(options.xform));
                 _p->mesh->setSize(info.size, mirror, proxyScale);
                 _p->mesh->draw();
             }
@@ -1072,15 +1178,16 @@ namespace djv
                     glFuncs->glViewport(0, 0, scaleTmp.x, scaleTmp.y);
 
                     OpenGLOffscreenBufferScope bufferScope(&buffer);
-                    _p->scaleXShader->bind();
-                    colorProfileInit(options, *(_p->scaleXShader), *(_p->lutColorProfile));
+                    scaleXShader->bind();
+                    colorProfileInit(options, *scaleXShader, *(_p->lutColorProfile));
                     glFuncs->glActiveTexture(GL_TEXTURE0);
-                    _p->scaleXShader->setUniform("inTexture", 0);
-                    _p->texture->copy(data);
-                    _p->texture->bind();
+                    scaleXShader->setUniform("inTexture", 0);
+                    texture->copy(data);
+                    texture->bind();
                     glFuncs->glActiveTexture(GL_TEXTURE1);
-                    _p->scaleXShader->setUniform("inScaleContrib", 1);
-                    _p->scaleXContrib->bind();
+                    scaleXShader->setUniform("inScaleContrib", 1);
+                    scaleXShader->setUniform("inScaleSize", scaleXContrib->info().size.y);
+                    scaleXContrib->bind();
                     auto m = glm::ortho(
                         0.f,
                         static_cast<float>(scaleTmp.x),
@@ -1088,7 +1195,7 @@ namespace djv
                         static_cast<float>(scaleTmp.y),
                         -1.f,
                         1.f);
-                    _p->scaleXShader->setUniform("transform.mvp", m);
+                    scaleXShader->setUniform("transform.mvp", m);
                     _p->mesh->setSize(scaleTmp, mirror);
                     _p->mesh->draw();
 
@@ -1096,17 +1203,18 @@ namespace djv
                 }
 
                 // Vertical pass.
-                _p->scaleYShader->bind();
-                displayProfileInit(options, *(_p->scaleYShader), *(_p->lutDisplayProfile));
+                scaleYShader->bind();
+                displayProfileInit(options, *scaleYShader, *(_p->lutDisplayProfile));
                 glFuncs->glActiveTexture(GL_TEXTURE0);
-                _p->scaleYShader->setUniform("inTexture", 0);
+                scaleYShader->setUniform("inTexture", 0);
                 glBindTexture(GL_TEXTURE_2D, buffer.texture());
                 glFuncs->glActiveTexture(GL_TEXTURE1);
-                _p->scaleYShader->setUniform("inScaleContrib", 1);
-                _p->scaleYContrib->bind();
+                scaleYShader->setUniform("inScaleContrib", 1);
+                scaleYShader->setUniform("inScaleSize", scaleYContrib->info().size.y);
+                scaleYContrib->bind();
                 OpenGLImageXform xform = options.xform;
                 xform.scale = glm::vec2(1.f, 1.f);
-                _p->scaleYShader->setUniform("transform.mvp", viewMatrix * OpenGLImageXform::xformMatrix(xform));
+                scaleYShader->setUniform("transform.mvp", viewMatrix * OpenGLImageXform::xformMatrix(xform));
                 _p->mesh->setSize(scale);
                 _p->mesh->draw();
             }
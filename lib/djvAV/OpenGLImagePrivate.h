@@ -29,28 +29,192 @@
 
 #pragma once
 
+#include <djvAV/CPUImage.h>
 #include <djvAV/OpenGLImage.h>
+#include <djvAV/OpenGLShader.h>
+#include <djvAV/OpenGLTexture.h>
+
+#include <list>
+#include <memory>
+#include <utility>
 
 namespace djv
 {
     namespace AV
     {
-        struct OpenGLImage::Private
+        //! This struct provides the options that an image shader program is
+        //! generated from. The remaining options are set as uniforms when the
+        //! image is drawn, so changing them does not require a new program.
+        struct OpenGLImageShaderKey
+        {
+            OpenGLImageShaderKey(
+                Pixel::FORMAT                     inFormat,
+                Pixel::FORMAT                     outFormat,
+                bool                              premultipliedAlpha,
+                const ColorProfile &              colorProfile,
+                const OpenGLImageDisplayProfile & displayProfile,
+                OpenGLImageOptions::CHANNEL       channel,
+                bool                              multipassFilter = false,
+                bool                              scaleX          = false);
+
+            Pixel::FORMAT               inFormat               = Pixel::RGBA;
+            Pixel::FORMAT               outFormat              = Pixel::RGBA;
+            bool                        premultipliedAlpha     = false;
+            ColorProfile::PROFILE       colorProfile           = ColorProfile::RAW;
+            int                         colorProfileLut        = 0; //!< LUT channels
+            int                         displayProfileLut      = 0; //!< LUT channels
+            bool                        displayProfileColor    = false;
+            bool                        displayProfileLevels   = false;
+            bool                        displayProfileGamma    = false;
+            bool                        displayProfileSoftClip = false;
+            OpenGLImageOptions::CHANNEL channel                = OpenGLImageOptions::CHANNEL_DEFAULT;
+            bool                        multipassFilter        = false;
+            bool                        scaleX                 = false;
+
+            bool operator == (const OpenGLImageShaderKey &) const;
+        };
+
+        //! This struct provides the options that an image texture is allocated
+        //! from.
+        struct OpenGLImageTextureKey
         {
-            bool init = false;
             PixelDataInfo info;
-            OpenGLImageOptions options;
-            std::unique_ptr<OpenGLTexture> texture;
-            std::unique_ptr<OpenGLShader> shader;
-            std::unique_ptr<OpenGLTexture> scaleXContrib;
-            std::unique_ptr<OpenGLTexture> scaleYContrib;
-            std::unique_ptr<OpenGLShader> scaleXShader;
-            std::unique_ptr<OpenGLShader> scaleYShader;
+            GLenum        min = GL_NEAREST;
+            GLenum        mag = GL_NEAREST;
+
+            bool operator == (const OpenGLImageTextureKey &) const;
+        };
+
+        //! This struct provides the options that the filter contributions for
+        //! scaling are calculated from.
+        struct OpenGLImageScaleContribKey
+        {
+            int                       input  = 0;
+            int                       output = 0;
+            OpenGLImageFilter::FILTER filter = OpenGLImageFilter::NEAREST;
+
+            bool operator == (const OpenGLImageScaleContribKey &) const;
+        };
+
+        //! This class provides a least recently used cache of OpenGL resources.
+        template<typename K, typename V>
+        class OpenGLImageCache
+        {
+        public:
+            explicit OpenGLImageCache(size_t max) :
+                _max(max)
+            {}
+
+            //! Get a value from the cache, or null if the key is not found.
+            V * get(const K & key)
+            {
+                for (auto i = _list.begin(); i != _list.end(); ++i)
+                {
+                    if (i->first == key)
+                    {
+                        _list.splice(_list.begin(), _list, i);
+                        return _list.front().second.get();
+                    }
+                }
+                return nullptr;
+            }
+
+            //! Add a value to the cache. The least recently used value is
+            //! removed when the cache is full.
+            V * add(const K & key, std::unique_ptr<V> value)
+            {
+                _list.push_front(std::make_pair(key, std::move(value)));
+                while (_list.size() > _max)
+                {
+                    _list.pop_back();
+                }
+                return _list.front().second.get();
+            }
+
+            //! Find a value in the cache without changing the order.
+            template<typename F>
+            V * find(F predicate) const
+            {
+                for (const auto & i : _list)
+                {
+                    if (predicate(i.first))
+                    {
+                        return i.second.get();
+                    }
+                }
+                return nullptr;
+            }
+
+            //! Get the number of values in the cache.
+            size_t size() const
+            {
+                return _list.size();
+            }
+
+        private:
+            size_t _max = 0;
+            std::list<std::pair<K, std::unique_ptr<V> > > _list;
+        };
+
+        struct OpenGLImage::Private
+        {
+            Private();
+
+            //! Get a shader program, compiling it if it is not in the cache.
+            //!
+            //! Throws:
+            //! - Core::Error
+            OpenGLShader * shader(const OpenGLImageShaderKey &);
+
+            //! Get a texture, allocating it if it is not in the cache.
+            //!
+            //! Throws:
+            //! - Core::Error
+            OpenGLTexture * texture(const PixelDataInfo &, GLenum filter);
+
+            //! Get a texture of filter contributions for scaling, calculating it
+            //! if it is not in the cache.
+            //!
+            //! Throws:
+            //! - Core::Error
+            OpenGLTexture * scaleContrib(int input, int output, OpenGLImageFilter::FILTER);
+
+            OpenGLImageCache<OpenGLImageShaderKey, OpenGLShader> shaders;
+            OpenGLImageCache<OpenGLImageTextureKey, OpenGLTexture> textures;
+            OpenGLImageCache<OpenGLImageScaleContribKey, OpenGLTexture> scaleContribs;
             std::unique_ptr<OpenGLLUT> lutColorProfile;
             std::unique_ptr<OpenGLLUT> lutDisplayProfile;
             std::unique_ptr<OpenGLImageMesh> mesh;
             std::unique_ptr<OpenGLOffscreenBuffer> buffer;
+            std::unique_ptr<CPUImage> cpuImage;
+        };
+
+        //! This struct provides the exposure values used by the color profile.
+        struct OpenGLImageExposure
+        {
+            float v = 0.f;
+            float d = 0.f;
+            float k = 0.f;
+            float f = 0.f;
+
+            //! Calculate the exposure values.
+            static OpenGLImageExposure create(const ColorProfile::Exposure &);
         };
 
+        //! Calculate the filter contributions for scaling. The output data has
+        //! a pixel type of LA_F32 where the first channel is the normalized
+        //! input pixel position and the second channel is the weight.
+        void scaleContrib(
+            int                       input,
+            int                       output,
+            OpenGLImageFilter::FILTER filter,
+            PixelData &               data);
+
+        //! Get the filter used for scaling pixel data to the given size.
+        OpenGLImageFilter::FILTER scaleFilter(
+            const glm::ivec2 &        input,
+            const glm::ivec2 &        output,
+            const OpenGLImageFilter & filter);
+
     } // namespace AV
 } // namespace djv
@@ -182,6 +182,8 @@ namespace djv
 
         void OpenGLShader::del()
         {
+            if (!_p->vertexId && !_p->fragmentId && !_p->programId)
+                return;
             auto glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
             if (_p->vertexId)
             {
@@ -36,18 +36,37 @@
 
 #include <QCoreApplication>
 
+#include <vector>
+
 namespace djv
 {
     namespace AV
     {
+        namespace
+        {
+            //! This struct provides a pixel buffer in the upload ring.
+            struct Buffer
+            {
+                GLuint        pbo    = 0;
+                quint64       size   = 0;
+                GLsync        fence  = 0;
+                const void *  staged = nullptr;
+                PixelDataInfo info;
+            };
+
+        } // namespace
+
+        const size_t OpenGLTexture::bufferCount;
+
         struct OpenGLTexture::Private
         {
-            PixelDataInfo info;
-            GLenum        target = GL_NONE;
-            GLenum        min = GL_NONE;
-            GLenum        mag = GL_NONE;
-            GLuint        id = 0;
-            GLuint        pbo = 0;
+            PixelDataInfo       info;
+            GLenum              target = GL_NONE;
+            GLenum              min = GL_NONE;
+            GLenum              mag = GL_NONE;
+            GLuint              id = 0;
+            std::vector<Buffer> buffers;
+            size_t              bufferIndex = 0;
         };
 
         OpenGLTexture::OpenGLTexture() :
@@ -103,10 +122,11 @@ namespace djv
                 OpenGL::format(_p->info.pixel, _p->info.bgr),
                 OpenGL::type(_p->info.pixel),
                 0);
-            glFuncs->glGenBuffers(1, &_p->pbo);
-            glFuncs->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _p->pbo);
-            glFuncs->glBufferData(GL_PIXEL_UNPACK_BUFFER, PixelDataUtil::dataByteCount(info), 0, GL_STREAM_DRAW);
-            glFuncs->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+            // The pixel buffers are allocated when they are first used, so
+            // textures that are only copied to once only use a single buffer.
+            _p->buffers.resize(bufferCount);
+            _p->bufferIndex = 0;
         }
 
         void OpenGLTexture::init(
@@ -119,14 +139,34 @@ namespace djv
             copy(data);
         }
 
+        void OpenGLTexture::stage(const PixelData & in)
+        {
+            //DJV_DEBUG("OpenGLTexture::stage");
+            //DJV_DEBUG_PRINT("in = " << in);
+            if (_stagedBuffer(in) < 0)
+            {
+                // Only the most recently staged data is kept.
+                for (auto & buffer : _p->buffers)
+                {
+                    buffer.staged = nullptr;
+                }
+                _upload(in);
+            }
+        }
+
         void OpenGLTexture::copy(const PixelData & in)
         {
             //DJV_DEBUG("OpenGLTexture::copy");
             //DJV_DEBUG_PRINT("in = " << in);
             auto glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
             const PixelDataInfo & info = in.info();
-            glFuncs->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _p->pbo);
-            glFuncs->glBufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, PixelDataUtil::dataByteCount(info), in.data());
+            int index = _stagedBuffer(in);
+            if (index < 0)
+            {
+                index = _upload(in);
+            }
+            Buffer & buffer = _p->buffers[index];
+            glFuncs->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.pbo);
             bind();
             OpenGLImage::stateUnpack(in.info());
             GLenum format = OpenGL::format(info.pixel, info.bgr);
@@ -145,6 +185,7 @@ namespace djv
                 type,
                 0);
             glFuncs->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            _fence(index);
         }
 
         void OpenGLTexture::copy(const PixelData & in, const Core::Box2i & area)
@@ -154,8 +195,13 @@ namespace djv
             //DJV_DEBUG_PRINT("area = " << area);
             auto glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
             const PixelDataInfo & info = in.info();
-            glFuncs->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _p->pbo);
-            glFuncs->glBufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, PixelDataUtil::dataByteCount(info), in.data());
+            int index = _stagedBuffer(in);
+            if (index < 0)
+            {
+                index = _upload(in);
+            }
+            Buffer & buffer = _p->buffers[index];
+            glFuncs->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.pbo);
             bind();
             glm::ivec2 position = area.position;
             if (info.mirror.x)
@@ -178,6 +224,7 @@ namespace djv
                 OpenGL::type(info.pixel),
                 0);
             glFuncs->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            _fence(index);
         }
 
         void OpenGLTexture::copy(const glm::ivec2 & in)
@@ -229,19 +276,101 @@ namespace djv
             return _p->id;
         }
 
+        int OpenGLTexture::_stagedBuffer(const PixelData & in) const
+        {
+            for (size_t i = 0; i < _p->buffers.size(); ++i)
+            {
+                const Buffer & buffer = _p->buffers[i];
+                if (buffer.staged && buffer.staged == in.data() && buffer.info == in.info())
+                {
+                    return static_cast<int>(i);
+                }
+            }
+            return -1;
+        }
+
+        int OpenGLTexture::_upload(const PixelData & in)
+        {
+            //DJV_DEBUG("OpenGLTexture::_upload");
+            auto glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
+            if (!_p->buffers.size())
+            {
+                _p->buffers.resize(bufferCount);
+            }
+            const int index = static_cast<int>(_p->bufferIndex);
+            _p->bufferIndex = (_p->bufferIndex + 1) % _p->buffers.size();
+            Buffer & buffer = _p->buffers[index];
+
+            // Wait for the GPU to finish reading from the buffer. With enough
+            // buffers in the ring this has usually happened already.
+            if (buffer.fence)
+            {
+                glFuncs->glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+                glFuncs->glDeleteSync(buffer.fence);
+                buffer.fence = 0;
+            }
+
+            const quint64 size = PixelDataUtil::dataByteCount(in.info());
+            if (!buffer.pbo)
+            {
+                glFuncs->glGenBuffers(1, &buffer.pbo);
+            }
+            glFuncs->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.pbo);
+            if (size != buffer.size)
+            {
+                glFuncs->glBufferData(GL_PIXEL_UNPACK_BUFFER, size, 0, GL_STREAM_DRAW);
+                buffer.size = size;
+            }
+            if (void * p = glFuncs->glMapBufferRange(
+                GL_PIXEL_UNPACK_BUFFER,
+                0,
+                size,
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT))
+            {
+                memcpy(p, in.data(), size);
+                glFuncs->glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            }
+            else
+            {
+                glFuncs->glBufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, size, in.data());
+            }
+            glFuncs->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            buffer.staged = in.data();
+            buffer.info = in.info();
+            return index;
+        }
+
+        void OpenGLTexture::_fence(int index)
+        {
+            auto glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
+            Buffer & buffer = _p->buffers[index];
+            buffer.fence = glFuncs->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            buffer.staged = nullptr;
+        }
+
         void OpenGLTexture::del()
         {
+            if (!_p->id && !_p->buffers.size())
+                return;
             auto glFuncs = QOpenGLContext::currentContext()->versionFunctions<QOpenGLFunctions_3_3_Core>();
             if (_p->id)
             {
                 glFuncs->glDeleteTextures(1, &_p->id);
                 _p->id = 0;
             }
-            if (_p->pbo)
+            for (auto & buffer : _p->buffers)
             {
-                glFuncs->glDeleteBuffers(1, &_p->pbo);
-                _p->pbo = 0;
+                if (buffer.fence)
+                {
+                    glFuncs->glDeleteSync(buffer.fence);
+                }
+                if (buffer.pbo)
+                {
+                    glFuncs->glDeleteBuffers(1, &buffer.pbo);
+                }
             }
+            _p->buffers.clear();
+            _p->bufferIndex = 0;
         }
 
     } // namespace AV
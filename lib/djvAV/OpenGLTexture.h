@@ -39,9 +39,18 @@ namespace djv
     namespace AV
     {
         //! This class proivides an OpenGL texture.
+        //!
+        //! Pixel data is uploaded through a ring of pixel buffers. Each buffer
+        //! is fenced after it is copied to the texture, so the CPU only waits
+        //! on the GPU when the ring is full. Data can also be staged ahead of
+        //! time with stage(), so that a later copy() only needs a transfer on
+        //! the GPU.
         class OpenGLTexture
         {
         public:
+            //! The number of pixel buffers in the upload ring.
+            static const size_t bufferCount = 3;
+
             OpenGLTexture();
             ~OpenGLTexture();
 
@@ -83,7 +92,13 @@ namespace djv
             //! Bind the texture.
             void bind();
 
-            //! Copy pixel data to the texture.
+            //! Stage pixel data in a pixel buffer so that it can be copied to the
+            //! texture later. The pixel data must not be changed or freed until
+            //! it is copied.
+            void stage(const PixelData &);
+
+            //! Copy pixel data to the texture. Pixel data that was previously
+            //! staged is copied from its pixel buffer.
             void copy(const PixelData &);
 
             //! Copy pixel data to the texture.
@@ -93,6 +108,10 @@ namespace djv
             void copy(const glm::ivec2 &);
 
         private:
+            int _stagedBuffer(const PixelData &) const;
+            int _upload(const PixelData &);
+            void _fence(int);
+
             void del();
 
             struct Private;
@@ -53,6 +53,19 @@ namespace djv
         PICLoad::~PICLoad()
         {}
 
+        PICLoad::PICLoad(const PICLoad & other) :
+            Load(other),
+            _type(other._type)
+        {
+            _compression[0] = other._compression[0];
+            _compression[1] = other._compression[1];
+        }
+
+        std::unique_ptr<Load> PICLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new PICLoad(*this));
+        }
+
         void PICLoad::read(Image & image, const ImageIOInfo & frame)
         {
             //DJV_DEBUG("PICLoad::read");
@@ -74,6 +87,7 @@ namespace djv
             PixelData * data = frame.proxy ? &_tmp : &image;
             auto pixelDataInfo = info.layers[0];
             data->set(pixelDataInfo);
+            data->zero();
             const int  channels = Pixel::channels(pixelDataInfo.pixel);
             const int  byteCount = Pixel::channelByteCount(pixelDataInfo.pixel);
             const bool endian = io.endian();
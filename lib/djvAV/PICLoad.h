@@ -44,9 +44,13 @@ namespace djv
             explicit PICLoad(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             ~PICLoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
+            PICLoad(const PICLoad &);
+
             void _open(const QString &, IOInfo &, Core::FileIO &);
 
             PIC::TYPE _type           = static_cast<PIC::TYPE>(0);
@@ -57,6 +57,17 @@ namespace djv
             _close();
         }
 
+        PNGLoad::PNGLoad(const PNGLoad & other) :
+            Load(other)
+        {
+            _pngError.context = context();
+        }
+
+        std::unique_ptr<Load> PNGLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new PNGLoad(*this));
+        }
+
         namespace
         {
             bool pngScanline(png_structp png, quint8 * out)
@@ -99,6 +110,7 @@ namespace djv
             PixelData * data = frame.proxy ? &_tmp : &image;
             auto pixelDataInfo = info.layers[0];
             data->set(pixelDataInfo);
+            data->zero();
             for (int y = 0; y < pixelDataInfo.size.y; ++y)
             {
                 if (!pngScanline(_png, data->data(0, data->h() - 1 - y)))
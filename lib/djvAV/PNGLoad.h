@@ -44,9 +44,13 @@ namespace djv
             explicit PNGLoad(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             ~PNGLoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
+            PNGLoad(const PNGLoad &);
+
             void _open(const QString &, IOInfo &);
             void _close();
 
@@ -107,7 +107,7 @@ namespace djv
             if (in.info() != _image.info())
             {
                 _image.zero();
-                OpenGLImage().copy(in, _image);
+                openGLImage().copy(in, _image);
                 p = &_image;
             }
 
@@ -53,6 +53,17 @@ namespace djv
         PPMLoad::~PPMLoad()
         {}
 
+        PPMLoad::PPMLoad(const PPMLoad & other) :
+            Load(other),
+            _bitDepth(other._bitDepth),
+            _data(other._data)
+        {}
+
+        std::unique_ptr<Load> PPMLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new PPMLoad(*this));
+        }
+
         void PPMLoad::read(Image & image, const ImageIOInfo & frame)
         {
             //DJV_DEBUG("PPMLoad::read");
@@ -67,10 +78,18 @@ namespace djv
             QScopedPointer<Core::FileIO> io(new Core::FileIO);
             _open(fileName, info, *io);
 
-            // Read the file.
-            io->readAhead();
-            PixelData * data = frame.proxy ? &_tmp : &image;
+            // Read the file. Binary files are memory mapped so only the pages
+            // with the region are touched, other files are read up to the
+            // last row of the region.
             auto pixelDataInfo = info.layers[0];
+            const Core::Box2i region = Load::region(frame, pixelDataInfo.size);
+            const bool crop = region.size != pixelDataInfo.size;
+            //DJV_DEBUG_PRINT("region = " << region);
+            if (!crop)
+            {
+                io->readAhead();
+            }
+            PixelData * data = (frame.proxy || crop) ? &_tmp : &image;
             if (PPM::DATA_BINARY == _data && _bitDepth != 1)
             {
                 if ((io->size() - io->pos()) < PixelDataUtil::dataByteCount(pixelDataInfo))
@@ -85,7 +104,9 @@ namespace djv
             else
             {
                 data->set(pixelDataInfo);
+                data->zero();
                 const int channels = Pixel::channels(pixelDataInfo.pixel);
+                const int rows = region.y + region.h;
                 if (PPM::DATA_BINARY == _data && 1 == _bitDepth)
                 {
                     const quint64 scanlineByteCount = PPM::scanlineByteCount(
@@ -93,7 +114,7 @@ namespace djv
                     std::vector<quint8> scanline(scanlineByteCount);
                     //DJV_DEBUG_PRINT("scanline = " <<
                     //    static_cast<int>(scanlineByteCount));
-                    for (int y = 0; y < pixelDataInfo.size.y; ++y)
+                    for (int y = 0; y < rows; ++y)
                     {
                         io->get(scanline.data(), scanlineByteCount);
                         const quint8 * inP = scanline.data();
@@ -106,7 +127,7 @@ namespace djv
                 }
                 else
                 {
-                    for (int y = 0; y < pixelDataInfo.size.y; ++y)
+                    for (int y = 0; y < rows; ++y)
                     {
                         PPM::asciiLoad(
                             *io,
@@ -125,6 +146,10 @@ namespace djv
                 image.set(pixelDataInfo);
                 PixelDataUtil::proxyScale(_tmp, image, frame.proxy);
             }
+            else if (crop)
+            {
+                PixelDataUtil::crop(_tmp, image, region);
+            }
 
             //DJV_DEBUG_PRINT("image = " << image);
         }
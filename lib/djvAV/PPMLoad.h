@@ -44,9 +44,13 @@ namespace djv
             explicit PPMLoad(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             ~PPMLoad();
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
+            PPMLoad(const PPMLoad &);
+
             void _open(const QString &, IOInfo &, Core::FileIO &);
 
             int       _bitDepth = 0;
@@ -62,6 +62,11 @@ namespace djv
                 ".pbm";
         }
 
+        bool PPMPlugin::canReadRegion() const
+        {
+            return true;
+        }
+
         QStringList PPMPlugin::option(const QString & in) const
         {
             QStringList out;
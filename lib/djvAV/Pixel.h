@@ -281,6 +281,14 @@ namespace djv
                 int          size = 1,
                 int          stride = 1,
                 bool         bgr = false);
+
+            //! Get whether SIMD kernels are used for pixel conversion. The
+            //! kernels are only used when supported by the CPU, otherwise the
+            //! scalar conversion is used.
+            static bool simd();
+
+            //! Set whether SIMD kernels are used for pixel conversion.
+            static void setSIMD(bool);
         };
 
     } // namespace AV
@@ -29,8 +29,12 @@
 
 #include <djvAV/Pixel.h>
 
+#include <djvAV/PixelConvertPrivate.h>
+
 #include <djvCore/Memory.h>
 
+#include <atomic>
+
 namespace djv
 {
     namespace AV
@@ -314,6 +318,8 @@ namespace djv
                 _FNC_TABLE(RGBA_F32)
             };
 
+            std::atomic<bool> simdEnabled(true);
+
         } // namespace
 
         void Pixel::convert(
@@ -335,11 +341,27 @@ namespace djv
             {
                 memcpy(out, in, size * byteCount(outPixel));
             }
+            else if (auto kernel = 1 == stride && simdEnabled ?
+                PixelConvertSIMD::kernel(inPixel, outPixel, bgr) :
+                nullptr)
+            {
+                kernel(in, out, size, channels(inPixel), bgr);
+            }
             else
             {
                 fnc_tbl[inPixel][outPixel](in, out, size, stride, bgr);
             }
         }
 
+        bool Pixel::simd()
+        {
+            return simdEnabled;
+        }
+
+        void Pixel::setSIMD(bool value)
+        {
+            simdEnabled = value;
+        }
+
     } // namespace AV
 } // namespace djv
@@ -0,0 +1,637 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvAV/PixelConvertPrivate.h>
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define DJV_PIXEL_SIMD
+#endif
+
+#if defined(DJV_PIXEL_SIMD)
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace PixelConvertSIMD
+        {
+            namespace
+            {
+#if defined(DJV_PIXEL_SIMD)
+
+// SSE2 is always available on x86-64, other instruction sets are enabled
+// per-function and only called when the CPU supports them.
+#if defined(_MSC_VER)
+#define _TARGET(ISA)
+#else
+#define _TARGET(ISA) __attribute__((target(ISA)))
+#endif
+
+                void cpuid(unsigned int leaf, unsigned int regs[4])
+                {
+#if defined(_MSC_VER)
+                    int tmp[4] = { 0, 0, 0, 0 };
+                    __cpuidex(tmp, leaf, 0);
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        regs[i] = static_cast<unsigned int>(tmp[i]);
+                    }
+#else
+                    __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+                }
+
+                quint64 xgetbv()
+                {
+#if defined(_MSC_VER)
+                    return _xgetbv(0);
+#else
+                    unsigned int eax = 0;
+                    unsigned int edx = 0;
+                    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+                    return (static_cast<quint64>(edx) << 32) | eax;
+#endif
+                }
+
+                struct CPU
+                {
+                    CPU()
+                    {
+                        unsigned int regs[4] = { 0, 0, 0, 0 };
+                        cpuid(0, regs);
+                        const unsigned int leafMax = regs[0];
+                        if (leafMax >= 1)
+                        {
+                            cpuid(1, regs);
+                            const bool osxsave = (regs[2] & (1 << 27)) != 0;
+                            const bool avx     = (regs[2] & (1 << 28)) != 0;
+                            const bool f16c    = (regs[2] & (1 << 29)) != 0;
+
+                            // Check that the operating system saves the AVX registers.
+                            const bool ymm = osxsave && (xgetbv() & 0x6) == 0x6;
+                            this->f16c = avx && f16c && ymm;
+                            if (leafMax >= 7)
+                            {
+                                cpuid(7, regs);
+                                avx2 = this->f16c && (regs[1] & (1 << 5)) != 0;
+                            }
+                        }
+                    }
+
+                    bool f16c = false;
+                    bool avx2 = false;
+                };
+
+                //! Check that the 10-bit data has the bit layout the kernels expect.
+                bool isU10Supported()
+                {
+                    Pixel::U10_S p;
+                    p.r = 1;
+                    p.g = 2;
+                    p.b = 3;
+                    p.pad = 0;
+                    quint32 v = 0;
+                    memcpy(&v, &p, sizeof(quint32));
+                    return sizeof(Pixel::U10_S) == sizeof(quint32) &&
+                        v == ((1u << 22) | (2u << 12) | (3u << 2));
+                }
+
+                //
+                // U8 -> F32
+                //
+
+                void u8ToF32(const void * in, void * out, int size, int channels, bool)
+                {
+                    const Pixel::U8_T * inP = reinterpret_cast<const Pixel::U8_T *>(in);
+                    Pixel::F32_T * outP = reinterpret_cast<Pixel::F32_T *>(out);
+                    const int count = size * channels;
+                    const __m128i zero = _mm_setzero_si128();
+                    const __m128 scale = _mm_set1_ps(static_cast<float>(Pixel::u8Max));
+                    int i = 0;
+                    for (; i + 16 <= count; i += 16)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inP + i));
+                        const __m128i lo = _mm_unpacklo_epi8(v, zero);
+                        const __m128i hi = _mm_unpackhi_epi8(v, zero);
+                        _mm_storeu_ps(outP + i,      _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+                        _mm_storeu_ps(outP + i + 4,  _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+                        _mm_storeu_ps(outP + i + 8,  _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+                        _mm_storeu_ps(outP + i + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+                    }
+                    for (; i < count; ++i)
+                    {
+                        outP[i] = PIXEL_U8_TO_F32(inP[i]);
+                    }
+                }
+
+                _TARGET("avx2,f16c")
+                void u8ToF32AVX2(const void * in, void * out, int size, int channels, bool)
+                {
+                    const Pixel::U8_T * inP = reinterpret_cast<const Pixel::U8_T *>(in);
+                    Pixel::F32_T * outP = reinterpret_cast<Pixel::F32_T *>(out);
+                    const int count = size * channels;
+                    const __m256 scale = _mm256_set1_ps(static_cast<float>(Pixel::u8Max));
+                    int i = 0;
+                    for (; i + 16 <= count; i += 16)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inP + i));
+                        _mm256_storeu_ps(outP + i,     _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v)), scale));
+                        _mm256_storeu_ps(outP + i + 8, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8))), scale));
+                    }
+                    for (; i < count; ++i)
+                    {
+                        outP[i] = PIXEL_U8_TO_F32(inP[i]);
+                    }
+                }
+
+                //
+                // U16 -> F32, F16
+                //
+
+                void u16ToF32(const void * in, void * out, int size, int channels, bool)
+                {
+                    const Pixel::U16_T * inP = reinterpret_cast<const Pixel::U16_T *>(in);
+                    Pixel::F32_T * outP = reinterpret_cast<Pixel::F32_T *>(out);
+                    const int count = size * channels;
+                    const __m128i zero = _mm_setzero_si128();
+                    const __m128 scale = _mm_set1_ps(static_cast<float>(Pixel::u16Max));
+                    int i = 0;
+                    for (; i + 8 <= count; i += 8)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inP + i));
+                        _mm_storeu_ps(outP + i,     _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), scale));
+                        _mm_storeu_ps(outP + i + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), scale));
+                    }
+                    for (; i < count; ++i)
+                    {
+                        outP[i] = PIXEL_U16_TO_F32(inP[i]);
+                    }
+                }
+
+                _TARGET("avx2,f16c")
+                void u16ToF32AVX2(const void * in, void * out, int size, int channels, bool)
+                {
+                    const Pixel::U16_T * inP = reinterpret_cast<const Pixel::U16_T *>(in);
+                    Pixel::F32_T * outP = reinterpret_cast<Pixel::F32_T *>(out);
+                    const int count = size * channels;
+                    const __m256 scale = _mm256_set1_ps(static_cast<float>(Pixel::u16Max));
+                    int i = 0;
+                    for (; i + 8 <= count; i += 8)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inP + i));
+                        _mm256_storeu_ps(outP + i, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(v)), scale));
+                    }
+                    for (; i < count; ++i)
+                    {
+                        outP[i] = PIXEL_U16_TO_F32(inP[i]);
+                    }
+                }
+
+                _TARGET("avx2,f16c")
+                void u16ToF16AVX2(const void * in, void * out, int size, int channels, bool)
+                {
+                    const Pixel::U16_T * inP = reinterpret_cast<const Pixel::U16_T *>(in);
+                    Pixel::F16_T * outP = reinterpret_cast<Pixel::F16_T *>(out);
+                    const int count = size * channels;
+                    const __m256 scale = _mm256_set1_ps(static_cast<float>(Pixel::u16Max));
+                    int i = 0;
+                    for (; i + 8 <= count; i += 8)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inP + i));
+                        const __m256 f = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(v)), scale);
+                        _mm_storeu_si128(
+                            reinterpret_cast<__m128i *>(outP + i),
+                            _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+                    }
+                    for (; i < count; ++i)
+                    {
+                        outP[i] = PIXEL_U16_TO_F16(inP[i]);
+                    }
+                }
+
+                _TARGET("f16c")
+                void u16ToF16F16C(const void * in, void * out, int size, int channels, bool)
+                {
+                    const Pixel::U16_T * inP = reinterpret_cast<const Pixel::U16_T *>(in);
+                    Pixel::F16_T * outP = reinterpret_cast<Pixel::F16_T *>(out);
+                    const int count = size * channels;
+                    const __m128i zero = _mm_setzero_si128();
+                    const __m128 scale = _mm_set1_ps(static_cast<float>(Pixel::u16Max));
+                    int i = 0;
+                    for (; i + 8 <= count; i += 8)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inP + i));
+                        const __m128 lo = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), scale);
+                        const __m128 hi = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), scale);
+                        _mm_storeu_si128(
+                            reinterpret_cast<__m128i *>(outP + i),
+                            _mm_unpacklo_epi64(
+                                _mm_cvtps_ph(lo, _MM_FROUND_TO_NEAREST_INT),
+                                _mm_cvtps_ph(hi, _MM_FROUND_TO_NEAREST_INT)));
+                    }
+                    for (; i < count; ++i)
+                    {
+                        outP[i] = PIXEL_U16_TO_F16(inP[i]);
+                    }
+                }
+
+                //
+                // F16 <-> F32
+                //
+
+                _TARGET("f16c")
+                void f16ToF32(const void * in, void * out, int size, int channels, bool)
+                {
+                    const Pixel::F16_T * inP = reinterpret_cast<const Pixel::F16_T *>(in);
+                    Pixel::F32_T * outP = reinterpret_cast<Pixel::F32_T *>(out);
+                    const int count = size * channels;
+                    int i = 0;
+                    for (; i + 8 <= count; i += 8)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inP + i));
+                        _mm256_storeu_ps(outP + i, _mm256_cvtph_ps(v));
+                    }
+                    for (; i < count; ++i)
+                    {
+                        outP[i] = PIXEL_F16_TO_F32(inP[i]);
+                    }
+                }
+
+                _TARGET("f16c")
+                void f32ToF16(const void * in, void * out, int size, int channels, bool)
+                {
+                    const Pixel::F32_T * inP = reinterpret_cast<const Pixel::F32_T *>(in);
+                    Pixel::F16_T * outP = reinterpret_cast<Pixel::F16_T *>(out);
+                    const int count = size * channels;
+                    int i = 0;
+                    for (; i + 8 <= count; i += 8)
+                    {
+                        _mm_storeu_si128(
+                            reinterpret_cast<__m128i *>(outP + i),
+                            _mm256_cvtps_ph(_mm256_loadu_ps(inP + i), _MM_FROUND_TO_NEAREST_INT));
+                    }
+                    for (; i < count; ++i)
+                    {
+                        outP[i] = PIXEL_F32_TO_F16(inP[i]);
+                    }
+                }
+
+                //
+                // RGB_U10 -> RGB_U16, RGB_F16, RGB_F32
+                //
+                // Four pixels are unpacked into planar vectors and transposed
+                // back to [r g b 0] vectors. The vectors are stored with
+                // overlapping writes, so each loop iteration requires one more
+                // pixel past the four it converts.
+                //
+
+                inline void u10Unpack(
+                    const quint32 * in,
+                    float           scale,
+                    bool            bgr,
+                    __m128 &        p0,
+                    __m128 &        p1,
+                    __m128 &        p2,
+                    __m128 &        p3)
+                {
+                    const __m128i mask = _mm_set1_epi32(Pixel::u10Max);
+                    const __m128 u10Max = _mm_set1_ps(static_cast<float>(Pixel::u10Max));
+                    const __m128 outMax = _mm_set1_ps(scale);
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+                    const __m128 r = _mm_mul_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(v, 22), mask)), u10Max), outMax);
+                    const __m128 g = _mm_mul_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(v, 12), mask)), u10Max), outMax);
+                    const __m128 b = _mm_mul_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(v, 2), mask)), u10Max), outMax);
+                    p0 = bgr ? b : r;
+                    p1 = g;
+                    p2 = bgr ? r : b;
+                    p3 = _mm_setzero_ps();
+                    _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+                }
+
+                void u10ToF32(const void * in, void * out, int size, int, bool bgr)
+                {
+                    const quint32 * inP = reinterpret_cast<const quint32 *>(in);
+                    Pixel::F32_T * outP = reinterpret_cast<Pixel::F32_T *>(out);
+                    int i = 0;
+                    for (; i + 5 <= size; i += 4, inP += 4, outP += 12)
+                    {
+                        __m128 p0, p1, p2, p3;
+                        u10Unpack(inP, 1.f, bgr, p0, p1, p2, p3);
+                        _mm_storeu_ps(outP,     p0);
+                        _mm_storeu_ps(outP + 3, p1);
+                        _mm_storeu_ps(outP + 6, p2);
+                        _mm_storeu_ps(outP + 9, p3);
+                    }
+                    const Pixel::U10_S * u10P = reinterpret_cast<const Pixel::U10_S *>(inP);
+                    for (; i < size; ++i, ++u10P, outP += 3)
+                    {
+                        outP[0] = PIXEL_U10_TO_F32(bgr ? u10P->b : u10P->r);
+                        outP[1] = PIXEL_U10_TO_F32(u10P->g);
+                        outP[2] = PIXEL_U10_TO_F32(bgr ? u10P->r : u10P->b);
+                    }
+                }
+
+                void u10ToU16(const void * in, void * out, int size, int, bool bgr)
+                {
+                    const quint32 * inP = reinterpret_cast<const quint32 *>(in);
+                    Pixel::U16_T * outP = reinterpret_cast<Pixel::U16_T *>(out);
+
+                    // Offset the values so they can be packed with signed saturation.
+                    const __m128i offset32 = _mm_set1_epi32(32768);
+                    const __m128i offset16 = _mm_set1_epi16(static_cast<short>(0x8000));
+                    int i = 0;
+                    for (; i + 5 <= size; i += 4, inP += 4, outP += 12)
+                    {
+                        __m128 p0, p1, p2, p3;
+                        u10Unpack(inP, static_cast<float>(Pixel::u16Max), bgr, p0, p1, p2, p3);
+                        const __m128i p01 = _mm_xor_si128(
+                            _mm_packs_epi32(
+                                _mm_sub_epi32(_mm_cvttps_epi32(p0), offset32),
+                                _mm_sub_epi32(_mm_cvttps_epi32(p1), offset32)),
+                            offset16);
+                        const __m128i p23 = _mm_xor_si128(
+                            _mm_packs_epi32(
+                                _mm_sub_epi32(_mm_cvttps_epi32(p2), offset32),
+                                _mm_sub_epi32(_mm_cvttps_epi32(p3), offset32)),
+                            offset16);
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP),     p01);
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP + 3), _mm_srli_si128(p01, 8));
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP + 6), p23);
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP + 9), _mm_srli_si128(p23, 8));
+                    }
+                    const Pixel::U10_S * u10P = reinterpret_cast<const Pixel::U10_S *>(inP);
+                    for (; i < size; ++i, ++u10P, outP += 3)
+                    {
+                        outP[0] = PIXEL_U10_TO_U16(bgr ? u10P->b : u10P->r);
+                        outP[1] = PIXEL_U10_TO_U16(u10P->g);
+                        outP[2] = PIXEL_U10_TO_U16(bgr ? u10P->r : u10P->b);
+                    }
+                }
+
+                _TARGET("f16c")
+                void u10ToF16(const void * in, void * out, int size, int, bool bgr)
+                {
+                    const quint32 * inP = reinterpret_cast<const quint32 *>(in);
+                    Pixel::F16_T * outP = reinterpret_cast<Pixel::F16_T *>(out);
+                    int i = 0;
+                    for (; i + 5 <= size; i += 4, inP += 4, outP += 12)
+                    {
+                        __m128 p0, p1, p2, p3;
+                        u10Unpack(inP, 1.f, bgr, p0, p1, p2, p3);
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP),     _mm_cvtps_ph(p0, _MM_FROUND_TO_NEAREST_INT));
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP + 3), _mm_cvtps_ph(p1, _MM_FROUND_TO_NEAREST_INT));
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP + 6), _mm_cvtps_ph(p2, _MM_FROUND_TO_NEAREST_INT));
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP + 9), _mm_cvtps_ph(p3, _MM_FROUND_TO_NEAREST_INT));
+                    }
+                    const Pixel::U10_S * u10P = reinterpret_cast<const Pixel::U10_S *>(inP);
+                    for (; i < size; ++i, ++u10P, outP += 3)
+                    {
+                        outP[0] = PIXEL_U10_TO_F16(bgr ? u10P->b : u10P->r);
+                        outP[1] = PIXEL_U10_TO_F16(u10P->g);
+                        outP[2] = PIXEL_U10_TO_F16(bgr ? u10P->r : u10P->b);
+                    }
+                }
+
+                //
+                // BGR swizzles
+                //
+
+                void bgraU8(const void * in, void * out, int size, int, bool)
+                {
+                    const Pixel::U8_T * inP = reinterpret_cast<const Pixel::U8_T *>(in);
+                    Pixel::U8_T * outP = reinterpret_cast<Pixel::U8_T *>(out);
+                    const __m128i maskGA = _mm_set1_epi32(static_cast<int>(0xff00ff00));
+                    const __m128i maskR  = _mm_set1_epi32(0x000000ff);
+                    int i = 0;
+                    for (; i + 4 <= size; i += 4, inP += 16, outP += 16)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inP));
+                        _mm_storeu_si128(
+                            reinterpret_cast<__m128i *>(outP),
+                            _mm_or_si128(
+                                _mm_and_si128(v, maskGA),
+                                _mm_or_si128(
+                                    _mm_and_si128(_mm_srli_epi32(v, 16), maskR),
+                                    _mm_slli_epi32(_mm_and_si128(v, maskR), 16))));
+                    }
+                    for (; i < size; ++i, inP += 4, outP += 4)
+                    {
+                        const Pixel::U8_T tmp = inP[0];
+                        outP[0] = inP[2];
+                        outP[1] = inP[1];
+                        outP[2] = tmp;
+                        outP[3] = inP[3];
+                    }
+                }
+
+                _TARGET("avx2,f16c")
+                void bgraU8AVX2(const void * in, void * out, int size, int, bool)
+                {
+                    const Pixel::U8_T * inP = reinterpret_cast<const Pixel::U8_T *>(in);
+                    Pixel::U8_T * outP = reinterpret_cast<Pixel::U8_T *>(out);
+                    const __m256i shuffle = _mm256_setr_epi8(
+                        2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                        2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+                    int i = 0;
+                    for (; i + 8 <= size; i += 8, inP += 32, outP += 32)
+                    {
+                        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(inP));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(outP), _mm256_shuffle_epi8(v, shuffle));
+                    }
+                    for (; i < size; ++i, inP += 4, outP += 4)
+                    {
+                        const Pixel::U8_T tmp = inP[0];
+                        outP[0] = inP[2];
+                        outP[1] = inP[1];
+                        outP[2] = tmp;
+                        outP[3] = inP[3];
+                    }
+                }
+
+                // Five pixels are swizzled per loop iteration; the sixteenth
+                // byte is the first byte of the next pixel and is rewritten
+                // by the next iteration.
+                _TARGET("avx2,f16c")
+                void bgrU8AVX2(const void * in, void * out, int size, int, bool)
+                {
+                    const Pixel::U8_T * inP = reinterpret_cast<const Pixel::U8_T *>(in);
+                    Pixel::U8_T * outP = reinterpret_cast<Pixel::U8_T *>(out);
+                    const __m128i shuffle = _mm_setr_epi8(
+                        2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+                    int i = 0;
+                    for (; i + 6 <= size; i += 5, inP += 15, outP += 15)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inP));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(outP), _mm_shuffle_epi8(v, shuffle));
+                    }
+                    for (; i < size; ++i, inP += 3, outP += 3)
+                    {
+                        const Pixel::U8_T tmp = inP[0];
+                        outP[0] = inP[2];
+                        outP[1] = inP[1];
+                        outP[2] = tmp;
+                    }
+                }
+
+                // This is used for both RGBA_U16 and RGBA_F16 since the
+                // channels are only moved.
+                void bgra16(const void * in, void * out, int size, int, bool)
+                {
+                    const quint16 * inP = reinterpret_cast<const quint16 *>(in);
+                    quint16 * outP = reinterpret_cast<quint16 *>(out);
+                    int i = 0;
+                    for (; i + 2 <= size; i += 2, inP += 8, outP += 8)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inP));
+                        _mm_storeu_si128(
+                            reinterpret_cast<__m128i *>(outP),
+                            _mm_shufflehi_epi16(
+                                _mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 0, 1, 2)),
+                                _MM_SHUFFLE(3, 0, 1, 2)));
+                    }
+                    for (; i < size; ++i, inP += 4, outP += 4)
+                    {
+                        const quint16 tmp = inP[0];
+                        outP[0] = inP[2];
+                        outP[1] = inP[1];
+                        outP[2] = tmp;
+                        outP[3] = inP[3];
+                    }
+                }
+
+                void bgraF32(const void * in, void * out, int size, int, bool)
+                {
+                    const Pixel::F32_T * inP = reinterpret_cast<const Pixel::F32_T *>(in);
+                    Pixel::F32_T * outP = reinterpret_cast<Pixel::F32_T *>(out);
+                    for (int i = 0; i < size; ++i, inP += 4, outP += 4)
+                    {
+                        const __m128 v = _mm_loadu_ps(inP);
+                        _mm_storeu_ps(outP, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 1, 2)));
+                    }
+                }
+
+#endif // DJV_PIXEL_SIMD
+
+                class Table
+                {
+                public:
+                    Table()
+                    {
+                        for (int i = 0; i < Pixel::PIXEL_COUNT; ++i)
+                        {
+                            for (int j = 0; j < Pixel::PIXEL_COUNT; ++j)
+                            {
+                                _kernels[i][j][0] = nullptr;
+                                _kernels[i][j][1] = nullptr;
+                            }
+                        }
+#if defined(DJV_PIXEL_SIMD)
+                        const CPU cpu;
+
+                        // Conversions between types, the channels are converted
+                        // in order so only luminance may be swizzled.
+                        const Pixel::FORMAT formats[] = { Pixel::L, Pixel::LA, Pixel::RGB, Pixel::RGBA };
+                        for (const auto format : formats)
+                        {
+                            _type(format, Pixel::U8, Pixel::F32, cpu.avx2 ? u8ToF32AVX2 : u8ToF32);
+                            _type(format, Pixel::U16, Pixel::F32, cpu.avx2 ? u16ToF32AVX2 : u16ToF32);
+                            if (cpu.f16c)
+                            {
+                                _type(format, Pixel::U16, Pixel::F16, cpu.avx2 ? u16ToF16AVX2 : u16ToF16F16C);
+                                _type(format, Pixel::F16, Pixel::F32, f16ToF32);
+                                _type(format, Pixel::F32, Pixel::F16, f32ToF16);
+                            }
+                        }
+
+                        // 10-bit conversions.
+                        if (isU10Supported())
+                        {
+                            for (int bgr = 0; bgr < 2; ++bgr)
+                            {
+                                _kernels[Pixel::RGB_U10][Pixel::RGB_U16][bgr] = u10ToU16;
+                                _kernels[Pixel::RGB_U10][Pixel::RGB_F32][bgr] = u10ToF32;
+                                if (cpu.f16c)
+                                {
+                                    _kernels[Pixel::RGB_U10][Pixel::RGB_F16][bgr] = u10ToF16;
+                                }
+                            }
+                        }
+
+                        // BGR swizzles.
+                        _kernels[Pixel::RGBA_U8][Pixel::RGBA_U8][1] = cpu.avx2 ? bgraU8AVX2 : bgraU8;
+                        if (cpu.avx2)
+                        {
+                            _kernels[Pixel::RGB_U8][Pixel::RGB_U8][1] = bgrU8AVX2;
+                        }
+                        _kernels[Pixel::RGBA_U16][Pixel::RGBA_U16][1] = bgra16;
+                        _kernels[Pixel::RGBA_F16][Pixel::RGBA_F16][1] = bgra16;
+                        _kernels[Pixel::RGBA_F32][Pixel::RGBA_F32][1] = bgraF32;
+#endif // DJV_PIXEL_SIMD
+                    }
+
+                    Kernel * kernel(Pixel::PIXEL in, Pixel::PIXEL out, bool bgr) const
+                    {
+                        return _kernels[in][out][bgr ? 1 : 0];
+                    }
+
+                private:
+                    void _type(Pixel::FORMAT format, Pixel::TYPE in, Pixel::TYPE out, Kernel * kernel)
+                    {
+                        const Pixel::PIXEL inPixel = Pixel::pixel(format, in);
+                        const Pixel::PIXEL outPixel = Pixel::pixel(format, out);
+                        _kernels[inPixel][outPixel][0] = kernel;
+                        if (Pixel::L == format || Pixel::LA == format)
+                        {
+                            _kernels[inPixel][outPixel][1] = kernel;
+                        }
+                    }
+
+                    Kernel * _kernels[Pixel::PIXEL_COUNT][Pixel::PIXEL_COUNT][2];
+                };
+
+            } // namespace
+
+            Kernel * kernel(Pixel::PIXEL in, Pixel::PIXEL out, bool bgr)
+            {
+                static const Table table;
+                return table.kernel(in, out, bgr);
+            }
+
+        } // namespace PixelConvertSIMD
+    } // namespace AV
+} // namespace djv
@@ -34,6 +34,7 @@
 #include <djvCore/Assert.h>
 #include <djvCore/Debug.h>
 #include <djvCore/FileIO.h>
+#include <djvCore/MemoryPool.h>
 #include <djvCore/StringUtil.h>
 
 #include <QCoreApplication>
@@ -129,12 +130,14 @@ namespace djv
         PixelData::~PixelData()
         {
             delete _fileIo;
+            dealloc();
         }
 
         void PixelData::zero()
         {
             //DJV_DEBUG("PixelData::zero");
-            memset(_data.data(), 0, _dataByteCount);
+            detach();
+            memset(_data, 0, _dataByteCount);
         }
 
         void PixelData::close()
@@ -145,7 +148,7 @@ namespace djv
                 delete _fileIo;
                 _info = PixelDataInfo();
                 _channels = 0;
-                _data.resize(0);
+                dealloc();
                 _p = nullptr;
                 _pixelByteCount = 0;
                 _scanlineByteCount = 0;
@@ -167,9 +170,9 @@ namespace djv
         {
             if (_fileIo)
             {
-                _data.resize(_dataByteCount);
-                memcpy(_data.data(), _p, _dataByteCount);
-                _p = _data.data();
+                alloc(_dataByteCount);
+                memcpy(_data, _p, _dataByteCount);
+                _p = _data;
                 delete _fileIo;
                 _fileIo = 0;
             }
@@ -201,28 +204,51 @@ namespace djv
             {
                 if (fileIo)
                 {
-                    _data.resize(0);
+                    dealloc();
                     _p = p;
                     _fileIo = fileIo;
                 }
                 else
                 {
-                    _data.resize(_dataByteCount);
-                    _p = _data.data();
-                    memcpy(_data.data(), p, _dataByteCount);
+                    alloc(_dataByteCount);
+                    _p = _data;
+                    memcpy(_data, p, _dataByteCount);
                 }
             }
             else
             {
-                _data.resize(_dataByteCount);
-                _p = _data.data();
+                alloc(_dataByteCount);
+                _p = _data;
             }
         }
 
         void PixelData::copy(const PixelData & in)
         {
             set(in._info);
-            memcpy(_data.data(), in._p, _dataByteCount);
+            memcpy(_data, in._p, _dataByteCount);
+        }
+
+        void PixelData::alloc(quint64 size)
+        {
+            // Keep the current block if it is in the same size class.
+            if (_data && Core::MemoryPool::sizeClass(size) == Core::MemoryPool::sizeClass(_allocByteCount))
+            {
+                _allocByteCount = size;
+                return;
+            }
+            dealloc();
+            if (size)
+            {
+                _data = Core::MemoryPool::allocate(size);
+                _allocByteCount = size;
+            }
+        }
+
+        void PixelData::dealloc()
+        {
+            Core::MemoryPool::release(_data, _allocByteCount);
+            _data = nullptr;
+            _allocByteCount = 0;
         }
 
         bool PixelData::operator == (const AV::PixelData & other) const
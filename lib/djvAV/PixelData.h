@@ -124,6 +124,9 @@ namespace djv
         };
 
         //! This class provides pixel data.
+        //!
+        //! The data is allocated from Core::MemoryPool, so it is aligned and not
+        //! initialized. Use zero() to clear the data.
         class PixelData
         {
         public:
@@ -195,10 +198,13 @@ namespace djv
         private:
             void detach();
             void copy(const PixelData &);
+            void alloc(quint64);
+            void dealloc();
 
             PixelDataInfo       _info;
             int                 _channels = 0;
-            std::vector<quint8> _data;
+            quint8 *            _data = nullptr;
+            quint64             _allocByteCount = 0;
             const quint8 *      _p = nullptr;
             quint64             _pixelByteCount = 0;
             quint64             _scanlineByteCount = 0;
@@ -119,7 +119,7 @@ namespace djv
         {
             detach();
 
-            return _data.data();
+            return _data;
         }
 
         inline const quint8 * PixelData::data() const
@@ -130,7 +130,7 @@ namespace djv
         inline quint8 * PixelData::data(int x, int y)
         {
             detach();
-            return _data.data() + (y * _info.size.x + x) * _pixelByteCount;
+            return _data + (y * _info.size.x + x) * _pixelByteCount;
         }
 
         inline const quint8 * PixelData::data(int x, int y) const
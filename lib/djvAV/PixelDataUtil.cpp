@@ -159,6 +159,43 @@ namespace djv
                 Core::Math::ceil(in.size.y / static_cast<float>(scale)));
         }
 
+        void PixelDataUtil::crop(
+            const PixelData &   in,
+            PixelData &         out,
+            const Core::Box2i & box)
+        {
+            //DJV_DEBUG("PixelDataUtil::crop");
+            //DJV_DEBUG_PRINT("in = " << in);
+            //DJV_DEBUG_PRINT("box = " << box);
+            DJV_ASSERT(box.x >= 0 && box.x + box.w <= in.w());
+            DJV_ASSERT(box.y >= 0 && box.y + box.h <= in.h());
+            PixelDataInfo info = in.info();
+            info.size = box.size;
+            out.set(info);
+            const quint64 byteCount = box.w * in.pixelByteCount();
+            for (int y = 0; y < box.h; ++y)
+            {
+                memcpy(out.data(0, y), in.data(box.x, box.y + y), byteCount);
+            }
+        }
+
+        Core::Box2i PixelDataUtil::mirror(
+            const Core::Box2i &           box,
+            const glm::ivec2 &            size,
+            const PixelDataInfo::Mirror & mirror)
+        {
+            Core::Box2i out = box;
+            if (mirror.x)
+            {
+                out.x = size.x - box.x - box.w;
+            }
+            if (mirror.y)
+            {
+                out.y = size.y - box.y - box.h;
+            }
+            return out;
+        }
+
         void PixelDataUtil::planarInterleave(
             const PixelData &    in,
             PixelData &          out,
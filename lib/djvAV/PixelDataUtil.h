@@ -63,6 +63,21 @@ namespace djv
             //! Calculate the size of a proxy scale.
             static Core::Box2i proxyScale(const Core::Box2i &, PixelDataInfo::PROXY);
 
+            //! Crop pixel data. The output is set to the size of the box, which
+            //! must be inside of the input.
+            static void crop(
+                const PixelData &,
+                PixelData &,
+                const Core::Box2i &);
+
+            //! Mirror a box inside of pixel data of the given size. This
+            //! converts between display coordinates and pixel data
+            //! coordinates.
+            static Core::Box2i mirror(
+                const Core::Box2i &,
+                const glm::ivec2 &,
+                const PixelDataInfo::Mirror &);
+
             //! Interleave pixel data channels.
             static void planarInterleave(
                 const PixelData &,
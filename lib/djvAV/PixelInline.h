@@ -29,6 +29,8 @@
 
 #include <djvCore/Math.h>
 
+#include <vector>
+
 namespace djv
 {
     namespace AV
@@ -353,17 +355,19 @@ namespace djv
 
         // Note that we use a LUT in some cases because bit shifting doesn't seem to
         // preserve maximum values?
+        //
+        // The LUT is a function-local static so that it is initialized once in
+        // a thread-safe manner; conversions are called from multiple threads.
 #define _PIXEL_LUT(IN, OUT, IN_MAX, OUT_MAX) \
-    static OUT##_T lut [IN_MAX + 1]; \
-    static bool init = false; \
-    if (! init) \
+    static const std::vector<OUT##_T> lut = [] \
     { \
+        std::vector<OUT##_T> out(IN_MAX + 1); \
         for (int i = 0; i <= IN_MAX; ++i) \
         { \
-            lut[i] = OUT##_T(i / static_cast<float>(IN_MAX) * OUT_MAX); \
+            out[i] = OUT##_T(i / static_cast<float>(IN_MAX) * OUT_MAX); \
         } \
-        init = true; \
-    } \
+        return out; \
+    }(); \
     return lut[in];
 
         inline Pixel::U10_T Pixel::u8ToU10(U8_T in)
@@ -52,6 +52,16 @@ namespace djv
         RLALoad::~RLALoad()
         {}
 
+        RLALoad::RLALoad(const RLALoad & other) :
+            Load(other),
+            _rleOffset(other._rleOffset)
+        {}
+
+        std::unique_ptr<Load> RLALoad::clone() const
+        {
+            return std::unique_ptr<Load>(new RLALoad(*this));
+        }
+
         void RLALoad::read(Image & image, const ImageIOInfo & frame)
         {
             //DJV_DEBUG("RLALoad::read");
@@ -77,6 +87,7 @@ namespace djv
             io.readAhead();
             PixelData * p = frame.proxy ? &_tmp : &image;
             p->set(_info);
+            p->zero();
             const int w = _info.size.x;
             const int h = _info.size.y;
             const int channels = Pixel::channels(_info.pixel);
@@ -44,9 +44,13 @@ namespace djv
             explicit RLALoad(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             ~RLALoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
+            RLALoad(const RLALoad &);
+
             void _open(const QString &, IOInfo &, Core::FileIO &);
 
             std::vector<qint32> _rleOffset;
@@ -52,6 +52,18 @@ namespace djv
         SGILoad::~SGILoad()
         {}
 
+        SGILoad::SGILoad(const SGILoad & other) :
+            Load(other),
+            _compression(other._compression),
+            _rleOffset(other._rleOffset),
+            _rleSize(other._rleSize)
+        {}
+
+        std::unique_ptr<Load> SGILoad::clone() const
+        {
+            return std::unique_ptr<Load>(new SGILoad(*this));
+        }
+
         void SGILoad::read(Image & image, const ImageIOInfo & frame)
         {
             //DJV_DEBUG("SGILoad::read");
@@ -68,12 +80,19 @@ namespace djv
             _open(fileName, info, io);
 
             // Read the file.
-            io.readAhead();
             const quint64 pos = io.pos();
             const quint64 size = io.size() - pos;
             auto pixelDataInfo = info.layers[0];
             const int channels = Pixel::channels(pixelDataInfo.pixel);
             const int bytes = Pixel::channelByteCount(pixelDataInfo.pixel);
+            const Core::Box2i region = Load::region(frame, pixelDataInfo.size);
+            //DJV_DEBUG_PRINT("region = " << region);
+            if (region.size != pixelDataInfo.size)
+            {
+                _readRegion(image, pixelDataInfo, region, io);
+                return;
+            }
+            io.readAhead();
             if (!_compression)
             {
                 if (1 == bytes)
@@ -97,6 +116,7 @@ namespace djv
             else
             {
                 _tmp.set(pixelDataInfo);
+                _tmp.zero();
                 std::vector<quint8> tmp(size);
                 io.get(tmp.data(), size / bytes, bytes);
                 const quint8 * inP = tmp.data();
@@ -133,6 +153,67 @@ namespace djv
             //DJV_DEBUG_PRINT("image = " << image);
         }
 
+        void SGILoad::_readRegion(
+            Image &               image,
+            const PixelDataInfo & info,
+            const Core::Box2i &   region,
+            Core::FileIO &        io)
+        {
+            //DJV_DEBUG("SGILoad::_readRegion");
+            //DJV_DEBUG_PRINT("region = " << region);
+
+            // The channels are stored in separate planes. Only the rows of the
+            // planes that are in the region are read, using the scanline
+            // tables for compressed files.
+            const quint64 pos = io.pos();
+            const int channels = Pixel::channels(info.pixel);
+            const int bytes = Pixel::channelByteCount(info.pixel);
+            const quint64 rowByteCount = info.size.x * bytes;
+            const quint64 regionByteCount = region.w * bytes;
+            PixelDataInfo regionInfo(info);
+            regionInfo.size = region.size;
+            _tmp.set(regionInfo);
+            _tmp.zero();
+            quint8 * outP = _tmp.data();
+            std::vector<quint8> rle;
+            std::vector<quint8> row(rowByteCount);
+            for (int c = 0; c < channels; ++c)
+            {
+                for (int y = region.y; y < region.y + region.h; ++y, outP += regionByteCount)
+                {
+                    if (!_compression)
+                    {
+                        io.setPos(pos + (static_cast<quint64>(c) * info.size.y + y) * rowByteCount + region.x * bytes);
+                        io.get(outP, region.w, bytes);
+                    }
+                    else
+                    {
+                        const int i = y + info.size.y * c;
+                        rle.resize(_rleSize[i]);
+                        io.setPos(_rleOffset[i]);
+                        io.get(rle.data(), _rleSize[i] / bytes, bytes);
+                        if (!SGI::readRle(
+                            rle.data(),
+                            rle.data() + rle.size(),
+                            row.data(),
+                            info.size.x,
+                            bytes,
+                            io.endian()))
+                        {
+                            throw Core::Error(
+                                SGI::staticName,
+                                IOPlugin::errorLabels()[IOPlugin::ERROR_READ]);
+                        }
+                        memcpy(outP, row.data() + region.x * bytes, regionByteCount);
+                    }
+                }
+            }
+
+            // Interleave the image channels.
+            image.set(regionInfo);
+            PixelDataUtil::planarInterleave(_tmp, image);
+        }
+
         void SGILoad::_open(const QString & in, IOInfo & info, Core::FileIO & io)
         {
             //DJV_DEBUG("SGILoad::_open");
@@ -43,10 +43,15 @@ namespace djv
             explicit SGILoad(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             ~SGILoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
+            SGILoad(const SGILoad &);
+
             void _open(const QString &, IOInfo &, Core::FileIO &);
+            void _readRegion(Image &, const PixelDataInfo &, const Core::Box2i &, Core::FileIO &);
 
             bool                 _compression = false;
             std::vector<quint32> _rleOffset;
@@ -60,6 +60,11 @@ namespace djv
                 ".bw";
         }
 
+        bool SGIPlugin::canReadRegion() const
+        {
+            return true;
+        }
+
         QStringList SGIPlugin::option(const QString & in) const
         {
             QStringList out;
@@ -97,7 +97,7 @@ namespace djv
             {
                 //DJV_DEBUG_PRINT("convert = " << _image);
                 _image.zero();
-                OpenGLImage().copy(in, _image);
+                openGLImage().copy(in, _image);
                 p = &_image;
             }
             _tmp.set(p->info());
@@ -54,6 +54,17 @@ namespace djv
             _close();
         }
 
+        TIFFLoad::TIFFLoad(const TIFFLoad & other) :
+            Load(other),
+            _compression(other._compression),
+            _palette(other._palette)
+        {}
+
+        std::unique_ptr<Load> TIFFLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new TIFFLoad(*this));
+        }
+
         void TIFFLoad::read(Image & image, const ImageIOInfo & frame)
         {
             //DJV_DEBUG("TIFFLoad::read");
@@ -69,13 +80,32 @@ namespace djv
             _open(fileName, info);
             image.tags = info.tags;
 
-            // Read the file.
-            auto data = frame.proxy ? &_tmp : &image;
+            // Read the file. When a region is requested only the scanlines in
+            // the region are read, and libtiff only decodes the strips that
+            // contain them.
             auto pixelDataInfo = info.layers[0];
-            data->set(pixelDataInfo);
-            for (int y = 0; y < pixelDataInfo.size.y; ++y)
+            const Core::Box2i region = Load::region(frame, pixelDataInfo.size);
+            const bool crop = region.size != pixelDataInfo.size;
+            //DJV_DEBUG_PRINT("region = " << region);
+            auto data = frame.proxy ? &_tmp : &image;
+            std::vector<quint8> scanline;
+            if (crop)
             {
-                if (TIFFReadScanline(_f, (tdata_t *)data->data(0, y), y) == -1)
+                PixelDataInfo regionInfo(pixelDataInfo);
+                regionInfo.size = region.size;
+                data->set(regionInfo);
+                data->zero();
+                scanline.resize(PixelDataUtil::scanlineByteCount(pixelDataInfo));
+            }
+            else
+            {
+                data->set(pixelDataInfo);
+                data->zero();
+            }
+            for (int y = region.y; y < region.y + region.h; ++y)
+            {
+                quint8 * p = crop ? scanline.data() : data->data(0, y);
+                if (TIFFReadScanline(_f, (tdata_t *)p, y) == -1)
                 {
                     throw Core::Error(
                         TIFF::staticName,
@@ -84,11 +114,18 @@ namespace djv
                 if (_palette)
                 {
                     TIFF::paletteLoad(
-                        data->data(0, y),
+                        p,
                         pixelDataInfo.size.x,
                         Pixel::channelByteCount(pixelDataInfo.pixel),
                         _colormap[0], _colormap[1], _colormap[2]);
                 }
+                if (crop)
+                {
+                    memcpy(
+                        data->data(0, y - region.y),
+                        p + region.x * Pixel::byteCount(pixelDataInfo.pixel),
+                        region.w * Pixel::byteCount(pixelDataInfo.pixel));
+                }
             }
 
             // Proxy scaling.
@@ -44,9 +44,13 @@ namespace djv
             explicit TIFFLoad(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             ~TIFFLoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &)  override;
 
         private:
+            TIFFLoad(const TIFFLoad &);
+
             void _open(const QString &, IOInfo &);
             void _close();
 
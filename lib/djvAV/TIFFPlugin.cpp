@@ -64,6 +64,11 @@ namespace djv
                 ".tif";
         }
 
+        bool TIFFPlugin::canReadRegion() const
+        {
+            return true;
+        }
+
         QStringList TIFFPlugin::option(const QString & in) const
         {
             QStringList out;
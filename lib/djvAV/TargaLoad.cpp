@@ -52,6 +52,16 @@ namespace djv
         TargaLoad::~TargaLoad()
         {}
 
+        TargaLoad::TargaLoad(const TargaLoad & other) :
+            Load(other),
+            _compression(other._compression)
+        {}
+
+        std::unique_ptr<Load> TargaLoad::clone() const
+        {
+            return std::unique_ptr<Load>(new TargaLoad(*this));
+        }
+
         void TargaLoad::read(Image & image, const ImageIOInfo & frame)
         {
             //DJV_DEBUG("TargaLoad::read");
@@ -67,10 +77,18 @@ namespace djv
             QScopedPointer<Core::FileIO> io(new Core::FileIO);
             _open(fileName, info, *io);
 
-            // Read the file.
-            io->readAhead();
-            PixelData * data = frame.proxy ? &_tmp : &image;
+            // Read the file. Uncompressed files are memory mapped so only the
+            // pages with the region are touched, compressed files are decoded
+            // up to the last row of the region.
             auto pixelDataInfo = info.layers[0];
+            const Core::Box2i region = Load::region(frame, pixelDataInfo.size);
+            const bool crop = region.size != pixelDataInfo.size;
+            //DJV_DEBUG_PRINT("region = " << region);
+            if (!crop)
+            {
+                io->readAhead();
+            }
+            PixelData * data = (frame.proxy || crop) ? &_tmp : &image;
             if (!_compression)
             {
                 if ((io->size() - io->pos()) < PixelDataUtil::dataByteCount(pixelDataInfo))
@@ -85,10 +103,12 @@ namespace djv
             else
             {
                 data->set(pixelDataInfo);
+                data->zero();
                 const quint8 * p = io->mmapP();
                 const quint8 * const end = io->mmapEnd();
                 const int channels = Pixel::channels(pixelDataInfo.pixel);
-                for (int y = 0; y < pixelDataInfo.size.y; ++y)
+                const int rows = region.y + region.h;
+                for (int y = 0; y < rows; ++y)
                 {
                     //DJV_DEBUG_PRINT("y = " << y);
                     p = Targa::readRle(
@@ -114,6 +134,10 @@ namespace djv
                 image.set(pixelDataInfo);
                 PixelDataUtil::proxyScale(_tmp, image, frame.proxy);
             }
+            else if (crop)
+            {
+                PixelDataUtil::crop(_tmp, image, region);
+            }
 
             //DJV_DEBUG_PRINT("image = " << image);
         }
@@ -43,9 +43,13 @@ namespace djv
             explicit TargaLoad(const Core::FileInfo &, const QPointer<Core::CoreContext> &);
             ~TargaLoad() override;
 
+            std::unique_ptr<Load> clone() const override;
+
             void read(Image &, const ImageIOInfo &) override;
 
         private:
+            TargaLoad(const TargaLoad &);
+
             void _open(const QString &, IOInfo &, Core::FileIO &);
 
             bool      _compression = false;
@@ -56,6 +56,11 @@ namespace djv
             return QStringList() << ".tga";
         }
 
+        bool TargaPlugin::canReadRegion() const
+        {
+            return true;
+        }
+
         QStringList TargaPlugin::option(const QString & in) const
         {
             QStringList out;
@@ -400,6 +400,38 @@ namespace djv
 #endif // DJV_MMAP
         }
 
+        void FileIO::readAhead(quint64 pos, quint64 size)
+        {
+            if (pos >= _p->size)
+                return;
+            size = Math::min(size, _p->size - pos);
+#if defined(DJV_MMAP)
+#if defined(DJV_LINUX)
+            // The address must be aligned to a page.
+            static const quint64 pageSize = ::sysconf(_SC_PAGESIZE);
+            const quint64 start = pos / pageSize * pageSize;
+            ::madvise((void *)(_p->mmapStart + start), pos + size - start, MADV_WILLNEED);
+#endif // DJV_LINUX
+#else // DJV_MMAP
+#if defined(DJV_LINUX)
+            ::posix_fadvise(_p->f, pos, size, POSIX_FADV_WILLNEED);
+#endif // DJV_LINUX
+#endif // DJV_MMAP
+        }
+
+        void FileIO::setRandomAccess()
+        {
+#if defined(DJV_MMAP)
+#if defined(DJV_LINUX)
+            ::madvise((void *)_p->mmapStart, _p->size, MADV_RANDOM);
+#endif // DJV_LINUX
+#else // DJV_MMAP
+#if defined(DJV_LINUX)
+            ::posix_fadvise(_p->f, 0, _p->size, POSIX_FADV_RANDOM);
+#endif // DJV_LINUX
+#endif // DJV_MMAP
+        }
+
         const quint8 * FileIO::mmapP() const
         {
             return _p->mmapP;
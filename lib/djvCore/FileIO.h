@@ -113,6 +113,14 @@ namespace djv
             //! cache the file by the time we need it.
             void readAhead();
 
+            //! Start an asynchronous read-ahead of part of the file, given as a
+            //! byte offset and size.
+            void readAhead(quint64 pos, quint64 size);
+
+            //! Tell the operating system that the file will be read in a random
+            //! order, so that it does not read ahead of the accessed pages.
+            void setRandomAccess();
+
             //! Get the current memory-map position.
             const quint8 * mmapP() const;
 
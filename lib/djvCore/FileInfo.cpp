@@ -234,78 +234,122 @@ namespace djv
             _time = in;
         }
 
+        namespace
+        {
+            struct StatInfo
+            {
+                quint64 size        = 0;
+                uid_t   user        = 0;
+                int     permissions = 0;
+                time_t  time        = time_t();
+                bool    directory   = false;
+            };
+
+            bool statFile(const QString & fileName, StatInfo & out)
+            {
+                //DJV_DEBUG("statFile");
+                //DJV_DEBUG_PRINT("fileName = " << fileName);
+#if defined(DJV_WINDOWS)
+                struct ::_stati64 info;
+                Memory::fill<quint8>(0, &info, sizeof(struct ::_stati64));
+                if (::_wstati64(StringUtil::qToStdWString(fileName).data(), &info) != 0)
+                {
+                    QString err;
+                    char tmp[StringUtil::cStringLength] = "";
+                    ::strerror_s(tmp, StringUtil::cStringLength, errno);
+                    err = tmp;
+                    //DJV_DEBUG_PRINT("error = " << err);
+                    return false;
+                }
+#elif (defined(DJV_FREEBSD) || defined(DJV_OSX))
+                //! \todo OS X doesn't have stat64?
+                struct ::stat info;
+                Memory::fill<quint8>(0, &info, sizeof(struct ::stat));
+                if (::stat(fileName.toUtf8().data(), &info) != 0)
+                {
+                    return false;
+                }
+#else
+                struct ::stat64 info;
+                Memory::fill<quint8>(0, &info, sizeof(struct ::stat64));
+                if (::stat64(fileName.toUtf8().data(), &info) != 0)
+                {
+                    return false;
+                }
+#endif // DJV_WINDOWS
+
+                out.size = info.st_size;
+                out.user = info.st_uid;
+                out.time = info.st_mtime;
+                out.permissions = 0;
+
+                //DJV_DEBUG_PRINT("size = " << out.size);
+
+#if defined(DJV_WINDOWS)
+                out.directory = (info.st_mode & _S_IFDIR) != 0;
+                out.permissions |= (info.st_mode & _S_IREAD) ? FileInfo::READ : 0;
+                out.permissions |= (info.st_mode & _S_IWRITE) ? FileInfo::WRITE : 0;
+                out.permissions |= (info.st_mode & _S_IEXEC) ? FileInfo::EXEC : 0;
+#else // DJV_WINDOWS
+                out.directory = S_ISDIR(info.st_mode);
+                out.permissions |= (info.st_mode & S_IRUSR) ? FileInfo::READ : 0;
+                out.permissions |= (info.st_mode & S_IWUSR) ? FileInfo::WRITE : 0;
+                out.permissions |= (info.st_mode & S_IXUSR) ? FileInfo::EXEC : 0;
+#endif // DJV_WINDOWS
+
+                return true;
+            }
+
+        } // namespace
+
         bool FileInfo::stat(const QString & path)
         {
             //DJV_DEBUG("FileInfo::stat");
             //DJV_DEBUG_PRINT("path = " << path);
 
             _exists = false;
-            _type = static_cast<TYPE>(0);
             _size = 0;
             _user = 0;
             _permissions = 0;
             _time = time_t();
 
-            const QString fileName =
-                FileInfoUtil::fixPath(path.length() ? path : _path) +
-                this->fileName(-1, false);
-            //DJV_DEBUG_PRINT("fileName = " << fileName);
-#if defined(DJV_WINDOWS)
-            struct ::_stati64 info;
-            Memory::fill<quint8>(0, &info, sizeof(struct ::_stati64));
-            if (::_wstati64(StringUtil::qToStdWString(fileName).data(), &info) != 0)
-            {
-                QString err;
-                char tmp[StringUtil::cStringLength] = "";
-                ::strerror_s(tmp, StringUtil::cStringLength, errno);
-                err = tmp;
-                //DJV_DEBUG_PRINT("error = " << err);
-                return false;
-            }
-#elif (defined(DJV_FREEBSD) || defined(DJV_OSX))
-            //! \todo OS X doesn't have stat64?
-            struct ::stat info;
-            Memory::fill<quint8>(0, &info, sizeof(struct ::stat));
-            if (::stat(fileName.toUtf8().data(), &info) != 0)
+            const QString fixedPath = FileInfoUtil::fixPath(path.length() ? path : _path);
+
+            // Sequences are the combined information of each frame.
+            if (SEQUENCE == _type && _sequence.frames.count())
             {
-                return false;
+                for (const auto frame : _sequence.frames)
+                {
+                    StatInfo info;
+                    if (statFile(fixedPath + fileName(frame, false), info))
+                    {
+                        if (!_exists)
+                        {
+                            _permissions = info.permissions;
+                        }
+                        _exists = true;
+                        _size += info.size;
+                        if (info.user > _user)
+                            _user = info.user;
+                        if (info.time > _time)
+                            _time = info.time;
+                    }
+                }
+                return _exists;
             }
-#else
-            struct ::stat64 info;
-            Memory::fill<quint8>(0, &info, sizeof(struct ::stat64));
-            if (::stat64(fileName.toUtf8().data(), &info) != 0)
+
+            _type = static_cast<TYPE>(0);
+            StatInfo info;
+            if (!statFile(fixedPath + this->fileName(-1, false), info))
             {
                 return false;
             }
-#endif // DJV_WINDOWS
-
             _exists = true;
-            _size = info.st_size;
-            _user = info.st_uid;
-            _permissions = 0;
-            _time = info.st_mtime;
-            _type = FILE;
-            _permissions = 0;
-
-            //DJV_DEBUG_PRINT("size = " << _size);
-
-#if defined(DJV_WINDOWS)
-            if (info.st_mode & _S_IFDIR)
-            {
-                _type = DIRECTORY;
-            }
-            _permissions |= (info.st_mode & _S_IREAD) ? FileInfo::READ : 0;
-            _permissions |= (info.st_mode & _S_IWRITE) ? FileInfo::WRITE : 0;
-            _permissions |= (info.st_mode & _S_IEXEC) ? FileInfo::EXEC : 0;
-#else // DJV_WINDOWS
-            if (S_ISDIR(info.st_mode))
-            {
-                _type = DIRECTORY;
-            }
-            _permissions |= (info.st_mode & S_IRUSR) ? READ : 0;
-            _permissions |= (info.st_mode & S_IWUSR) ? WRITE : 0;
-            _permissions |= (info.st_mode & S_IXUSR) ? EXEC : 0;
-#endif // DJV_WINDOWS
+            _size = info.size;
+            _user = info.user;
+            _permissions = info.permissions;
+            _time = info.time;
+            _type = info.directory ? DIRECTORY : FILE;
             //DJV_DEBUG_PRINT("type = " << _type);
 
             return true;
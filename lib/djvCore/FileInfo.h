@@ -222,7 +222,8 @@ namespace djv
             //! Set the time.
             void setTime(time_t);
 
-            //! Get information from the file system.
+            //! Get information from the file system. The information for a
+            //! sequence is combined from each of the frames.
             bool stat(const QString & path = QString());
 
             //! Get the sequence.
@@ -41,9 +41,15 @@
 #include <QCoreApplication>
 #include <QDir>
 #include <QFileInfo>
+#include <QHash>
+#include <QPair>
 #include <QRegExp>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #if defined(DJV_WINDOWS)
 #include <windows.h>
@@ -55,6 +61,9 @@
 */
 #else // DJV_WINDOWS
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif // DJV_WINDOWS
 
 namespace djv
@@ -203,16 +212,40 @@ namespace djv
 
         FileInfoList FileInfoUtil::list(
             const QString &  path,
-            Sequence::FORMAT format)
+            Sequence::FORMAT format,
+            bool             stat)
         {
             //DJV_DEBUG("FileInfoUtil::list");
             //DJV_DEBUG_PRINT("path = " << path);
             //DJV_DEBUG_PRINT("format = " << format);
+            //DJV_DEBUG_PRINT("stat = " << stat);
 
             FileInfoList out;
-            FileInfo * cache = 0;
             QString fixedPath = fixPath(path);
 
+            // Group the files into sequences. The sequences are found by base name
+            // and extension so that each file only needs a single lookup.
+            typedef QPair<QString, QString> Key;
+            QHash<Key, int> sequences;
+            auto add = [&out, &sequences, format](FileInfo & in)
+            {
+                if (format && in.isSequenceValid())
+                {
+                    const Key key(in._base, in._extension);
+                    const auto i = sequences.find(key);
+                    if (i != sequences.end())
+                    {
+                        if (out[i.value()].addSequence(in))
+                            return;
+                    }
+                    else
+                    {
+                        sequences.insert(key, out.count());
+                    }
+                }
+                out.append(in);
+            };
+
 #if defined(DJV_WINDOWS)
             WIN32_FIND_DATAW data;
             HANDLE h = FindFirstFileExW(
@@ -224,101 +257,75 @@ namespace djv
                 FIND_FIRST_EX_LARGE_FETCH);
             if (h != INVALID_HANDLE_VALUE)
             {
-                QString fileName = QString::fromWCharArray(data.cFileName);
-                if (!isDotDir(fileName))
+                do
                 {
-                    out.append(FileInfo(fixedPath + fileName));
-                }
-                while (FindNextFileW(h, &data))
-                {
-                    fileName = QString::fromWCharArray(data.cFileName);
+                    const QString fileName = QString::fromWCharArray(data.cFileName);
                     if (!isDotDir(fileName))
                     {
-                        if (!out.count())
-                        {
-                            out.append(FileInfo(fixedPath + fileName));
-                        }
-                        else
+                        FileInfo tmp(fixedPath + fileName, false);
+                        tmp._exists = true;
+                        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
                         {
-                            const FileInfo tmp(fixedPath + fileName);
-                            int i = 0;
-                            if (format && cache)
-                            {
-                                if (!cache->addSequence(tmp))
-                                {
-                                    cache = 0;
-                                }
-                            }
-                            if (format && !cache)
-                            {
-                                for (; i < out.count(); ++i)
-                                {
-                                    if (out[i].addSequence(tmp))
-                                    {
-                                        cache = &out[i];
-                                        break;
-                                    }
-                                }
-                            }
-                            if (!format || i == out.count())
-                            {
-                                out.append(tmp);
-                            }
+                            tmp._type = FileInfo::DIRECTORY;
                         }
+                        add(tmp);
                     }
-                }
+                } while (FindNextFileW(h, &data));
                 FindClose(h);
             }
 #else // DJV_WINDOWS
+            FileInfoList unknown;
             DIR * dir = ::opendir(path.toUtf8().data());
             if (dir)
             {
                 struct dirent * de = 0;
                 while ((de = ::readdir(dir)) != 0)
                 {
-                    QString fileName = QString::fromUtf8(de->d_name);
+                    const QString fileName = QString::fromUtf8(de->d_name);
                     if (!isDotDir(fileName))
                     {
-                        if (!out.count())
+                        FileInfo tmp(fixedPath + fileName, false);
+#if defined(DT_DIR)
+                        // Only symbolic links and file systems that do not
+                        // provide the type need to be checked.
+                        switch (de->d_type)
                         {
-                            out.append(FileInfo(fixedPath + fileName));
-                        }
-                        else
-                        {
-                            const FileInfo tmp(fixedPath + fileName);
-                            int i = 0;
-                            if (format && cache)
-                            {
-                                if (!cache->addSequence(tmp))
-                                {
-                                    cache = 0;
-                                }
-                            }
-                            if (format && !cache)
-                            {
-                                for (; i < out.count(); ++i)
-                                {
-                                    if (out[i].addSequence(tmp))
-                                    {
-                                        cache = &out[i];
-                                        break;
-                                    }
-                                }
-                            }
-                            if (!format || i == out.count())
-                            {
-                                out.append(tmp);
-                            }
+                        case DT_DIR:
+                            tmp._exists = true;
+                            tmp._type = FileInfo::DIRECTORY;
+                            add(tmp);
+                            break;
+                        case DT_REG:
+                            tmp._exists = true;
+                            add(tmp);
+                            break;
+                        default:
+                            unknown.append(tmp);
+                            break;
                         }
+#else // DT_DIR
+                        unknown.append(tmp);
+#endif // DT_DIR
                     }
                 }
                 closedir(dir);
             }
+
+            // Check the types of the remaining files together.
+            FileInfoUtil::stat(unknown);
+            for (int i = 0; i < unknown.count(); ++i)
+            {
+                add(unknown[i]);
+            }
 #endif // DJV_WINDOWS
             for (int i = 0; i < out.count(); ++i)
             {
                 out[i]._sequence.sort();
             }
+            if (stat)
+            {
+                FileInfoUtil::stat(out);
+            }
             if (Sequence::FORMAT_RANGE == format)
             {
                 for (int i = 0; i < out.count(); ++i)
@@ -341,6 +348,235 @@ namespace djv
             return out;
         }
 
+        namespace
+        {
+            //! The number of files or sequence frames that are handled by a
+            //! thread at a time.
+            const int statChunk = 64;
+
+            //! The maximum number of threads. The threads are mostly waiting on
+            //! the file system so more threads are used than there are cores.
+            const int statThreadsMax = 16;
+
+            struct StatJob
+            {
+                QByteArray fileName;
+                int        dir         = 0;
+                bool       exists      = false;
+                quint64    size        = 0;
+                uid_t      user        = 0;
+                int        permissions = 0;
+                time_t     time        = time_t();
+                bool       directory   = false;
+            };
+
+            void statJob(StatJob & job)
+            {
+#if defined(DJV_WINDOWS)
+                FileInfo tmp(QString::fromUtf8(job.fileName), false);
+                tmp.setType(FileInfo::FILE);
+                if (!tmp.stat())
+                    return;
+                job.size = tmp.size();
+                job.user = tmp.user();
+                job.permissions = tmp.permissions();
+                job.time = tmp.time();
+                job.directory = FileInfo::DIRECTORY == tmp.type();
+#else // DJV_WINDOWS
+#if defined(DJV_FREEBSD) || defined(DJV_OSX)
+                struct ::stat info;
+                if (::fstatat(job.dir, job.fileName.data(), &info, 0) != 0)
+                    return;
+#else // DJV_FREEBSD || DJV_OSX
+                struct ::stat64 info;
+                if (::fstatat64(job.dir, job.fileName.data(), &info, 0) != 0)
+                    return;
+#endif // DJV_FREEBSD || DJV_OSX
+                job.size = info.st_size;
+                job.user = info.st_uid;
+                job.time = info.st_mtime;
+                job.permissions |= (info.st_mode & S_IRUSR) ? FileInfo::READ : 0;
+                job.permissions |= (info.st_mode & S_IWUSR) ? FileInfo::WRITE : 0;
+                job.permissions |= (info.st_mode & S_IXUSR) ? FileInfo::EXEC : 0;
+                job.directory = S_ISDIR(info.st_mode);
+#endif // DJV_WINDOWS
+                job.exists = true;
+            }
+
+        } // namespace
+
+        void FileInfoUtil::stat(FileInfoList & list, const std::function<bool(int, int)> & callback)
+        {
+            //DJV_DEBUG("FileInfoUtil::stat");
+            //DJV_DEBUG_PRINT("list = " << list.count());
+
+            // Create a job for each file, or each frame of a file sequence. The
+            // directories are opened once so the files are looked up relative
+            // to them, instead of resolving the full path for each file.
+            std::vector<StatJob> jobs;
+            std::vector<int> jobEnd(list.count());
+            QHash<QString, int> dirs;
+            for (int i = 0; i < list.count(); ++i)
+            {
+                const FileInfo & item = list[i];
+                const QString path = fixPath(item._path);
+                auto dir = dirs.find(path);
+                if (dir == dirs.end())
+                {
+#if defined(DJV_WINDOWS)
+                    dir = dirs.insert(path, 0);
+#else // DJV_WINDOWS
+                    int fd = path.isEmpty() ? -1 : ::open(path.toUtf8().data(), O_RDONLY | O_DIRECTORY);
+                    dir = dirs.insert(path, fd != -1 ? fd : AT_FDCWD);
+#endif // DJV_WINDOWS
+                }
+                auto addJob = [&jobs, &path, &dir](const QString & fileName)
+                {
+                    StatJob job;
+                    job.dir = dir.value();
+#if defined(DJV_WINDOWS)
+                    job.fileName = (path + fileName).toUtf8();
+#else // DJV_WINDOWS
+                    job.fileName = (AT_FDCWD == job.dir ? (path + fileName) : fileName).toUtf8();
+#endif // DJV_WINDOWS
+                    jobs.push_back(job);
+                };
+                if (FileInfo::SEQUENCE == item._type && item._sequence.frames.count())
+                {
+                    for (const auto frame : item._sequence.frames)
+                    {
+                        addJob(item.fileName(frame, false));
+                    }
+                }
+                else
+                {
+                    addJob(item.fileName(-1, false));
+                }
+                jobEnd[i] = static_cast<int>(jobs.size());
+            }
+
+            // Combine the results of the jobs, the same as FileInfo::stat().
+            auto finish = [&list, &jobs, &jobEnd](int i)
+            {
+                FileInfo & item = list[i];
+                item._exists = false;
+                item._size = 0;
+                item._user = 0;
+                item._permissions = 0;
+                item._time = time_t();
+                const int begin = i > 0 ? jobEnd[i - 1] : 0;
+                if (FileInfo::SEQUENCE == item._type && item._sequence.frames.count())
+                {
+                    for (int j = begin; j < jobEnd[i]; ++j)
+                    {
+                        const StatJob & job = jobs[j];
+                        if (job.exists)
+                        {
+                            if (!item._exists)
+                            {
+                                item._permissions = job.permissions;
+                            }
+                            item._exists = true;
+                            item._size += job.size;
+                            if (job.user > item._user)
+                                item._user = job.user;
+                            if (job.time > item._time)
+                                item._time = job.time;
+                        }
+                    }
+                }
+                else
+                {
+                    const StatJob & job = jobs[begin];
+                    item._exists = job.exists;
+                    item._type = job.directory ? FileInfo::DIRECTORY : FileInfo::FILE;
+                    if (job.exists)
+                    {
+                        item._size = job.size;
+                        item._user = job.user;
+                        item._permissions = job.permissions;
+                        item._time = job.time;
+                    }
+                }
+            };
+
+            // Run the jobs in chunks. Small lists are handled by the calling
+            // thread.
+            const int jobCount = static_cast<int>(jobs.size());
+            const int chunks = (jobCount + statChunk - 1) / statChunk;
+            const int threadCount = Math::min(
+                chunks,
+                Math::clamp(static_cast<int>(std::thread::hardware_concurrency()) * 2, 1, statThreadsMax));
+            //DJV_DEBUG_PRINT("jobs = " << jobCount);
+            //DJV_DEBUG_PRINT("threads = " << threadCount);
+            std::vector<bool> done(chunks, false);
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::atomic<int> next(0);
+            std::atomic<bool> cancel(false);
+            auto work = [&]
+            {
+                for (int c = next++; c < chunks && !cancel; c = next++)
+                {
+                    const int end = Math::min((c + 1) * statChunk, jobCount);
+                    for (int j = c * statChunk; j < end; ++j)
+                    {
+                        statJob(jobs[j]);
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        done[c] = true;
+                    }
+                    cv.notify_all();
+                }
+            };
+            std::vector<std::thread> threads;
+            if (threadCount > 1)
+            {
+                for (int i = 0; i < threadCount; ++i)
+                {
+                    threads.push_back(std::thread(work));
+                }
+            }
+            else
+            {
+                work();
+            }
+
+            // Finish the files in order as the chunks are done.
+            int file = 0;
+            for (int c = 0; c < chunks && !cancel; ++c)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock, [&done, c] { return done[c]; });
+                }
+                const int jobsDone = Math::min((c + 1) * statChunk, jobCount);
+                const int begin = file;
+                for (; file < list.count() && jobEnd[file] <= jobsDone; ++file)
+                {
+                    finish(file);
+                }
+                if (callback && file > begin && !callback(begin, file))
+                {
+                    cancel = true;
+                }
+            }
+            for (auto & thread : threads)
+            {
+                thread.join();
+            }
+#if ! defined(DJV_WINDOWS)
+            for (const auto fd : dirs)
+            {
+                if (fd != AT_FDCWD)
+                {
+                    ::close(fd);
+                }
+            }
+#endif // DJV_WINDOWS
+        }
+
         const FileInfo & FileInfoUtil::sequenceWildcardMatch(
             const FileInfo &     in,
             const FileInfoList & list)
@@ -452,9 +688,9 @@ namespace djv
             //DJV_DEBUG_PRINT("count = " << count);
             if (FileInfo::SEQUENCE == in.type() && count)
             {
-                for (int i = 0; i < count; ++i)
+                for (const auto frame : sequence.frames)
                 {
-                    out += in.fileName(sequence.frames[i]);
+                    out += in.fileName(frame);
                 }
             }
             else
@@ -34,6 +34,8 @@
 #include <QMetaType>
 #include <QStringList>
 
+#include <functional>
+
 namespace djv
 {
     namespace Core
@@ -58,9 +60,28 @@ namespace djv
             static bool exists(const FileInfo &);
 
             //! Get a file list from a directory.
+            //
+            //! \param stat Get information from the file system. If this is false
+            //! only the file types are set, and the information can be retrieved
+            //! later with FileInfo::stat() or FileInfoUtil::stat().
             static FileInfoList list(
                 const QString &  path,
-                Sequence::FORMAT format = Sequence::FORMAT_SPARSE);
+                Sequence::FORMAT format = Sequence::FORMAT_SPARSE,
+                bool             stat   = true);
+
+            //! Get information from the file system for a list of files, the
+            //! same as calling FileInfo::stat() for each of them. The files and
+            //! the frames of file sequences are divided between threads, since
+            //! most of the time is spent waiting on the file system when it is
+            //! on the network.
+            //!
+            //! The callback is called from the calling thread each time a range
+            //! of files is finished, in order, with the index of the first file
+            //! and one past the last. Returning false from the callback cancels
+            //! the remaining files.
+            static void stat(
+                FileInfoList &,
+                const std::function<bool(int, int)> & callback = nullptr);
 
             //! Find a match for a sequence wildcard. If nothing is found the
             //! input is returned.
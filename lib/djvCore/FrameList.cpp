@@ -0,0 +1,273 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvCore/FrameList.h>
+
+#include <djvCore/Assert.h>
+
+#include <algorithm>
+
+namespace djv
+{
+    namespace Core
+    {
+        FrameList::FrameList(qint64 start, qint64 end)
+        {
+            const int step = start <= end ? 1 : -1;
+            _append(Run(start, static_cast<int>((end - start) * step + 1), step));
+        }
+
+        FrameList::FrameList(const QVector<qint64> & in)
+        {
+            for (const auto frame : in)
+            {
+                append(frame);
+            }
+        }
+
+        QVector<qint64> FrameList::toVector() const
+        {
+            QVector<qint64> out;
+            out.reserve(_count);
+            for (const auto & run : _runs)
+            {
+                for (int i = 0; i < run.count; ++i)
+                {
+                    out.push_back(run.frame(i));
+                }
+            }
+            return out;
+        }
+
+        qint64 FrameList::at(int index) const
+        {
+            DJV_ASSERT(index >= 0 && index < _count);
+            const auto i = std::upper_bound(_offsets.begin(), _offsets.end(), index) - 1;
+            return _runs[i - _offsets.begin()].frame(index - *i);
+        }
+
+        int FrameList::indexOf(qint64 frame) const
+        {
+            if (_sorted)
+            {
+                auto i = std::upper_bound(
+                    _runs.begin(),
+                    _runs.end(),
+                    frame,
+                    [](qint64 frame, const Run & run)
+                {
+                    return frame < run.start;
+                });
+                if (i != _runs.begin())
+                {
+                    --i;
+                    if (frame <= i->end())
+                    {
+                        return _offsets[i - _runs.begin()] + static_cast<int>(frame - i->start);
+                    }
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < _runs.size(); ++i)
+                {
+                    const Run & run = _runs[i];
+                    const qint64 end = run.end();
+                    if ((run.step > 0 && frame >= run.start && frame <= end) ||
+                        (run.step < 0 && frame <= run.start && frame >= end))
+                    {
+                        return _offsets[i] + static_cast<int>((frame - run.start) * run.step);
+                    }
+                }
+            }
+            return -1;
+        }
+
+        FrameList FrameList::mid(int pos, int length) const
+        {
+            FrameList out;
+            pos = std::max(pos, 0);
+            const int end = (length < 0 || pos + length > _count) ? _count : (pos + length);
+            if (pos < end)
+            {
+                const size_t first = std::upper_bound(_offsets.begin(), _offsets.end(), pos) - 1 - _offsets.begin();
+                for (size_t i = first; i < _runs.size() && _offsets[i] < end; ++i)
+                {
+                    const int a = std::max(pos, _offsets[i]) - _offsets[i];
+                    const int b = std::min(end, _offsets[i] + _runs[i].count) - _offsets[i];
+                    out._append(Run(_runs[i].frame(a), b - a, _runs[i].step));
+                }
+            }
+            return out;
+        }
+
+        void FrameList::clear()
+        {
+            _runs.clear();
+            _offsets.clear();
+            _count = 0;
+            _sorted = true;
+        }
+
+        void FrameList::append(qint64 frame)
+        {
+            if (_runs.size())
+            {
+                // Extend the last run if the frame follows it.
+                Run & last = _runs.back();
+                if (1 == last.count && (frame == last.start + 1 || frame == last.start - 1))
+                {
+                    last.step = frame > last.start ? 1 : -1;
+                    ++last.count;
+                    ++_count;
+                    if (last.step < 0)
+                    {
+                        _sorted = false;
+                    }
+                    return;
+                }
+                else if (last.count > 1 && frame == last.end() + last.step)
+                {
+                    ++last.count;
+                    ++_count;
+                    return;
+                }
+                if (frame <= last.end())
+                {
+                    _sorted = false;
+                }
+            }
+            _offsets.push_back(_count);
+            _runs.push_back(Run(frame, 1));
+            ++_count;
+        }
+
+        void FrameList::append(const FrameList & other)
+        {
+            if (&other == this)
+            {
+                const FrameList tmp = other;
+                append(tmp);
+                return;
+            }
+            for (const auto & run : other._runs)
+            {
+                _append(run);
+            }
+        }
+
+        void FrameList::pop_front()
+        {
+            if (_count)
+            {
+                *this = mid(1);
+            }
+        }
+
+        void FrameList::sort()
+        {
+            if (_sorted)
+                return;
+
+            // Sort the runs in ascending order.
+            std::vector<Run> runs;
+            runs.reserve(_runs.size());
+            for (const auto & run : _runs)
+            {
+                runs.push_back(run.step > 0 ? run : Run(run.end(), run.count));
+            }
+            std::sort(
+                runs.begin(),
+                runs.end(),
+                [](const Run & a, const Run & b)
+            {
+                return a.start < b.start;
+            });
+            bool overlap = false;
+            for (size_t i = 1; i < runs.size() && !overlap; ++i)
+            {
+                overlap = runs[i].start <= runs[i - 1].end();
+            }
+            clear();
+            if (!overlap)
+            {
+                for (const auto & run : runs)
+                {
+                    _append(run);
+                }
+            }
+            else
+            {
+                // Overlapping runs contain duplicate frames, which are kept.
+                std::vector<qint64> frames;
+                for (const auto & run : runs)
+                {
+                    for (int i = 0; i < run.count; ++i)
+                    {
+                        frames.push_back(run.frame(i));
+                    }
+                }
+                std::sort(frames.begin(), frames.end());
+                for (const auto frame : frames)
+                {
+                    append(frame);
+                }
+            }
+        }
+
+        void FrameList::_append(const Run & run)
+        {
+            Run tmp = run;
+            while (tmp.count > 0)
+            {
+                // Append the first frame, then append the rest of the run in one
+                // step if it continues the last run.
+                append(tmp.start);
+                tmp.start += tmp.step;
+                --tmp.count;
+                if (tmp.count > 0)
+                {
+                    Run & last = _runs.back();
+                    if (1 == last.count || last.step == tmp.step)
+                    {
+                        last.step = tmp.step;
+                        last.count += tmp.count;
+                        _count += tmp.count;
+                        if (tmp.step < 0)
+                        {
+                            _sorted = false;
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+
+    } // namespace Core
+} // namespace djv
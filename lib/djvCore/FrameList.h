@@ -0,0 +1,194 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <QMetaType>
+#include <QVector>
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace djv
+{
+    namespace Core
+    {
+        //! This class provides a list of frame numbers.
+        //!
+        //! The frames are stored as runs of consecutive frame numbers so that
+        //! large sequences use little memory. Looking up a frame by index is
+        //! O(log runs), as is looking up a frame number when the list is
+        //! sorted. Appending a frame or merging another list onto the end is
+        //! O(1) per run.
+        //!
+        //! The interface follows QVector<qint64>, which was previously used for
+        //! frame lists, and toVector() is provided for code that needs the
+        //! expanded form.
+        class FrameList
+        {
+        public:
+            //! This struct provides a run of consecutive frame numbers.
+            struct Run
+            {
+                inline Run();
+                inline Run(qint64 start, int count, int step = 1);
+
+                qint64 start = 0;
+                int    count = 0;
+                int    step  = 1; //!< Either 1 or -1
+
+                //! Get the frame at the given index in the run.
+                inline qint64 frame(int) const;
+
+                //! Get the last frame in the run.
+                inline qint64 end() const;
+            };
+
+            //! This class provides an iterator over the frames.
+            class ConstIterator
+            {
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef qint64 value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const qint64 * pointer;
+                typedef qint64 reference;
+
+                inline ConstIterator();
+                inline ConstIterator(const FrameList *, size_t run, int index);
+
+                inline qint64 operator * () const;
+                inline ConstIterator & operator ++ ();
+                inline ConstIterator operator ++ (int);
+                inline bool operator == (const ConstIterator &) const;
+                inline bool operator != (const ConstIterator &) const;
+
+            private:
+                const FrameList * _list  = nullptr;
+                size_t            _run   = 0;
+                int               _index = 0;
+            };
+            typedef ConstIterator const_iterator;
+            typedef ConstIterator iterator;
+            typedef qint64 value_type;
+
+            inline FrameList();
+
+            //! Create a list of the frames from start to end, inclusive. The
+            //! frames are in descending order when end is less than start.
+            FrameList(qint64 start, qint64 end);
+
+            //! Create a list from expanded frame numbers.
+            FrameList(const QVector<qint64> &);
+
+            //! Get the expanded frame numbers.
+            QVector<qint64> toVector() const;
+
+            //! Get the runs.
+            inline const std::vector<Run> & runs() const;
+
+            //! Get the number of frames.
+            inline int count() const;
+
+            //! Get the number of frames.
+            inline int size() const;
+
+            //! Get whether the list is empty.
+            inline bool isEmpty() const;
+
+            //! Get a frame by index.
+            qint64 at(int) const;
+
+            //! Get a frame by index.
+            inline qint64 operator [] (int) const;
+
+            //! Get the first frame.
+            inline qint64 first() const;
+
+            //! Get the last frame.
+            inline qint64 last() const;
+
+            //! Get whether the list is sorted in ascending order without
+            //! duplicates.
+            inline bool isSorted() const;
+
+            //! Get the index of a frame, or -1 if the frame is not in the list.
+            int indexOf(qint64) const;
+
+            //! Get whether the list contains a frame.
+            inline bool contains(qint64) const;
+
+            //! Get a sub-list.
+            FrameList mid(int pos, int length = -1) const;
+
+            inline ConstIterator begin() const;
+            inline ConstIterator end() const;
+
+            //! Remove all of the frames.
+            void clear();
+
+            //! Append a frame.
+            void append(qint64);
+
+            //! Append a list of frames.
+            void append(const FrameList &);
+
+            //! Append a frame.
+            inline void push_back(qint64);
+
+            //! Remove the first frame.
+            void pop_front();
+
+            //! Sort the frames in ascending order.
+            void sort();
+
+            inline FrameList & operator += (qint64);
+            inline FrameList & operator += (const FrameList &);
+            inline FrameList & operator << (qint64);
+            inline FrameList & operator << (const FrameList &);
+
+            inline bool operator == (const FrameList &) const;
+            inline bool operator != (const FrameList &) const;
+
+        private:
+            void _append(const Run &);
+
+            std::vector<Run> _runs;
+            std::vector<int> _offsets;
+            int              _count  = 0;
+            bool             _sorted = true;
+        };
+
+    } // namespace Core
+} // namespace djv
+
+Q_DECLARE_METATYPE(djv::Core::FrameList)
+
+#include <djvCore/FrameListInline.h>
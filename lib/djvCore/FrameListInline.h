@@ -0,0 +1,201 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+namespace djv
+{
+    namespace Core
+    {
+        inline FrameList::Run::Run()
+        {}
+
+        inline FrameList::Run::Run(qint64 start, int count, int step) :
+            start(start),
+            count(count),
+            step(step)
+        {}
+
+        inline qint64 FrameList::Run::frame(int index) const
+        {
+            return start + static_cast<qint64>(step) * index;
+        }
+
+        inline qint64 FrameList::Run::end() const
+        {
+            return frame(count - 1);
+        }
+
+        inline FrameList::ConstIterator::ConstIterator()
+        {}
+
+        inline FrameList::ConstIterator::ConstIterator(const FrameList * list, size_t run, int index) :
+            _list(list),
+            _run(run),
+            _index(index)
+        {}
+
+        inline qint64 FrameList::ConstIterator::operator * () const
+        {
+            return _list->_runs[_run].frame(_index);
+        }
+
+        inline FrameList::ConstIterator & FrameList::ConstIterator::operator ++ ()
+        {
+            if (++_index >= _list->_runs[_run].count)
+            {
+                ++_run;
+                _index = 0;
+            }
+            return *this;
+        }
+
+        inline FrameList::ConstIterator FrameList::ConstIterator::operator ++ (int)
+        {
+            const ConstIterator out = *this;
+            ++(*this);
+            return out;
+        }
+
+        inline bool FrameList::ConstIterator::operator == (const ConstIterator & other) const
+        {
+            return _list == other._list && _run == other._run && _index == other._index;
+        }
+
+        inline bool FrameList::ConstIterator::operator != (const ConstIterator & other) const
+        {
+            return !(*this == other);
+        }
+
+        inline FrameList::FrameList()
+        {}
+
+        inline const std::vector<FrameList::Run> & FrameList::runs() const
+        {
+            return _runs;
+        }
+
+        inline int FrameList::count() const
+        {
+            return _count;
+        }
+
+        inline int FrameList::size() const
+        {
+            return _count;
+        }
+
+        inline bool FrameList::isEmpty() const
+        {
+            return 0 == _count;
+        }
+
+        inline qint64 FrameList::operator [] (int index) const
+        {
+            return at(index);
+        }
+
+        inline qint64 FrameList::first() const
+        {
+            return _runs.front().start;
+        }
+
+        inline qint64 FrameList::last() const
+        {
+            return _runs.back().end();
+        }
+
+        inline bool FrameList::isSorted() const
+        {
+            return _sorted;
+        }
+
+        inline bool FrameList::contains(qint64 frame) const
+        {
+            return indexOf(frame) != -1;
+        }
+
+        inline FrameList::ConstIterator FrameList::begin() const
+        {
+            return ConstIterator(this, 0, 0);
+        }
+
+        inline FrameList::ConstIterator FrameList::end() const
+        {
+            return ConstIterator(this, _runs.size(), 0);
+        }
+
+        inline void FrameList::push_back(qint64 frame)
+        {
+            append(frame);
+        }
+
+        inline FrameList & FrameList::operator += (qint64 frame)
+        {
+            append(frame);
+            return *this;
+        }
+
+        inline FrameList & FrameList::operator += (const FrameList & other)
+        {
+            append(other);
+            return *this;
+        }
+
+        inline FrameList & FrameList::operator << (qint64 frame)
+        {
+            append(frame);
+            return *this;
+        }
+
+        inline FrameList & FrameList::operator << (const FrameList & other)
+        {
+            append(other);
+            return *this;
+        }
+
+        inline bool FrameList::operator == (const FrameList & other) const
+        {
+            if (_count != other._count || _runs.size() != other._runs.size())
+                return false;
+            for (size_t i = 0; i < _runs.size(); ++i)
+            {
+                const Run & a = _runs[i];
+                const Run & b = other._runs[i];
+                if (a.start != b.start || a.count != b.count || (a.count > 1 && a.step != b.step))
+                    return false;
+            }
+            return true;
+        }
+
+        inline bool FrameList::operator != (const FrameList & other) const
+        {
+            return !(*this == other);
+        }
+
+    } // namespace Core
+} // namespace djv
@@ -0,0 +1,229 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvCore/MemoryPool.h>
+
+#include <djvCore/Memory.h>
+
+#if defined(DJV_WINDOWS)
+#include <malloc.h>
+#else // DJV_WINDOWS
+#include <stdlib.h>
+#endif // DJV_WINDOWS
+#if defined(DJV_LINUX)
+#include <sys/mman.h>
+#endif // DJV_LINUX
+
+#include <map>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace djv
+{
+    namespace Core
+    {
+        namespace
+        {
+            // Blocks at least this large are aligned to huge pages.
+            const quint64 hugePageSize = 2 * 1024 * 1024;
+
+            struct Pool
+            {
+                std::mutex mutex;
+                std::map<quint64, std::vector<quint8 *> > blocks;
+                quint64 maxPooledBytes = 256 * Memory::megabyte;
+                MemoryPoolStats stats;
+            };
+
+            // The pool is never destroyed so that images in static storage
+            // can still release their blocks on exit.
+            Pool & pool()
+            {
+                static Pool * data = new Pool;
+                return *data;
+            }
+
+            quint8 * alignedAlloc(quint64 size)
+            {
+                const quint64 align = size >= hugePageSize ? hugePageSize : MemoryPool::alignment;
+#if defined(DJV_WINDOWS)
+                void * out = _aligned_malloc(size, align);
+#else // DJV_WINDOWS
+                void * out = nullptr;
+                if (posix_memalign(&out, align, size) != 0)
+                {
+                    out = nullptr;
+                }
+#endif // DJV_WINDOWS
+                if (!out)
+                {
+                    throw std::bad_alloc();
+                }
+#if defined(DJV_LINUX) && defined(MADV_HUGEPAGE)
+                if (size >= hugePageSize)
+                {
+                    madvise(out, size, MADV_HUGEPAGE);
+                }
+#endif // DJV_LINUX
+                return reinterpret_cast<quint8 *>(out);
+            }
+
+            void alignedFree(quint8 * p)
+            {
+#if defined(DJV_WINDOWS)
+                _aligned_free(p);
+#else // DJV_WINDOWS
+                free(p);
+#endif // DJV_WINDOWS
+            }
+
+        } // namespace
+
+        MemoryPool::~MemoryPool()
+        {}
+
+        const quint64 MemoryPool::alignment = 64;
+
+        quint64 MemoryPool::sizeClass(quint64 size)
+        {
+            // Small sizes are rounded up to the alignment, larger sizes are
+            // rounded up to a sixteenth of their power of two so that at most
+            // about six percent is wasted.
+            quint64 step = alignment;
+            if (size > 4096)
+            {
+                quint64 power = 4096;
+                while (power <= size / 2)
+                {
+                    power *= 2;
+                }
+                step = power / 16;
+            }
+            return (size + step - 1) / step * step;
+        }
+
+        quint8 * MemoryPool::allocate(quint64 size)
+        {
+            const quint64 blockSize = sizeClass(size);
+            auto & pool = Core::pool();
+            {
+                std::unique_lock<std::mutex> lock(pool.mutex);
+                auto i = pool.blocks.find(blockSize);
+                if (i != pool.blocks.end() && i->second.size())
+                {
+                    quint8 * out = i->second.back();
+                    i->second.pop_back();
+                    ++pool.stats.reuseCount;
+                    pool.stats.usedBytes += blockSize;
+                    pool.stats.pooledBytes -= blockSize;
+                    return out;
+                }
+            }
+            quint8 * out = alignedAlloc(blockSize);
+            std::unique_lock<std::mutex> lock(pool.mutex);
+            ++pool.stats.allocCount;
+            pool.stats.usedBytes += blockSize;
+            return out;
+        }
+
+        void MemoryPool::release(quint8 * p, quint64 size)
+        {
+            if (!p)
+                return;
+            const quint64 blockSize = sizeClass(size);
+            auto & pool = Core::pool();
+            {
+                std::unique_lock<std::mutex> lock(pool.mutex);
+                pool.stats.usedBytes -= blockSize;
+                if (pool.stats.pooledBytes + blockSize <= pool.maxPooledBytes)
+                {
+                    pool.blocks[blockSize].push_back(p);
+                    ++pool.stats.releaseCount;
+                    pool.stats.pooledBytes += blockSize;
+                    return;
+                }
+                ++pool.stats.freeCount;
+            }
+            alignedFree(p);
+        }
+
+        quint64 MemoryPool::maxPooledBytes()
+        {
+            auto & pool = Core::pool();
+            std::unique_lock<std::mutex> lock(pool.mutex);
+            return pool.maxPooledBytes;
+        }
+
+        void MemoryPool::setMaxPooledBytes(quint64 size)
+        {
+            auto & pool = Core::pool();
+            bool trim = false;
+            {
+                std::unique_lock<std::mutex> lock(pool.mutex);
+                pool.maxPooledBytes = size;
+                trim = pool.stats.pooledBytes > size;
+            }
+            if (trim)
+            {
+                clear();
+            }
+        }
+
+        void MemoryPool::clear()
+        {
+            std::map<quint64, std::vector<quint8 *> > blocks;
+            auto & pool = Core::pool();
+            {
+                std::unique_lock<std::mutex> lock(pool.mutex);
+                std::swap(blocks, pool.blocks);
+                for (const auto & i : blocks)
+                {
+                    pool.stats.freeCount += i.second.size();
+                }
+                pool.stats.pooledBytes = 0;
+            }
+            for (const auto & i : blocks)
+            {
+                for (auto p : i.second)
+                {
+                    alignedFree(p);
+                }
+            }
+        }
+
+        MemoryPoolStats MemoryPool::stats()
+        {
+            auto & pool = Core::pool();
+            std::unique_lock<std::mutex> lock(pool.mutex);
+            return pool.stats;
+        }
+
+    } // namespace Core
+} // namespace djv
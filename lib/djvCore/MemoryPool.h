@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <djvCore/Util.h>
+
+#include <QtGlobal>
+
+namespace djv
+{
+    namespace Core
+    {
+        //! This struct provides memory pool statistics.
+        struct MemoryPoolStats
+        {
+            quint64 allocCount   = 0; //!< The number of blocks allocated from the system.
+            quint64 reuseCount   = 0; //!< The number of blocks reused from the pool.
+            quint64 releaseCount = 0; //!< The number of blocks released to the pool.
+            quint64 freeCount    = 0; //!< The number of blocks freed to the system.
+            quint64 usedBytes    = 0; //!< The size of the blocks in use.
+            quint64 pooledBytes  = 0; //!< The size of the blocks waiting to be reused.
+        };
+
+        //! This class provides a pool of memory blocks.
+        //!
+        //! The blocks are aligned and not initialized. Block sizes are rounded
+        //! up to a size class so that blocks of similar sizes can be reused,
+        //! for example the images of a sequence. Large blocks are aligned to
+        //! huge pages where supported.
+        //!
+        //! The pool is thread safe.
+        class MemoryPool
+        {
+        public:
+            virtual ~MemoryPool() = 0;
+
+            //! The minimum alignment of blocks.
+            static const quint64 alignment;
+
+            //! Get the size class for the given size.
+            static quint64 sizeClass(quint64);
+
+            //! Allocate a block of at least the given size.
+            static quint8 * allocate(quint64);
+
+            //! Release a block to the pool. The size must be the size used to
+            //! allocate the block.
+            static void release(quint8 *, quint64);
+
+            //! Get the maximum number of bytes kept in the pool.
+            static quint64 maxPooledBytes();
+
+            //! Set the maximum number of bytes kept in the pool. Released blocks
+            //! that do not fit are freed.
+            static void setMaxPooledBytes(quint64);
+
+            //! Free the blocks in the pool.
+            static void clear();
+
+            //! Get the pool statistics.
+            static MemoryPoolStats stats();
+        };
+
+    } // namespace Core
+} // namespace djv
@@ -38,9 +38,17 @@
 #include <djvCore/FileInfoUtil.h>
 
 #include <QCoreApplication>
+#include <QDateTime>
 #include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QMap>
-#include <QPair>
+#include <QSaveFile>
+#include <QSet>
+#include <QStandardPaths>
 #include <QStringList>
 
 #if defined(DJV_WINDOWS)
@@ -50,6 +58,7 @@
 #endif // DJV_WINDOWS
 
 #include <algorithm>
+#include <mutex>
 #if ! defined(DJV_WINDOWS)
 #include <dlfcn.h>
 #endif
@@ -72,6 +81,11 @@ namespace djv
         Plugin::~Plugin()
         {}
 
+        QVariantMap Plugin::pluginManifest() const
+        {
+            return QVariantMap();
+        }
+
         const QPointer<CoreContext> & Plugin::context() const
         {
             return _p->context;
@@ -145,13 +159,82 @@ namespace djv
                 context(context)
             {}
 
+            struct Entry
+            {
+                QString     name;
+                // The plugin library, empty for plugins added with addPlugin().
+                QString     fileName;
+                qint64      time     = 0;
+                QVariantMap manifest;
+                Plugin *    plugin   = nullptr;
+                Handle *    handle   = nullptr;
+                bool        init     = false;
+                bool        error    = false;
+            };
+
+            Plugin * open(const QString & fileName, Handle *& handle) const;
+
             QString pluginPrefix;
             QString pluginEntry;
-            typedef QPair<Plugin *, Handle *> Pair;
-            QMap<QString, Pair> plugins;
+            QMap<QString, Entry> plugins;
+            // Plugins are loaded and initialized on first use, which may be
+            // from several threads at once, for example the file browser
+            // thumbnails and the pre-load threads. Initializing a plugin may
+            // use other plugins.
+            std::recursive_mutex mutex;
             QPointer<CoreContext> context;
         };
 
+        Plugin * PluginFactory::Private::open(const QString & fileName, Handle *& handle) const
+        {
+            DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
+                QString("Loading plugin: \"%1\"...").arg(fileName));
+            QScopedPointer<Handle> tmp(new Handle);
+            try
+            {
+                tmp->open(fileName);
+            }
+            catch (const QString & error)
+            {
+                DJV_LOG(context->debugLog(),
+                    "djv::Core::PluginFactory",
+                    errorLabels()[ERROR_OPEN].
+                    arg(QDir::toNativeSeparators(fileName)).
+                    arg(error));
+                return nullptr;
+            }
+            djvCorePluginEntry * entry = (djvCorePluginEntry *)tmp->fnc(pluginEntry);
+            if (!entry)
+            {
+                DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
+                    "No plugin entry point");
+                return nullptr;
+            }
+            QScopedPointer<Plugin> plugin;
+            try
+            {
+                plugin.reset(entry(context));
+            }
+            catch (const Error & error)
+            {
+                DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
+                    ErrorUtil::format(error).join("\n"));
+                plugin.reset();
+            }
+            if (!plugin.data())
+            {
+                DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
+                    errorLabels()[ERROR_LOAD].
+                    arg(QDir::toNativeSeparators(fileName)));
+                return nullptr;
+            }
+            //DJV_DEBUG_PRINT("name = " << plugin->pluginName());
+            DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
+                QString("Plugin name: \"%1\"").arg(plugin->pluginName()));
+            handle = tmp.take();
+            return plugin.take();
+        }
+
         PluginFactory::PluginFactory(
             const QPointer<CoreContext> & context,
             const QStringList & searchPath,
@@ -168,6 +251,9 @@ namespace djv
             //DJV_DEBUG_PRINT("plugin prefix = " << pluginPrefix);
             //DJV_DEBUG_PRINT("plugin suffix = " << pluginSuffix);
 
+            _p->pluginPrefix = pluginPrefix;
+            _p->pluginEntry = pluginEntry;
+
             //! \todo Hard-coded OS specific shared library file extensions.
             QStringList glob;
 #if defined(DJV_WINDOWS)
@@ -189,7 +275,8 @@ namespace djv
                     QString("Checking search path: \"%1\"").arg(path));
                 FileInfoList tmp = FileInfoUtil::list(
                     path,
-                    Sequence::FORMAT_OFF);
+                    Sequence::FORMAT_OFF,
+                    false);
                 FileInfoUtil::filter(
                     tmp,
                     FileInfoUtil::FILTER_NONE,
@@ -204,121 +291,164 @@ namespace djv
                     fileInfoList += fileInfo;
                 }
             }
+            if (!fileInfoList.count())
+                return;
+
+            // Read the manifest.
+            const QString manifestFileName = PluginFactory::manifestFileName(pluginEntry);
+            QMap<QString, Private::Entry> manifest;
+            QFile manifestFile(manifestFileName);
+            if (manifestFile.open(QIODevice::ReadOnly))
+            {
+                const QJsonDocument document = QJsonDocument::fromJson(manifestFile.readAll());
+                Q_FOREACH(const QJsonValue & value, document.object()["plugins"].toArray())
+                {
+                    const QJsonObject object = value.toObject();
+                    Private::Entry entry;
+                    entry.fileName = object["fileName"].toString();
+                    entry.time = static_cast<qint64>(object["time"].toDouble());
+                    entry.name = object["name"].toString();
+                    entry.manifest = object["manifest"].toObject().toVariantMap();
+                    manifest[entry.fileName] = entry;
+                }
+                manifestFile.close();
+            }
+            bool manifestChanged = false;
 
-            // Load plugins.
+            // Add the plugins. Plugins that are in the manifest and have not
+            // changed are loaded on first use, the others are loaded now so
+            // that the manifest can be updated. Libraries that fail to load
+            // are kept in the manifest without a name so that they are not
+            // loaded again until they change.
             //DJV_DEBUG_PRINT("fileInfoList = " << fileInfoList.count());
+            QList<Private::Entry> manifestEntries;
+            QSet<QString> fileNames;
             Q_FOREACH(const FileInfo & fileInfo, fileInfoList)
             {
-                // Open.
-                //DJV_DEBUG_PRINT("loading = " << fileInfo);
-                DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
-                    QString("Loading plugin: \"%1\"...").arg(fileInfo));
-                QScopedPointer<Handle> handle(new Handle);
-                try
-                {
-                    handle->open(fileInfo);
-                }
-                catch (const QString & error)
-                {
-                    DJV_LOG(context->debugLog(),
-                        "djv::Core::PluginFactory",
-                        errorLabels()[ERROR_OPEN].
-                        arg(QDir::toNativeSeparators(fileInfo)).
-                        arg(error));
-                    continue;
-                }
-                djvCorePluginEntry * entry = (djvCorePluginEntry *)handle->fnc(pluginEntry);
-                if (!entry)
-                {
-                    DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
-                        "No plugin entry point");
+                if (fileNames.contains(fileInfo))
                     continue;
-                }
-                QScopedPointer<Plugin> plugin;
-                try
-                {
-                    plugin.reset(entry(_p->context));
-                }
-                catch (const Error & error)
+                fileNames.insert(fileInfo);
+                Private::Entry entry;
+                entry.fileName = fileInfo;
+                entry.time = QFileInfo(fileInfo).lastModified().toMSecsSinceEpoch();
+                const auto i = manifest.find(entry.fileName);
+                if (i != manifest.end() && i.value().time == entry.time)
                 {
+                    entry.name = i.value().name;
+                    entry.manifest = i.value().manifest;
+                    manifestEntries += entry;
+                    if (entry.name.isEmpty())
+                    {
+                        DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
+                            errorLabels()[ERROR_LOAD].
+                            arg(QDir::toNativeSeparators(entry.fileName)));
+                        continue;
+                    }
                     DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
-                        ErrorUtil::format(error).join("\n"));
-
-                    plugin.reset();
+                        QString("Plugin from manifest: \"%1\"").arg(entry.name));
                 }
-                if (!plugin.data())
+                else
                 {
-                    DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
-                        errorLabels()[ERROR_LOAD].
-                        arg(QDir::toNativeSeparators(fileInfo)));
-                    continue;
+                    manifestChanged = true;
+                    entry.plugin = _p->open(fileInfo, entry.handle);
+                    if (entry.plugin)
+                    {
+                        entry.name = entry.plugin->pluginName();
+                        entry.manifest = entry.plugin->pluginManifest();
+                    }
+                    manifestEntries += entry;
+                    if (!entry.plugin)
+                        continue;
                 }
-                //DJV_DEBUG_PRINT("name = " << plugin->pluginName());
-                DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
-                    QString("Plugin name: \"%1\"").arg(plugin->pluginName()));
 
                 // Check for duplicates.
-                if (_p->plugins.contains(plugin->pluginName()))
+                if (_p->plugins.contains(entry.name))
                 {
                     //DJV_DEBUG_PRINT("duplicate");
                     DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
                         "Duplicate plugin, discarding");
-                    plugin.reset();
+                    delete entry.plugin;
+                    delete entry.handle;
                     continue;
                 }
 
-                // Initialize.
-                try
+                _p->plugins[entry.name] = entry;
+            }
+
+            // Libraries that have been removed also change the manifest.
+            for (auto i = manifest.begin(); i != manifest.end() && !manifestChanged; ++i)
+            {
+                manifestChanged = !fileNames.contains(i.key());
+            }
+
+            // Write the manifest. It is written to a temporary file and then
+            // renamed so that other processes never read a partial manifest.
+            if (manifestChanged)
+            {
+                QJsonArray array;
+                Q_FOREACH(const Private::Entry & entry, manifestEntries)
                 {
-                    plugin->initPlugin();
+                    QJsonObject object;
+                    object["fileName"] = entry.fileName;
+                    object["time"] = static_cast<double>(entry.time);
+                    object["name"] = entry.name;
+                    object["manifest"] = QJsonObject::fromVariantMap(entry.manifest);
+                    array.append(object);
                 }
-                catch (const Error & error)
+                QJsonObject object;
+                object["plugins"] = array;
+                QDir().mkpath(QFileInfo(manifestFileName).absolutePath());
+                QSaveFile saveFile(manifestFileName);
+                if (!saveFile.open(QIODevice::WriteOnly) ||
+                    saveFile.write(QJsonDocument(object).toJson()) < 0 ||
+                    !saveFile.commit())
                 {
                     DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
-                        ErrorUtil::format(error).join("\n"));
-                    plugin->releasePlugin();
-                    plugin.reset();
-                    continue;
+                        QString("Cannot write plugin manifest: \"%1\"").
+                        arg(QDir::toNativeSeparators(manifestFileName)));
                 }
-
-                // Add.
-                Plugin * p = plugin.take();
-                Handle * h = handle.take();
-                _p->plugins[p->pluginName()] = Private::Pair(p, h);
             }
 
             DJV_LOG(context->debugLog(), "djv::Core::PluginFactory",
-                QString("Plugins loaded: %1").arg(_p->plugins.count()));
+                QString("Plugins found: %1").arg(_p->plugins.count()));
         }
 
         PluginFactory::~PluginFactory()
         {
             //DJV_DEBUG("PluginFactory::~PluginFactory");
-            Q_FOREACH(Private::Pair pair, _p->plugins)
+            Q_FOREACH(const Private::Entry & entry, _p->plugins)
             {
-                pair.first->releasePlugin();
-                delete pair.first;
-                delete pair.second;
+                if (entry.init)
+                {
+                    entry.plugin->releasePlugin();
+                }
+                delete entry.plugin;
+                delete entry.handle;
             }
         }
 
         QList<Plugin *> PluginFactory::plugins() const
         {
+            std::lock_guard<std::recursive_mutex> lock(_p->mutex);
             QList<Plugin *> list;
-            Q_FOREACH(Private::Pair pair, _p->plugins)
+            Q_FOREACH(const QString & name, _p->plugins.keys())
             {
-                list += pair.first;
+                if (Plugin * plugin = _init(name))
+                {
+                    list += plugin;
+                }
             }
             return list;
         }
 
         Plugin * PluginFactory::plugin(const QString & name) const
         {
-            return _p->plugins.contains(name) ? _p->plugins[name].first : 0;
+            return _init(name);
         }
 
         QStringList PluginFactory::names() const
         {
+            std::lock_guard<std::recursive_mutex> lock(_p->mutex);
             QStringList out;
             Q_FOREACH(QString name, _p->plugins.keys())
             {
@@ -327,20 +457,81 @@ namespace djv
             return out;
         }
 
+        QVariantMap PluginFactory::pluginManifest(const QString & name) const
+        {
+            std::lock_guard<std::recursive_mutex> lock(_p->mutex);
+            const auto i = _p->plugins.constFind(name);
+            return i != _p->plugins.constEnd() ? i.value().manifest : QVariantMap();
+        }
+
         void PluginFactory::addPlugin(Plugin * in)
         {
             //DJV_DEBUG("PluginFactory::addPlugin");
-            try
+            Private::Entry entry;
+            entry.name = in->pluginName();
+            entry.manifest = in->pluginManifest();
+            entry.plugin = in;
+            std::lock_guard<std::recursive_mutex> lock(_p->mutex);
+            _p->plugins[entry.name] = entry;
+        }
+
+        QString PluginFactory::manifestFileName(const QString & pluginEntry)
+        {
+            return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) +
+                "/djv/" + pluginEntry + "Manifest.json";
+        }
+
+        Plugin * PluginFactory::_init(const QString & name) const
+        {
+            //DJV_DEBUG("PluginFactory::_init");
+            //DJV_DEBUG_PRINT("name = " << name);
+            std::lock_guard<std::recursive_mutex> lock(_p->mutex);
+            const auto i = _p->plugins.find(name);
+            if (i == _p->plugins.end() || i.value().error)
+                return nullptr;
+            Private::Entry & entry = i.value();
+
+            // Load.
+            if (!entry.plugin)
             {
-                in->initPlugin();
-                _p->plugins[in->pluginName()] = Private::Pair(in, nullptr);
+                entry.plugin = _p->open(entry.fileName, entry.handle);
+                if (entry.plugin && entry.plugin->pluginName() != name)
+                {
+                    DJV_LOG(_p->context->debugLog(), "djv::Core::PluginFactory",
+                        errorLabels()[ERROR_LOAD].
+                        arg(QDir::toNativeSeparators(entry.fileName)));
+                    delete entry.plugin;
+                    entry.plugin = nullptr;
+                    delete entry.handle;
+                    entry.handle = nullptr;
+                }
+                if (!entry.plugin)
+                {
+                    entry.error = true;
+                    return nullptr;
+                }
             }
-            catch (const Error & error)
+
+            // Initialize.
+            if (!entry.init)
             {
-                DJV_LOG(_p->context->debugLog(), "djv::Core::PluginFactory",
-                    ErrorUtil::format(error).join("\n"));
-                in->releasePlugin();
+                try
+                {
+                    entry.plugin->initPlugin();
+                }
+                catch (const Error & error)
+                {
+                    DJV_LOG(_p->context->debugLog(), "djv::Core::PluginFactory",
+                        ErrorUtil::format(error).join("\n"));
+                    entry.plugin->releasePlugin();
+                    entry.error = true;
+                    return nullptr;
+                }
+                entry.init = true;
+                pluginInit(entry.plugin);
             }
+
+            return entry.plugin;
         }
 
         const QStringList & PluginFactory::errorLabels()
@@ -35,6 +35,7 @@
 #include <QObject>
 #include <QPointer>
 #include <QString>
+#include <QVariantMap>
 
 #include <memory>
 
@@ -69,6 +70,10 @@ namespace djv
             //! Get the plugin name.
             virtual QString pluginName() const = 0;
 
+            //! Get the information that is stored in the plugin manifest. This
+            //! is available from the factory without loading the plugin.
+            virtual QVariantMap pluginManifest() const;
+
             //! Get the context.
             const QPointer<CoreContext>& context() const;
 
@@ -78,6 +83,13 @@ namespace djv
         };
 
         //! This class provides the base functionality for plugin factories.
+        //!
+        //! Plugins are loaded lazily. The plugin libraries found in the search
+        //! path are recorded in a manifest file in the user's cache directory,
+        //! along with their modification time and plugin manifest information.
+        //! On later runs a library that has not changed is not opened until
+        //! the plugin is first requested. Plugins are likewise not initialized
+        //! until they are first requested.
         class PluginFactory : public QObject
         {
             Q_OBJECT
@@ -92,18 +104,27 @@ namespace djv
                 QObject * parent = nullptr);
             virtual ~PluginFactory() = 0;
 
-            //! Get the list of plugins.
+            //! Get the list of plugins. This loads and initializes all of the
+            //! plugins.
             QList<Plugin *> plugins() const;
 
-            //! Get a plugin by name.
+            //! Get a plugin by name, loading and initializing it if necessary.
+            //! Returns null if there is no plugin with the given name or it
+            //! cannot be loaded.
             Plugin * plugin(const QString &) const;
 
             //! Get the list of plugin names.
             QStringList names() const;
 
-            //! Add a plugin.
+            //! Get the manifest information for a plugin, without loading it.
+            QVariantMap pluginManifest(const QString &) const;
+
+            //! Add a plugin. The plugin is initialized on first use.
             virtual void addPlugin(Plugin *);
 
+            //! Get the manifest file name.
+            static QString manifestFileName(const QString & pluginEntry);
+
             //! This enumeration provides error codes.
             enum ERROR
             {
@@ -116,9 +137,15 @@ namespace djv
             //! Get the error code labels.
             static const QStringList & errorLabels();
 
+        protected:
+            //! This function is called when a plugin is initialized.
+            virtual void pluginInit(Plugin *) const {}
+
         private:
             DJV_PRIVATE_COPY(PluginFactory);
 
+            Plugin * _init(const QString &) const;
+
             struct Private;
             std::unique_ptr<Private> _p;
         };
@@ -78,19 +78,33 @@ namespace djv
         inline FrameRangeList RangeUtil::range(const FrameList & in)
         {
             FrameRangeList out;
-            if (in.count())
+            for (const auto & run : in.runs())
             {
-                out += FrameRange(in[0], in[0]);
-            }
-            for (int i = 1; i < in.count(); ++i)
-            {
-                if (in[i] - 1 != out[out.count() - 1].max)
+                if (run.step > 0 || 1 == run.count)
                 {
-                    out += FrameRange(in[i], in[i]);
+                    if (out.count() && run.start - 1 == out[out.count() - 1].max)
+                    {
+                        out[out.count() - 1].max = run.end();
+                    }
+                    else
+                    {
+                        out += FrameRange(run.start, run.end());
+                    }
                 }
                 else
                 {
-                    out[out.count() - 1].max = in[i];
+                    for (int i = 0; i < run.count; ++i)
+                    {
+                        const qint64 frame = run.frame(i);
+                        if (out.count() && frame - 1 == out[out.count() - 1].max)
+                        {
+                            out[out.count() - 1].max = frame;
+                        }
+                        else
+                        {
+                            out += FrameRange(frame, frame);
+                        }
+                    }
                 }
             }
             return out;
@@ -98,12 +112,7 @@ namespace djv
 
         inline FrameList RangeUtil::frames(const FrameRange & in)
         {
-            FrameList out;
-            for (qint64 i = in.min; i <= in.max; ++i)
-            {
-                out += i;
-            }
-            return out;
+            return in.min <= in.max ? FrameList(in.min, in.max) : FrameList();
         }
 
         inline FrameList RangeUtil::frames(const FrameRangeList & in)
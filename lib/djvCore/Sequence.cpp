@@ -68,55 +68,47 @@ namespace djv
 
         void Sequence::setFrames(qint64 start, qint64 end)
         {
-            if (start < end)
+            if (_maxSize <= 0)
             {
-                const qint64 size = Math::min<qint64>(end - start + 1, _maxSize);
-                frames.resize(size);
-                for (qint64 i = start, j = 0; i <= end && j < size; ++i, ++j)
-                {
-                    frames[j] = i;
-                }
+                frames.clear();
             }
-            else
+            else if (start < end)
             {
-                const qint64 size = Math::min<qint64>(start - end + 1, _maxSize);
-                frames.resize(size);
-                for (qint64 i = start, j = 0; i >= end && j < size; --i, ++j)
-                {
-                    frames[j] = i;
-                }
+                frames = FrameList(start, Math::min<qint64>(end, start + _maxSize - 1));
             }
-        }
-
-        namespace
-        {
-            bool compare(qint64 a, qint64 b)
+            else
             {
-                return a < b;
+                frames = FrameList(start, Math::max<qint64>(end, start - _maxSize + 1));
             }
-
-        } // namespace
+        }
 
         void Sequence::sort()
         {
-            qSort(frames.begin(), frames.end(), compare);
+            frames.sort();
         }
 
         qint64 Sequence::findClosest(qint64 frame, const FrameList & frames)
         {
-            const int count = frames.count();
-            if (!count)
+            if (!frames.count())
                 return -1;
             qint64 out = 0;
             qint64 min = 0;
-            for (int i = 0; i < count; ++i)
+            qint64 offset = 0;
+            bool first = true;
+            for (const auto & run : frames.runs())
             {
-                const qint64 tmp = Math::abs(frame - frames[i]);
-                if (tmp < min || 0 == i)
+                // Find the closest frame in the run.
+                const qint64 a = Math::min(run.start, run.end());
+                const qint64 b = Math::max(run.start, run.end());
+                const qint64 closest = Math::clamp(frame, a, b);
+                const qint64 tmp = Math::abs(frame - closest);
+                if (tmp < min || first)
                 {
-                    out = static_cast<qint64>(i);
+                    out = offset + (closest - run.start) * run.step;
                     min = tmp;
+                    first = false;
                 }
+                offset += run.count;
             }
             return out;
         }
@@ -168,65 +160,22 @@ namespace djv
             return p;
         }
 
-        namespace
-        {
-            enum INC
-            {
-                BREAK,
-                ASCEND,
-                DESCEND
-            };
-
-            INC inc(qint64 a, qint64 b)
-            {
-                if (a + 1 == b)
-                {
-                    return ASCEND;
-                }
-                else if (a - 1 == b)
-                {
-                    return DESCEND;
-                }
-                return BREAK;
-            }
-
-        } // namespace
-
         QString Sequence::sequenceToString(const Sequence & seq)
         {
             //DJV_DEBUG("Sequence::sequenceToString");
             //DJV_DEBUG_PRINT("frames = " << in.frames);
-
             QStringList out;
-            FrameList frames = seq.frames;
-            const int    count = frames.count();
-            const int    pad = seq.pad;
-
-            // Add the list end marker.
-            static const qint64 marker = std::numeric_limits<qint64>::min();
-            frames += marker;
-
-            // Sequence.
-            qint64 tmp = frames[0];
-            INC _inc = BREAK;
-            for (int i = 0; i < count; ++i)
+            for (const auto & run : seq.frames.runs())
             {
-                const INC inc_ = inc(frames[i], frames[i + 1]);
-                //DJV_DEBUG_PRINT(frames[i] << " = " << inc_);
-                if ((inc_ != _inc && _inc != BREAK) || BREAK == inc_)
+                if (run.count > 1)
                 {
-                    if (tmp != frames[i])
-                    {
-                        out += frameToString(tmp, pad) +
-                            "-" +
-                            frameToString(frames[i], pad);
-                    }
-                    else
-                    {
-                        out += frameToString(frames[i], pad);
-                    }
-                    tmp = frames[i + 1];
-                    _inc = inc_;
+                    out += frameToString(run.start, seq.pad) +
+                        "-" +
+                        frameToString(run.end(), seq.pad);
+                }
+                else
+                {
+                    out += frameToString(run.start, seq.pad);
                 }
             }
             //DJV_DEBUG_PRINT("out = " << out);
@@ -276,23 +225,7 @@ namespace djv
                     int          _pad = 0;
                     const qint64 start = stringToFrame(a, &_pad);
                     const qint64 end = b.count() ? stringToFrame(b) : start;
-                    if (start < end)
-                    {
-                        const qint64 size = end - start + 1;
-
-                        for (qint64 j = start, k = 0; j <= end && k < size; ++j, ++k)
-                        {
-                            out.frames += j;
-                        }
-                    }
-                    else
-                    {
-                        const qint64 size = start - end + 1;
-                        for (qint64 j = start, k = 0; j >= end && k < size; --j, ++k)
-                        {
-                            out.frames += j;
-                        }
-                    }
+                    out.frames += FrameList(start, end);
                     pad = Math::max(_pad, pad);
                 }
             }
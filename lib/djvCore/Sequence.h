@@ -29,18 +29,15 @@
 
 #pragma once
 
+#include <djvCore/FrameList.h>
 #include <djvCore/Speed.h>
 
 #include <QMetaType>
-#include <QVector>
 
 namespace djv
 {
     namespace Core
     {
-        //! This typedef provides a frame number list.
-        typedef QVector<qint64> FrameList;
-
         //! This class provides a sequence of frames.
         class Sequence
         {
@@ -33,12 +33,12 @@ namespace djv
     {
         inline qint64 Sequence::start() const
         {
-            return frames.count() ? frames[0] : 0;
+            return frames.count() ? frames.first() : 0;
         }
 
         inline qint64 Sequence::end() const
         {
-            return frames.count() ? frames[frames.count() - 1] : 0;
+            return frames.count() ? frames.last() : 0;
         }
         
         inline qint64 Sequence::stringToFrame(const QString & string, int * pad)
@@ -61,6 +61,7 @@
 #include <QPointer>
 #include <QPushButton>
 #include <QResizeEvent>
+#include <QScrollBar>
 #include <QShortcut>
 #include <QTreeView>
 #include <QVBoxLayout>
@@ -319,6 +320,7 @@ namespace djv
             _p->model->setColumnsSort(context->fileBrowserPrefs()->columnsSort());
             _p->model->setReverseSort(context->fileBrowserPrefs()->hasReverseSort());
             _p->model->setSortDirsFirst(context->fileBrowserPrefs()->hasSortDirsFirst());
+            _p->model->setIncremental(context->fileBrowserPrefs()->hasIncremental());
             _p->model->setThumbnailMode(context->fileBrowserPrefs()->thumbnailMode());
             _p->model->setThumbnailSize(context->fileBrowserPrefs()->thumbnailSize());
             _p->model->setPath(_p->fileInfo);
@@ -371,6 +373,10 @@ namespace djv
                 context->fileBrowserPrefs(),
                 SIGNAL(sortDirsFirstChanged(bool)),
                 SLOT(setSortDirsFirst(bool)));
+            _p->model->connect(
+                context->fileBrowserPrefs(),
+                SIGNAL(incrementalChanged(bool)),
+                SLOT(setIncremental(bool)));
             connect(
                 _p->actions.groups[Actions::RECENT_GROUP],
                 SIGNAL(triggered(QAction *)),
@@ -407,6 +413,18 @@ namespace djv
                 _p->widgets.browser,
                 SIGNAL(activated(const QModelIndex &)),
                 SLOT(browserCallback(const QModelIndex &)));
+            connect(
+                _p->widgets.browser->verticalScrollBar(),
+                SIGNAL(valueChanged(int)),
+                SLOT(visibleRowsUpdate()));
+            connect(
+                _p->widgets.browser->verticalScrollBar(),
+                SIGNAL(rangeChanged(int, int)),
+                SLOT(visibleRowsUpdate()));
+            connect(
+                _p->model,
+                SIGNAL(modelReset()),
+                SLOT(visibleRowsUpdate()));
             connect(
                 _p->widgets.browser->selectionModel(),
                 SIGNAL(currentChanged(const QModelIndex &, const QModelIndex &)),
@@ -843,6 +861,16 @@ namespace djv
             menuUpdate();
         }
 
+        void FileBrowser::visibleRowsUpdate()
+        {
+            const QRect rect = _p->widgets.browser->viewport()->rect();
+            const QModelIndex first = _p->widgets.browser->indexAt(rect.topLeft());
+            const QModelIndex last = _p->widgets.browser->indexAt(rect.bottomLeft());
+            _p->model->setVisibleRows(
+                first.isValid() ? first.row() : 0,
+                last.isValid() ? last.row() : _p->model->rowCount() - 1);
+        }
+
         void FileBrowser::modelUpdate()
         {
             //DJV_DEBUG("FileBrowser::modelUpdate");
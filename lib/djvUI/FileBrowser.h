@@ -147,6 +147,7 @@ namespace djv
             void acceptedCallback();
             
             void styleUpdate();
+            void visibleRowsUpdate();
             void modelUpdate();
             void widgetUpdate();
             void menuUpdate();
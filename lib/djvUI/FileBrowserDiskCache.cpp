@@ -0,0 +1,308 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvUI/FileBrowserDiskCache.h>
+
+#include <djvCore/Debug.h>
+#include <djvCore/StringUtil.h>
+#include <djvCore/System.h>
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QHash>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#if defined(DJV_WINDOWS)
+#include <sys/utime.h>
+#else // DJV_WINDOWS
+#include <utime.h>
+#endif // DJV_WINDOWS
+
+namespace djv
+{
+    namespace UI
+    {
+        namespace
+        {
+            //! When the cache exceeds the maximum size, thumbnails are removed
+            //! until it is below this fraction of the maximum so that every new
+            //! thumbnail does not cause a removal.
+            const float evictFraction = .9f;
+
+            //! Update the time of a file, used to keep track of the least
+            //! recently used thumbnails between sessions.
+            void touch(const QString & fileName)
+            {
+#if defined(DJV_WINDOWS)
+                ::_wutime(Core::StringUtil::qToStdWString(fileName).data(), nullptr);
+#else // DJV_WINDOWS
+                ::utime(fileName.toUtf8().data(), nullptr);
+#endif // DJV_WINDOWS
+            }
+
+            //! Remove a file, returns false if the file could not be removed. A
+            //! file that has already been removed by another session counts as
+            //! removed.
+            bool removeFile(const QString & fileName)
+            {
+                return QFile::remove(fileName) || !QFileInfo::exists(fileName);
+            }
+
+        } // namespace
+
+        struct FileBrowserDiskCache::Private
+        {
+            struct Entry
+            {
+                qint64 size = 0;
+                qint64 time = 0;
+            };
+
+            QString path;
+            qint64 maxSize = 0;
+            bool init = false;
+            QHash<QString, Entry> entries;
+            qint64 size = 0;
+            std::mutex mutex;
+
+            void scan()
+            {
+                if (init)
+                    return;
+                init = true;
+                const QFileInfoList list = QDir(path).entryInfoList(
+                    QStringList() << "*.png",
+                    QDir::Files);
+                Q_FOREACH(const QFileInfo & fileInfo, list)
+                {
+                    Entry entry;
+                    entry.size = fileInfo.size();
+                    entry.time = fileInfo.lastModified().toMSecsSinceEpoch();
+                    entries[fileInfo.fileName()] = entry;
+                    size += entry.size;
+                }
+            }
+        };
+
+        FileBrowserDiskCache::FileBrowserDiskCache(const QString & path) :
+            _p(new Private)
+        {
+            _p->path = path;
+        }
+
+        FileBrowserDiskCache::~FileBrowserDiskCache()
+        {}
+
+        QString FileBrowserDiskCache::pathDefault()
+        {
+            const QString env = Core::System::env("DJV_THUMBNAIL_CACHE_PATH");
+            if (!env.isEmpty())
+                return env;
+            return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + "/djv/Thumbnails";
+        }
+
+        const QString & FileBrowserDiskCache::path() const
+        {
+            return _p->path;
+        }
+
+        qint64 FileBrowserDiskCache::maxSize() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->maxSize;
+        }
+
+        qint64 FileBrowserDiskCache::size() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->size;
+        }
+
+        void FileBrowserDiskCache::setMaxSize(qint64 size)
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            _p->maxSize = size;
+            if (_p->init)
+            {
+                _evict();
+            }
+        }
+
+        QImage FileBrowserDiskCache::get(
+            const Core::FileInfo &           fileInfo,
+            FileBrowserModel::THUMBNAIL_MODE thumbnailMode,
+            const glm::ivec2 &               resolution,
+            AV::PixelDataInfo::PROXY         proxy)
+        {
+            //DJV_DEBUG("FileBrowserDiskCache::get");
+            //DJV_DEBUG_PRINT("fileInfo = " << fileInfo);
+            {
+                std::lock_guard<std::mutex> lock(_p->mutex);
+                if (!_p->maxSize)
+                    return QImage();
+            }
+            const QString name = _fileName(fileInfo, thumbnailMode, resolution, proxy);
+            const QString fileName = _p->path + "/" + name;
+
+            // The file is checked even if it is not in the list of entries since
+            // another session may have added it.
+            QImage image;
+            if (image.load(fileName, "PNG") && image.width() == resolution.x && image.height() == resolution.y)
+            {
+                //DJV_DEBUG_PRINT("hit = " << fileName);
+                touch(fileName);
+                std::lock_guard<std::mutex> lock(_p->mutex);
+                _p->scan();
+                auto i = _p->entries.find(name);
+                if (i == _p->entries.end())
+                {
+                    Private::Entry entry;
+                    entry.size = QFileInfo(fileName).size();
+                    i = _p->entries.insert(name, entry);
+                    _p->size += entry.size;
+                }
+                i.value().time = QDateTime::currentMSecsSinceEpoch();
+                return image;
+            }
+            return QImage();
+        }
+
+        void FileBrowserDiskCache::insert(
+            const Core::FileInfo &           fileInfo,
+            FileBrowserModel::THUMBNAIL_MODE thumbnailMode,
+            const glm::ivec2 &               resolution,
+            AV::PixelDataInfo::PROXY         proxy,
+            const QImage &                   image)
+        {
+            //DJV_DEBUG("FileBrowserDiskCache::insert");
+            //DJV_DEBUG_PRINT("fileInfo = " << fileInfo);
+            if (image.isNull())
+                return;
+            {
+                std::lock_guard<std::mutex> lock(_p->mutex);
+                if (!_p->maxSize)
+                    return;
+            }
+            const QString name = _fileName(fileInfo, thumbnailMode, resolution, proxy);
+            const QString fileName = _p->path + "/" + name;
+
+            // Write the file so that other sessions never see a partial file.
+            QDir().mkpath(_p->path);
+            QSaveFile file(fileName);
+            if (!file.open(QIODevice::WriteOnly) ||
+                !image.save(&file, "PNG") ||
+                !file.commit())
+                return;
+            QFile::setPermissions(
+                fileName,
+                QFileDevice::ReadOwner | QFileDevice::WriteOwner |
+                QFileDevice::ReadGroup | QFileDevice::ReadOther);
+
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            _p->scan();
+            Private::Entry & entry = _p->entries[name];
+            _p->size -= entry.size;
+            entry.size = QFileInfo(fileName).size();
+            entry.time = QDateTime::currentMSecsSinceEpoch();
+            _p->size += entry.size;
+            _evict();
+        }
+
+        void FileBrowserDiskCache::clear()
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            _p->scan();
+            for (auto i = _p->entries.begin(); i != _p->entries.end();)
+            {
+                if (removeFile(_p->path + "/" + i.key()))
+                {
+                    _p->size -= i.value().size;
+                    i = _p->entries.erase(i);
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+        }
+
+        QString FileBrowserDiskCache::_fileName(
+            const Core::FileInfo &           fileInfo,
+            FileBrowserModel::THUMBNAIL_MODE thumbnailMode,
+            const glm::ivec2 &               resolution,
+            AV::PixelDataInfo::PROXY         proxy) const
+        {
+            const QString key = QString("%1|%2|%3|%4|%5x%6|%7").
+                arg(QFileInfo(fileInfo.fileName()).absoluteFilePath()).
+                arg(static_cast<qint64>(fileInfo.time())).
+                arg(fileInfo.size()).
+                arg(thumbnailMode).
+                arg(resolution.x).
+                arg(resolution.y).
+                arg(proxy);
+            return QString::fromLatin1(QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex()) + ".png";
+        }
+
+        void FileBrowserDiskCache::_evict()
+        {
+            if (_p->size <= _p->maxSize)
+                return;
+            //DJV_DEBUG("FileBrowserDiskCache::_evict");
+            //DJV_DEBUG_PRINT("size = " << _p->size);
+
+            // Remove the least recently used thumbnails first.
+            std::vector<std::pair<qint64, QString> > list;
+            for (auto i = _p->entries.begin(); i != _p->entries.end(); ++i)
+            {
+                list.push_back(std::make_pair(i.value().time, i.key()));
+            }
+            std::sort(list.begin(), list.end());
+            const qint64 size = static_cast<qint64>(_p->maxSize * evictFraction);
+            for (const auto & i : list)
+            {
+                if (_p->size <= size)
+                    break;
+                if (removeFile(_p->path + "/" + i.second))
+                {
+                    _p->size -= _p->entries[i.second].size;
+                    _p->entries.remove(i.second);
+                }
+            }
+            //DJV_DEBUG_PRINT("size = " << _p->size);
+        }
+
+    } // namespace UI
+} // namespace djv
@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <djvUI/FileBrowserModel.h>
+
+#include <djvAV/PixelData.h>
+
+#include <djvCore/FileInfo.h>
+
+#include <QImage>
+
+#include <memory>
+
+namespace djv
+{
+    namespace UI
+    {
+        //! This class provides a persistent file browser thumbnail cache.
+        //!
+        //! The thumbnails are stored as image files in a directory, keyed by the
+        //! file name, time, and size of the file, and the thumbnail mode,
+        //! resolution, and proxy scale. The least recently used thumbnails are
+        //! removed when the cache exceeds the maximum size. The directory may be
+        //! shared between sessions and users; the default can be changed with
+        //! the DJV_THUMBNAIL_CACHE_PATH environment variable.
+        //!
+        //! This class is thread safe.
+        class FileBrowserDiskCache
+        {
+        public:
+            explicit FileBrowserDiskCache(const QString & path = pathDefault());
+            ~FileBrowserDiskCache();
+
+            //! Get the default cache directory.
+            static QString pathDefault();
+
+            //! Get the cache directory.
+            const QString & path() const;
+
+            //! Get the maximum cache size in bytes.
+            qint64 maxSize() const;
+
+            //! Get the current cache size in bytes.
+            qint64 size() const;
+
+            //! Set the maximum cache size in bytes. A size of zero disables the
+            //! cache.
+            void setMaxSize(qint64);
+
+            //! Get a thumbnail from the cache. The file information should be
+            //! for the file that is decoded, the first frame of a sequence, and
+            //! come from the file system (see Core::FileInfo::stat()). Returns a
+            //! null image if the thumbnail is not in the cache.
+            QImage get(
+                const Core::FileInfo &,
+                FileBrowserModel::THUMBNAIL_MODE,
+                const glm::ivec2 &       resolution,
+                AV::PixelDataInfo::PROXY);
+
+            //! Add a thumbnail to the cache.
+            void insert(
+                const Core::FileInfo &,
+                FileBrowserModel::THUMBNAIL_MODE,
+                const glm::ivec2 &       resolution,
+                AV::PixelDataInfo::PROXY,
+                const QImage &);
+
+            //! Remove all of the thumbnails.
+            void clear();
+
+        private:
+            QString _fileName(
+                const Core::FileInfo &,
+                FileBrowserModel::THUMBNAIL_MODE,
+                const glm::ivec2 &,
+                AV::PixelDataInfo::PROXY) const;
+            void _evict();
+
+            DJV_PRIVATE_COPY(FileBrowserDiskCache);
+
+            struct Private;
+            std::unique_ptr<Private> _p;
+        };
+
+    } // namespace UI
+} // namespace djv
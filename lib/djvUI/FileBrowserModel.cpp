@@ -40,21 +40,36 @@
 #include <djvCore/Error.h>
 #include <djvCore/ErrorUtil.h>
 #include <djvCore/FileInfoUtil.h>
+#include <djvCore/Math.h>
 #include <djvCore/Memory.h>
 #include <djvCore/User.h>
 #include <djvCore/VectorUtil.h>
 
 #include <QApplication>
+#include <QHash>
 #include <QMimeData>
 #include <QStyle>
+#include <QTimerEvent>
+
+#include <atomic>
+#include <future>
+#include <mutex>
 
 namespace djv
 {
     namespace UI
     {
+        namespace
+        {
+            //! The interval in milliseconds for collecting file information.
+            const int statTimerInterval = 10;
+
+        } // namespace
+
         struct FileBrowserModel::Private
         {
             Private(const QPointer<UIContext> & context) :
+                statCanceled(false),
                 context(context)
             {}
 
@@ -65,14 +80,35 @@ namespace djv
             FileBrowserModel::COLUMNS columnsSort = FileBrowserModel::NAME;
             bool reverseSort = false;
             bool sortDirsFirst = true;
+            bool incremental = false;
             FileBrowserModel::THUMBNAIL_MODE thumbnailMode = FileBrowserModel::THUMBNAIL_MODE_HIGH;
             FileBrowserModel::THUMBNAIL_SIZE thumbnailSize = FileBrowserModel::THUMBNAIL_MEDIUM;
             Core::FileInfoList list;
             Core::FileInfoList listTmp;
             mutable QVector<FileBrowserItem *> items;
+            QHash<QString, int> rows;
+            std::future<void> statFuture;
+            std::atomic<bool> statCanceled;
+            std::mutex statMutex;
+            std::vector<std::pair<int, Core::FileInfo> > statResults;
+            int statTimer = 0;
+            int visibleFirst = -1;
+            int visibleLast = -1;
             QPointer<UIContext> context;
         };
 
+        namespace
+        {
+            //! Get the thumbnail request priority for a row. The visible rows
+            //! come first, from the top down.
+            int rowPriority(int row, int first, int last, int count)
+            {
+                const bool visible = -1 == first || (row >= first && row <= last);
+                return (visible ? count : 0) + count - row;
+            }
+
+        } // namespace
+
         const QStringList & FileBrowserModel::columnsLabels()
         {
             static const QStringList data = QStringList() <<
@@ -102,6 +138,7 @@ namespace djv
         
         FileBrowserModel::~FileBrowserModel()
         {
+            statCancel();
             for (int i = 0; i < _p->items.count(); ++i)
             {
                 delete _p->items[i];
@@ -162,6 +199,11 @@ namespace djv
             return _p->sortDirsFirst;
         }
 
+        bool FileBrowserModel::hasIncremental() const
+        {
+            return _p->incremental;
+        }
+
         const QStringList & FileBrowserModel::thumbnailModeLabels()
         {
             static const QStringList data = QStringList() <<
@@ -262,7 +304,11 @@ namespace djv
                 case NAME:
                     if (_p->thumbnailMode != THUMBNAIL_MODE_OFF)
                     {
-                        item->requestImage();
+                        item->requestImage(rowPriority(
+                            row,
+                            _p->visibleFirst,
+                            _p->visibleLast,
+                            _p->items.count()));
                         return item->thumbnail();
                     }
                     return pixmaps[fileInfo.type()];
@@ -400,6 +446,14 @@ namespace djv
             Q_EMIT optionChanged();
         }
 
+        void FileBrowserModel::setIncremental(bool value)
+        {
+            if (value == _p->incremental)
+                return;
+            _p->incremental = value;
+            Q_EMIT incrementalChanged(_p->incremental);
+        }
+
         void FileBrowserModel::setThumbnailMode(THUMBNAIL_MODE value)
         {
             if (value == _p->thumbnailMode)
@@ -420,6 +474,83 @@ namespace djv
             Q_EMIT optionChanged();
         }
 
+        void FileBrowserModel::setVisibleRows(int first, int last)
+        {
+            if (first == _p->visibleFirst && last == _p->visibleLast)
+                return;
+            //DJV_DEBUG("FileBrowserModel::setVisibleRows");
+            //DJV_DEBUG_PRINT("first = " << first);
+            //DJV_DEBUG_PRINT("last = " << last);
+            _p->visibleFirst = first;
+            _p->visibleLast = last;
+            const int count = _p->items.count();
+            for (int i = 0; i < count; ++i)
+            {
+                FileBrowserItem * item = _p->items[i];
+                if (item->hasRequests())
+                {
+                    if (i >= first && i <= last)
+                    {
+                        item->setRequestPriority(rowPriority(i, first, last, count));
+                    }
+                    else
+                    {
+                        item->cancelRequests();
+                    }
+                }
+            }
+        }
+
+        void FileBrowserModel::timerEvent(QTimerEvent * event)
+        {
+            if (_p->statTimer != event->timerId())
+                return;
+
+            //DJV_DEBUG("FileBrowserModel::timerEvent");
+            const bool finished =
+                _p->statFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            std::vector<std::pair<int, Core::FileInfo> > results;
+            {
+                std::lock_guard<std::mutex> lock(_p->statMutex);
+                std::swap(results, _p->statResults);
+            }
+            //DJV_DEBUG_PRINT("results = " << static_cast<int>(results.size()));
+
+            // Update the rows that are shown.
+            int rowMin = -1;
+            int rowMax = -1;
+            for (const auto & i : results)
+            {
+                _p->list[i.first] = i.second;
+                const auto j = _p->rows.find(i.second.fileName());
+                if (j != _p->rows.end())
+                {
+                    const int row = j.value();
+                    _p->listTmp[row] = i.second;
+                    _p->items[row]->setFileInfo(i.second);
+                    rowMin = rowMin != -1 ? Core::Math::min(rowMin, row) : row;
+                    rowMax = Core::Math::max(rowMax, row);
+                }
+            }
+            if (rowMin != -1)
+            {
+                Q_EMIT dataChanged(index(rowMin, 0), index(rowMax, COLUMNS_COUNT - 1));
+            }
+
+            if (finished)
+            {
+                _p->statFuture.get();
+                killTimer(_p->statTimer);
+                _p->statTimer = 0;
+
+                // The sorting may depend on the file information.
+                if (_p->columnsSort != NAME)
+                {
+                    modelUpdate();
+                }
+            }
+        }
+
         void FileBrowserModel::ioInfoCallback()
         {
             //DJV_DEBUG("FileBrowserModel::ioInfoCallback");
@@ -453,8 +584,12 @@ namespace djv
             //DJV_DEBUG("FileBrowserModel::dirUpdate");
             //DJV_DEBUG_PRINT("path = " << _p->path);
 
-            // Get directory contents.
-            _p->list = Core::FileInfoUtil::list(_p->path, _p->sequence);
+            statCancel();
+
+            // Get directory contents. In incremental mode only the file types
+            // are read here, and the rest of the information is retrieved by
+            // a thread and shown as it becomes available.
+            _p->list = Core::FileInfoUtil::list(_p->path, _p->sequence, !_p->incremental);
 
             // Add parent directory.
             if (Core::FileInfo(_p->path).exists())
@@ -464,6 +599,44 @@ namespace djv
             //DJV_DEBUG_PRINT("list = " << _p->list.count());
             //Q_FOREACH(const Core::FileInfo & fileInfo, _p->list)
             //    DJV_DEBUG_PRINT("fileInfo = " << fileInfo << " " << fileInfo.type());
+
+            if (_p->incremental && _p->list.count())
+            {
+                _p->statCanceled = false;
+                Core::FileInfoList list = _p->list;
+                _p->statFuture = std::async(
+                    std::launch::async,
+                    [this, list]() mutable
+                {
+                    Core::FileInfoUtil::stat(
+                        list,
+                        [this, &list](int begin, int end)
+                    {
+                        std::lock_guard<std::mutex> lock(_p->statMutex);
+                        for (int i = begin; i < end; ++i)
+                        {
+                            _p->statResults.push_back(std::make_pair(i, list[i]));
+                        }
+                        return !_p->statCanceled;
+                    });
+                });
+                _p->statTimer = startTimer(statTimerInterval);
+            }
+        }
+
+        void FileBrowserModel::statCancel()
+        {
+            if (_p->statFuture.valid())
+            {
+                _p->statCanceled = true;
+                _p->statFuture.get();
+            }
+            if (_p->statTimer)
+            {
+                killTimer(_p->statTimer);
+                _p->statTimer = 0;
+            }
+            _p->statResults.clear();
         }
 
         void FileBrowserModel::modelUpdate()
@@ -517,8 +690,13 @@ namespace djv
             }
             _p->items.clear();
             _p->items.resize(_p->listTmp.count());
+            _p->rows.clear();
             for (int i = 0; i < _p->listTmp.count(); ++i)
             {
+                if (_p->statTimer)
+                {
+                    _p->rows[_p->listTmp[i].fileName()] = i;
+                }
                 //DJV_DEBUG_PRINT("i = " << i);
                 FileBrowserItem * item = new FileBrowserItem(
                     _p->listTmp[i],
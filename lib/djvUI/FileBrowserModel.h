@@ -99,6 +99,14 @@ namespace djv
                 WRITE  setSortDirsFirst
                 NOTIFY sortDirsFirstChanged)
 
+            //! This property holds whether file information is shown as it is
+            //! retrieved, instead of waiting for the whole directory.
+            Q_PROPERTY(
+                bool   incremental
+                READ   hasIncremental
+                WRITE  setIncremental
+                NOTIFY incrementalChanged)
+
             //! This property holds the image thumbnail mode.
             Q_PROPERTY(
                 FileBrowserModel::THUMBNAIL_MODE thumbnailMode
@@ -163,6 +171,9 @@ namespace djv
             //! Get whether directories are sorted first.
             bool hasSortDirsFirst() const;
 
+            //! Get whether file information is shown as it is retrieved.
+            bool hasIncremental() const;
+
             //! This enumeration provides the image thumbnail mode.
             enum THUMBNAIL_MODE
             {
@@ -210,6 +221,9 @@ namespace djv
             QStringList mimeTypes() const override;
             QMimeData * mimeData(const QModelIndexList &) const override;
 
+        protected:
+            void timerEvent(QTimerEvent *) override;
+
         public Q_SLOTS:
             //! Set the path.
             void setPath(const QString &);
@@ -235,12 +249,20 @@ namespace djv
             //! Set whether directories are sorted first.
             void setSortDirsFirst(bool);
 
+            //! Set whether file information is shown as it is retrieved.
+            void setIncremental(bool);
+
             //! Set the image thumbnail mode.
             void setThumbnailMode(djv::UI::FileBrowserModel::THUMBNAIL_MODE);
 
             //! Set the image thumbnail size.
             void setThumbnailSize(djv::UI::FileBrowserModel::THUMBNAIL_SIZE);
 
+            //! Set the rows that are visible in the view. The thumbnails for
+            //! the visible rows are generated first, from the top down, and the
+            //! pending requests for the other rows are canceled.
+            void setVisibleRows(int first, int last);
+
         Q_SIGNALS:
             //! This signal is emitted when the path is changed.
             void pathChanged(const QString &);
@@ -263,6 +285,9 @@ namespace djv
             //! This signal is emitted when sort directories first is changed.
             void sortDirsFirstChanged(bool);
 
+            //! This signal is emitted when incremental file information is changed.
+            void incrementalChanged(bool);
+
             //! This signal is emitted when the thumbnail mode is changed.
             void thumbnailModeChanged(djv::UI::FileBrowserModel::THUMBNAIL_MODE);
 
@@ -281,6 +306,8 @@ namespace djv
             void modelUpdate();
 
         private:
+            void statCancel();
+
             DJV_PRIVATE_COPY(FileBrowserModel);
 
             struct Private;
@@ -59,26 +59,10 @@ namespace djv
             _context(context),
             _fileInfo(fileInfo),
             _thumbnailMode(thumbnailMode),
-            _thumbnailSize(thumbnailSize)
+            _thumbnailSize(thumbnailSize),
+            _requestId(FileBrowserThumbnailSystem::createId())
         {
-            // Initialize the display role data.
-            _displayRole[FileBrowserModel::NAME] = fileInfo.name();
-            _displayRole[FileBrowserModel::SIZE] = Core::Memory::sizeLabel(fileInfo.size());
-#if ! defined(DJV_WINDOWS)
-            _displayRole[FileBrowserModel::USER] =
-                Core::User::uidToString(fileInfo.user());
-#endif // DJV_WINDOWS
-            _displayRole[FileBrowserModel::PERMISSIONS] = Core::FileInfo::permissionsLabel(fileInfo.permissions());
-            _displayRole[FileBrowserModel::TIME] = Core::Time::timeToString(fileInfo.time());
-
-            // Initialize the edit role data.
-            _editRole[FileBrowserModel::NAME].setValue<Core::FileInfo>(fileInfo);
-            _editRole[FileBrowserModel::SIZE] = fileInfo.size();
-#if ! defined(DJV_WINDOWS)
-            _editRole[FileBrowserModel::USER] = fileInfo.user();
-#endif // DJV_WINDOWS
-            _editRole[FileBrowserModel::PERMISSIONS] = fileInfo.permissions();
-            _editRole[FileBrowserModel::TIME] = QDateTime::fromTime_t(fileInfo.time());
+            updateFileInfo();
 
             // Check the cache to see if this item already exists.
             if (FileBrowserCacheItem * item = context->fileBrowserCache()->object(_fileInfo))
@@ -93,11 +77,23 @@ namespace djv
             }
         }
 
+        FileBrowserItem::~FileBrowserItem()
+        {
+            cancelRequests();
+        }
+
         const Core::FileInfo & FileBrowserItem::fileInfo() const
         {
             return _fileInfo;
         }
 
+        void FileBrowserItem::setFileInfo(const Core::FileInfo & fileInfo)
+        {
+            _fileInfo = fileInfo;
+            updateFileInfo();
+            updateIOInfo();
+        }
+
         const AV::IOInfo & FileBrowserItem::ioInfo() const
         {
             return _ioInfo;
@@ -118,23 +114,62 @@ namespace djv
             return _editRole[column];
         }
 
-        void FileBrowserItem::requestImage()
+        bool FileBrowserItem::hasRequests() const
+        {
+            return _ioInfoRequestTimer || _thumbnailRequestTimer;
+        }
+
+        void FileBrowserItem::setRequestPriority(int priority)
+        {
+            if (hasRequests())
+            {
+                _context->fileBrowserThumbnailSystem()->setPriority(_requestId, priority);
+            }
+        }
+
+        void FileBrowserItem::cancelRequests()
+        {
+            if (!hasRequests())
+                return;
+            if (_context && _context->fileBrowserThumbnailSystem())
+            {
+                _context->fileBrowserThumbnailSystem()->cancel(_requestId);
+            }
+            if (_ioInfoRequestTimer)
+            {
+                killTimer(_ioInfoRequestTimer);
+                _ioInfoRequestTimer = 0;
+                _ioInfoRequest = std::future<AV::IOInfo>();
+                _ioInfoInit = false;
+            }
+            if (_thumbnailRequestTimer)
+            {
+                killTimer(_thumbnailRequestTimer);
+                _thumbnailRequestTimer = 0;
+                _thumbnailRequest = std::future<QImage>();
+                _thumbnailInit = false;
+            }
+        }
+
+        void FileBrowserItem::requestImage(int priority)
         {
             if (!_ioInfoInit)
             {
                 _ioInfoInit = true;
-                _ioInfoRequest = _context->fileBrowserThumbnailSystem()->getInfo(_fileInfo);
+                _ioInfoRequest = _context->fileBrowserThumbnailSystem()->getInfo(_fileInfo, _requestId, priority);
                 _ioInfoRequestTimer = startTimer(0);
             }
 
             if (!_thumbnailInit && Core::VectorUtil::isSizeValid(_thumbnailResolution))
             {
                 _thumbnailInit = true;
-                _thumbnailRequest = _context->fileBrowserThumbnailSystem()->getPixmap(
+                _thumbnailRequest = _context->fileBrowserThumbnailSystem()->getImage(
                     _fileInfo,
                     _thumbnailMode,
                     _thumbnailResolution,
-                    _thumbnailProxy);
+                    _thumbnailProxy,
+                    _requestId,
+                    priority);
                 _thumbnailRequestTimer = startTimer(0);
             }
         }
@@ -177,7 +212,7 @@ namespace djv
         {
             if (_ioInfoRequestTimer == event->timerId())
             {
-                if (_ioInfoRequest.valid())
+                if (_ioInfoRequest.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
                 {
                     _ioInfo = _ioInfoRequest.get();
                     AV::PixelDataInfo::PROXY thumbnailProxy = static_cast<AV::PixelDataInfo::PROXY>(0);
@@ -196,9 +231,9 @@ namespace djv
             }
             else if (_thumbnailRequestTimer == event->timerId())
             {
-                if (_thumbnailRequest.valid())
+                if (_thumbnailRequest.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
                 {
-                    _thumbnail = _thumbnailRequest.get();
+                    _thumbnail = QPixmap::fromImage(_thumbnailRequest.get());
                     _context->fileBrowserCache()->insert(
                         _fileInfo,
                         new FileBrowserCacheItem(
@@ -214,6 +249,28 @@ namespace djv
             }
         }
 
+        void FileBrowserItem::updateFileInfo()
+        {
+            // Initialize the display role data.
+            _displayRole[FileBrowserModel::NAME] = _fileInfo.name();
+            _displayRole[FileBrowserModel::SIZE] = Core::Memory::sizeLabel(_fileInfo.size());
+#if ! defined(DJV_WINDOWS)
+            _displayRole[FileBrowserModel::USER] =
+                Core::User::uidToString(_fileInfo.user());
+#endif // DJV_WINDOWS
+            _displayRole[FileBrowserModel::PERMISSIONS] = Core::FileInfo::permissionsLabel(_fileInfo.permissions());
+            _displayRole[FileBrowserModel::TIME] = Core::Time::timeToString(_fileInfo.time());
+
+            // Initialize the edit role data.
+            _editRole[FileBrowserModel::NAME].setValue<Core::FileInfo>(_fileInfo);
+            _editRole[FileBrowserModel::SIZE] = _fileInfo.size();
+#if ! defined(DJV_WINDOWS)
+            _editRole[FileBrowserModel::USER] = _fileInfo.user();
+#endif // DJV_WINDOWS
+            _editRole[FileBrowserModel::PERMISSIONS] = _fileInfo.permissions();
+            _editRole[FileBrowserModel::TIME] = QDateTime::fromTime_t(_fileInfo.time());
+        }
+
         void FileBrowserItem::updateIOInfo()
         {
             if (Core::VectorUtil::isSizeValid(_ioInfo.layers[0].size))
@@ -55,10 +55,15 @@ namespace djv
                 FileBrowserModel::THUMBNAIL_SIZE,
                 const QPointer<UIContext> &,
                 QObject * parent);
+            ~FileBrowserItem() override;
 
             //! Get the file information.
             const Core::FileInfo & fileInfo() const;
 
+            //! Set the file information. This is used when the information is
+            //! retrieved from the file system after the item is created.
+            void setFileInfo(const Core::FileInfo &);
+
             //! Get the I/O information.
             const AV::IOInfo & ioInfo() const;
 
@@ -71,9 +76,19 @@ namespace djv
             //! Get the edit role data.
             const QVariant & editRole(int column) const;
 
+            //! Get whether there are pending requests.
+            bool hasRequests() const;
+
+            //! Change the priority of the pending requests.
+            void setRequestPriority(int);
+
+            //! Cancel the pending requests. They are made again the next time
+            //! the image is requested.
+            void cancelRequests();
+
         public Q_SLOTS:
             //! Request the image.
-            void requestImage();
+            void requestImage(int priority = 0);
 
         Q_SIGNALS:
             //! This signal is emitted when the I/O information is available.
@@ -86,6 +101,7 @@ namespace djv
             void timerEvent(QTimerEvent *) override;
 
         private:
+            void updateFileInfo();
             void updateIOInfo();
 
             QPointer<UIContext> _context;
@@ -94,12 +110,13 @@ namespace djv
             FileBrowserModel::THUMBNAIL_SIZE _thumbnailSize = static_cast<FileBrowserModel::THUMBNAIL_SIZE>(0);
             glm::ivec2 _thumbnailResolution = glm::ivec2(0, 0);
             AV::PixelDataInfo::PROXY _thumbnailProxy = static_cast<AV::PixelDataInfo::PROXY>(0);
+            quint64 _requestId = 0;
             bool _ioInfoInit = false;
             std::future<AV::IOInfo> _ioInfoRequest;
             int _ioInfoRequestTimer = 0;
             AV::IOInfo _ioInfo;
             bool _thumbnailInit = false;
-            std::future<QPixmap> _thumbnailRequest;
+            std::future<QImage> _thumbnailRequest;
             int _thumbnailRequestTimer = 0;
             QPixmap _thumbnail;
             QVariant _displayRole[FileBrowserModel::COLUMNS_COUNT];
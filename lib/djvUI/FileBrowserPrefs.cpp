@@ -30,6 +30,7 @@
 #include <djvUI/FileBrowserPrefs.h>
 
 #include <djvUI/FileBrowserCache.h>
+#include <djvUI/FileBrowserDiskCache.h>
 #include <djvUI/UIContext.h>
 #include <djvUI/Prefs.h>
 
@@ -53,9 +54,11 @@ namespace djv
             FileBrowserModel::COLUMNS columnsSort = FileBrowserPrefs::columnsSortDefault();
             bool reverseSort = FileBrowserPrefs::reverseSortDefault();
             bool sortDirsFirst = FileBrowserPrefs::sortDirsFirstDefault();
+            bool incremental = FileBrowserPrefs::incrementalDefault();
             FileBrowserModel::THUMBNAIL_MODE thumbnailMode = FileBrowserPrefs::thumbnailModeDefault();
             FileBrowserModel::THUMBNAIL_SIZE thumbnailSize = FileBrowserPrefs::thumbnailSizeDefault();
             qint64 thumbnailCache = FileBrowserPrefs::thumbnailCacheDefault();
+            qint64 thumbnailDiskCache = FileBrowserPrefs::thumbnailDiskCacheDefault();
             QStringList recent;
             QStringList bookmarks;
             QVector<Shortcut> shortcuts = FileBrowserPrefs::shortcutsDefault();
@@ -78,9 +81,11 @@ namespace djv
             prefs.get("columnsSort", _p->columnsSort);
             prefs.get("reverseSort", _p->reverseSort);
             prefs.get("sortDirsFirst", _p->sortDirsFirst);
+            prefs.get("incremental", _p->incremental);
             prefs.get("thumbnailMode", _p->thumbnailMode);
             prefs.get("thumbnailSize", _p->thumbnailSize);
             prefs.get("thumbnailCache", _p->thumbnailCache);
+            prefs.get("thumbnailDiskCache", _p->thumbnailDiskCache);
             prefs.get("recent", _p->recent);
             prefs.get("bookmarks", _p->bookmarks);
             if (_p->recent.count() > Core::FileInfoUtil::recentMax)
@@ -104,9 +109,11 @@ namespace djv
             prefs.set("columnsSort", _p->columnsSort);
             prefs.set("reverseSort", _p->reverseSort);
             prefs.set("sortDirsFirst", _p->sortDirsFirst);
+            prefs.set("incremental", _p->incremental);
             prefs.set("thumbnailMode", _p->thumbnailMode);
             prefs.set("thumbnailSize", _p->thumbnailSize);
             prefs.set("thumbnailCache", _p->thumbnailCache);
+            prefs.set("thumbnailDiskCache", _p->thumbnailDiskCache);
             prefs.set("recent", _p->recent);
             prefs.set("bookmarks", _p->bookmarks);
             Prefs shortcutsPrefs("djv::UI::FileBrowserPrefs/Shortcuts");
@@ -163,6 +170,16 @@ namespace djv
             return _p->sortDirsFirst;
         }
 
+        bool FileBrowserPrefs::incrementalDefault()
+        {
+            return false;
+        }
+
+        bool FileBrowserPrefs::hasIncremental() const
+        {
+            return _p->incremental;
+        }
+
         FileBrowserModel::THUMBNAIL_MODE FileBrowserPrefs::thumbnailModeDefault()
         {
             return FileBrowserModel::THUMBNAIL_MODE_HIGH;
@@ -193,6 +210,16 @@ namespace djv
             return _p->thumbnailCache;
         }
 
+        qint64 FileBrowserPrefs::thumbnailDiskCacheDefault()
+        {
+            return 512 * Core::Memory::megabyte;
+        }
+
+        qint64 FileBrowserPrefs::thumbnailDiskCache() const
+        {
+            return _p->thumbnailDiskCache;
+        }
+
         const QStringList & FileBrowserPrefs::recent() const
         {
             return _p->recent;
@@ -331,6 +358,15 @@ namespace djv
             Q_EMIT prefChanged();
         }
 
+        void FileBrowserPrefs::setIncremental(bool value)
+        {
+            if (value == _p->incremental)
+                return;
+            _p->incremental = value;
+            Q_EMIT incrementalChanged(_p->incremental);
+            Q_EMIT prefChanged();
+        }
+
         void FileBrowserPrefs::setThumbnailMode(FileBrowserModel::THUMBNAIL_MODE thumbnailMode)
         {
             if (thumbnailMode == _p->thumbnailMode)
@@ -361,6 +397,16 @@ namespace djv
             Q_EMIT prefChanged();
         }
 
+        void FileBrowserPrefs::setThumbnailDiskCache(qint64 size)
+        {
+            if (size == _p->thumbnailDiskCache)
+                return;
+            _p->thumbnailDiskCache = size;
+            _p->context->fileBrowserDiskCache()->setMaxSize(_p->thumbnailDiskCache);
+            Q_EMIT thumbnailDiskCacheChanged(_p->thumbnailDiskCache);
+            Q_EMIT prefChanged();
+        }
+
         void FileBrowserPrefs::setRecent(const QStringList & in)
         {
             if (in == _p->recent)
@@ -73,6 +73,14 @@ namespace djv
                 WRITE  setSortDirsFirst
                 NOTIFY sortDirsFirstChanged)
 
+            //! This property holds whether file information is shown as it is
+            //! retrieved.
+            Q_PROPERTY(
+                bool   incremental
+                READ   hasIncremental
+                WRITE  setIncremental
+                NOTIFY incrementalChanged)
+
             //! This property holds the image thumbnail mode.
             Q_PROPERTY(
                 FileBrowserModel::THUMBNAIL_MODE thumbnailMode
@@ -94,6 +102,13 @@ namespace djv
                 WRITE  setThumbnailCache
                 NOTIFY thumbnailCacheChanged)
 
+            //! This property holds the persistent image thumbnail cache size.
+            Q_PROPERTY(
+                qint64 thumbnailDiskCache
+                READ   thumbnailDiskCache
+                WRITE  setThumbnailDiskCache
+                NOTIFY thumbnailDiskCacheChanged)
+
             //! This property holds the list of recent directories.
             Q_PROPERTY(
                 QStringList recent
@@ -145,6 +160,12 @@ namespace djv
             //! Get whether directories are sorted first.
             bool hasSortDirsFirst() const;
 
+            //! Get the incremental file information default.
+            static bool incrementalDefault();
+
+            //! Get whether file information is shown as it is retrieved.
+            bool hasIncremental() const;
+
             //! Get the image thumbnail mode default.
             static FileBrowserModel::THUMBNAIL_MODE thumbnailModeDefault();
 
@@ -163,6 +184,12 @@ namespace djv
             //! Get the image thumbnail cache size.
             qint64 thumbnailCache() const;
 
+            //! Get the persistent image thumbnail cache size default.
+            static qint64 thumbnailDiskCacheDefault();
+
+            //! Get the persistent image thumbnail cache size.
+            qint64 thumbnailDiskCache() const;
+
             //! Get the list of recent directories.
             const QStringList & recent() const;
 
@@ -235,6 +262,9 @@ namespace djv
             //! Set whether directories are sorted first.
             void setSortDirsFirst(bool);
 
+            //! Set whether file information is shown as it is retrieved.
+            void setIncremental(bool);
+
             //! Set the image thumbnail mode.
             void setThumbnailMode(djv::UI::FileBrowserModel::THUMBNAIL_MODE);
 
@@ -244,6 +274,9 @@ namespace djv
             //! Set the image thumbnail cache size.
             void setThumbnailCache(qint64);
 
+            //! Set the persistent image thumbnail cache size.
+            void setThumbnailDiskCache(qint64);
+
             //! Set the list of recent directories.
             void setRecent(const QStringList &);
 
@@ -275,6 +308,9 @@ namespace djv
             //! This signal is emitted when sort directories first is changed.
             void sortDirsFirstChanged(bool);
 
+            //! This signal is emitted when incremental file information is changed.
+            void incrementalChanged(bool);
+
             //! This signal is emitted when the image thumbnail mode is changed.
             void thumbnailModeChanged(djv::UI::FileBrowserModel::THUMBNAIL_MODE);
 
@@ -284,6 +320,10 @@ namespace djv
             //! This signal is emitted when the image thumbnail cache size is changed.
             void thumbnailCacheChanged(qint64);
 
+            //! This signal is emitted when the persistent image thumbnail cache
+            //! size is changed.
+            void thumbnailDiskCacheChanged(qint64);
+
             //! This signal is emitted when the recent directories are changed.
             void recentChanged(const QStringList &);
 
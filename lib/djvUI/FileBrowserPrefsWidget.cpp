@@ -72,12 +72,14 @@ namespace djv
         struct FileBrowserPrefsWidget::Private
         {
             QPointer<QCheckBox> showHiddenWidget;
+            QPointer<QCheckBox> incrementalWidget;
             QPointer<QComboBox> sortWidget;
             QPointer<QCheckBox> reverseSortWidget;
             QPointer<QCheckBox> sortDirsFirstWidget;
             QPointer<QComboBox> thumbnailModeWidget;
             QPointer<QComboBox> thumbnailSizeWidget;
             QPointer<IntEdit> thumbnailCacheWidget;
+            QPointer<IntEdit> thumbnailDiskCacheWidget;
             QPointer<QListWidget> bookmarksWidget;
             QPointer<ToolButton> addBookmarkButton;
             QPointer<ToolButton> removeBookmarkButton;
@@ -97,6 +99,9 @@ namespace djv
             _p->showHiddenWidget = new QCheckBox(
                 qApp->translate("djv::UI::FileBrowserPrefsWidget", "Show hidden files"));
 
+            _p->incrementalWidget = new QCheckBox(
+                qApp->translate("djv::UI::FileBrowserPrefsWidget", "Show file information as it is retrieved"));
+
             _p->sortWidget = new QComboBox;
             _p->sortWidget->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
             _p->sortWidget->addItems(FileBrowserModel::columnsLabels());
@@ -119,6 +124,10 @@ namespace djv
             _p->thumbnailCacheWidget->setRange(0, 4096);
             _p->thumbnailCacheWidget->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
 
+            _p->thumbnailDiskCacheWidget = new IntEdit;
+            _p->thumbnailDiskCacheWidget->setRange(0, 65536);
+            _p->thumbnailDiskCacheWidget->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+
             _p->bookmarksWidget = new SmallListWidget;
 
             _p->addBookmarkButton = new ToolButton(context);
@@ -146,6 +155,7 @@ namespace djv
                 qApp->translate("djv::UI::FileBrowserPrefsWidget", "Files"), context);
             QFormLayout * formLayout = prefsGroupBox->createLayout();
             formLayout->addRow(_p->showHiddenWidget);
+            formLayout->addRow(_p->incrementalWidget);
             _p->layout->addWidget(prefsGroupBox);
 
             prefsGroupBox = new PrefsGroupBox(
@@ -174,6 +184,13 @@ namespace djv
             formLayout->addRow(
                 qApp->translate("djv::UI::FileBrowserPrefsWidget", "Cache size:"),
                 hLayout);
+            hLayout = new QHBoxLayout;
+            hLayout->addWidget(_p->thumbnailDiskCacheWidget);
+            hLayout->addWidget(
+                new QLabel(qApp->translate("djv::UI::FileBrowserPrefsWidget", "(MB)")));
+            formLayout->addRow(
+                qApp->translate("djv::UI::FileBrowserPrefsWidget", "Disk cache size:"),
+                hLayout);
             _p->layout->addWidget(prefsGroupBox);
 
             prefsGroupBox = new PrefsGroupBox(
@@ -205,6 +222,11 @@ namespace djv
                 SIGNAL(toggled(bool)),
                 context->fileBrowserPrefs(),
                 SLOT(setShowHidden(bool)));
+            connect(
+                _p->incrementalWidget,
+                SIGNAL(toggled(bool)),
+                context->fileBrowserPrefs(),
+                SLOT(setIncremental(bool)));
             connect(
                 _p->sortWidget,
                 SIGNAL(activated(int)),
@@ -231,6 +253,10 @@ namespace djv
                 _p->thumbnailCacheWidget,
                 SIGNAL(valueChanged(int)),
                 SLOT(thumbnailCacheCallback(int)));
+            connect(
+                _p->thumbnailDiskCacheWidget,
+                SIGNAL(valueChanged(int)),
+                SLOT(thumbnailDiskCacheCallback(int)));
             connect(
                 _p->bookmarksWidget,
                 SIGNAL(itemChanged(QListWidgetItem *)),
@@ -267,12 +293,14 @@ namespace djv
         void FileBrowserPrefsWidget::resetPreferences()
         {
             context()->fileBrowserPrefs()->setShowHidden(FileBrowserPrefs::showHiddenDefault());
+            context()->fileBrowserPrefs()->setIncremental(FileBrowserPrefs::incrementalDefault());
             context()->fileBrowserPrefs()->setColumnsSort(FileBrowserPrefs::columnsSortDefault());
             context()->fileBrowserPrefs()->setReverseSort(FileBrowserPrefs::reverseSortDefault());
             context()->fileBrowserPrefs()->setSortDirsFirst(FileBrowserPrefs::sortDirsFirstDefault());
             context()->fileBrowserPrefs()->setThumbnailMode(FileBrowserPrefs::thumbnailModeDefault());
             context()->fileBrowserPrefs()->setThumbnailSize(FileBrowserPrefs::thumbnailSizeDefault());
             context()->fileBrowserPrefs()->setThumbnailCache(FileBrowserPrefs::thumbnailCacheDefault());
+            context()->fileBrowserPrefs()->setThumbnailDiskCache(FileBrowserPrefs::thumbnailDiskCacheDefault());
             context()->fileBrowserPrefs()->setShortcuts(FileBrowserPrefs::shortcutsDefault());
         }
 
@@ -296,6 +324,11 @@ namespace djv
             context()->fileBrowserPrefs()->setThumbnailCache(value * Core::Memory::megabyte);
         }
 
+        void FileBrowserPrefsWidget::thumbnailDiskCacheCallback(int value)
+        {
+            context()->fileBrowserPrefs()->setThumbnailDiskCache(value * Core::Memory::megabyte);
+        }
+
         void FileBrowserPrefsWidget::bookmarkCallback(QListWidgetItem * item)
         {
             QStringList bookmarks = context()->fileBrowserPrefs()->bookmarks();
@@ -376,21 +409,25 @@ namespace djv
         {
             Core::SignalBlocker signalBlocker(QObjectList() <<
                 _p->showHiddenWidget <<
+                _p->incrementalWidget <<
                 _p->sortWidget <<
                 _p->reverseSortWidget <<
                 _p->sortDirsFirstWidget <<
                 _p->thumbnailModeWidget <<
                 _p->thumbnailSizeWidget <<
                 _p->thumbnailCacheWidget <<
+                _p->thumbnailDiskCacheWidget <<
                 _p->bookmarksWidget <<
                 _p->shortcutsWidget);
             _p->showHiddenWidget->setChecked(context()->fileBrowserPrefs()->hasShowHidden());
+            _p->incrementalWidget->setChecked(context()->fileBrowserPrefs()->hasIncremental());
             _p->sortWidget->setCurrentIndex(context()->fileBrowserPrefs()->columnsSort());
             _p->reverseSortWidget->setChecked(context()->fileBrowserPrefs()->hasReverseSort());
             _p->sortDirsFirstWidget->setChecked(context()->fileBrowserPrefs()->hasSortDirsFirst());
             _p->thumbnailModeWidget->setCurrentIndex(context()->fileBrowserPrefs()->thumbnailMode());
             _p->thumbnailSizeWidget->setCurrentIndex(context()->fileBrowserPrefs()->thumbnailSize());
             _p->thumbnailCacheWidget->setValue(context()->fileBrowserPrefs()->thumbnailCache() / Core::Memory::megabyte);
+            _p->thumbnailDiskCacheWidget->setValue(context()->fileBrowserPrefs()->thumbnailDiskCache() / Core::Memory::megabyte);
             _p->bookmarksWidget->clear();
             const QStringList & bookmarks = context()->fileBrowserPrefs()->bookmarks();
             for (int i = 0; i < bookmarks.count(); ++i)
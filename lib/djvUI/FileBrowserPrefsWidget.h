@@ -59,6 +59,7 @@ namespace djv
             void thumbnailModeCallback(int);
             void thumbnailSizeCallback(int);
             void thumbnailCacheCallback(int);
+            void thumbnailDiskCacheCallback(int);
             void bookmarkCallback(QListWidgetItem *);
             void addBookmarkCallback();
             void removeBookmarkCallback();
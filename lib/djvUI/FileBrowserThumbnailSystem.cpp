@@ -29,23 +29,22 @@
 
 #include <djvUI/FileBrowserThumbnailSystem.h>
 
+#include <djvUI/FileBrowserDiskCache.h>
 #include <djvUI/FileBrowserModel.h>
 #include <djvUI/UIContext.h>
 
+#include <djvAV/CPUImage.h>
 #include <djvAV/Image.h>
-#include <djvAV/OpenGLImage.h>
 #include <djvAV/PixelDataUtil.h>
 
 #include <djvCore/DebugLog.h>
 #include <djvCore/FileInfo.h>
+#include <djvCore/Math.h>
 
-#include <QOffscreenSurface>
-#include <QOpenGLContext>
-#include <QOpenGLDebugLogger>
-#include <QPixmap>
-#include <QThread>
-
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <mutex>
 #include <thread>
 
@@ -55,7 +54,8 @@ namespace djv
     {
         namespace
         {
-            const size_t timeout = 10;
+            //! The maximum number of worker threads.
+            const size_t threadCountMax = 8;
 
             struct InfoRequest
             {
@@ -63,6 +63,9 @@ namespace djv
                 {}
 
                 InfoRequest(InfoRequest&& other) :
+                    id(other.id),
+                    priority(other.priority),
+                    order(other.order),
                     fileInfo(other.fileInfo),
                     promise(std::move(other.promise))
                 {}
@@ -71,22 +74,31 @@ namespace djv
                 {
                     if (this != &other)
                     {
+                        id = other.id;
+                        priority = other.priority;
+                        order = other.order;
                         fileInfo = other.fileInfo;
                         promise = std::move(other.promise);
                     }
                     return *this;
                 }
 
+                quint64 id = 0;
+                int priority = 0;
+                quint64 order = 0;
                 Core::FileInfo fileInfo;
                 std::promise<AV::IOInfo> promise;
             };
 
-            struct PixmapRequest
+            struct ImageRequest
             {
-                PixmapRequest()
+                ImageRequest()
                 {}
 
-                PixmapRequest(PixmapRequest&& other) :
+                ImageRequest(ImageRequest&& other) :
+                    id(other.id),
+                    priority(other.priority),
+                    order(other.order),
                     fileInfo(other.fileInfo),
                     thumbnailMode(other.thumbnailMode),
                     resolution(other.resolution),
@@ -94,10 +106,13 @@ namespace djv
                     promise(std::move(other.promise))
                 {}
 
-                PixmapRequest& operator = (PixmapRequest&& other)
+                ImageRequest& operator = (ImageRequest&& other)
                 {
                     if (this != &other)
                     {
+                        id = other.id;
+                        priority = other.priority;
+                        order = other.order;
                         fileInfo = other.fileInfo;
                         thumbnailMode = other.thumbnailMode;
                         resolution = other.resolution;
@@ -107,186 +122,289 @@ namespace djv
                     return *this;
                 }
 
+                quint64 id = 0;
+                int priority = 0;
+                quint64 order = 0;
                 Core::FileInfo fileInfo;
                 FileBrowserModel::THUMBNAIL_MODE thumbnailMode = static_cast<FileBrowserModel::THUMBNAIL_MODE>(0);
                 glm::ivec2 resolution;
                 AV::PixelDataInfo::PROXY proxy = static_cast<AV::PixelDataInfo::PROXY>(0);
-                std::promise<QPixmap> promise;
+                std::promise<QImage> promise;
             };
 
+            //! Get the request with the highest priority. Requests with the same
+            //! priority are handled in the order they were made.
+            template<typename T>
+            typename std::vector<T>::iterator nextRequest(std::vector<T> & queue)
+            {
+                auto out = queue.begin();
+                for (auto i = queue.begin(); i != queue.end(); ++i)
+                {
+                    if (i->priority > out->priority ||
+                        (i->priority == out->priority && i->order < out->order))
+                    {
+                        out = i;
+                    }
+                }
+                return out;
+            }
+
+            template<typename T>
+            void setRequestPriority(std::vector<T> & queue, quint64 id, int priority)
+            {
+                for (auto & i : queue)
+                {
+                    if (id == i.id)
+                    {
+                        i.priority = priority;
+                    }
+                }
+            }
+
+            template<typename T>
+            void cancelRequests(std::vector<T> & queue, quint64 id)
+            {
+                queue.erase(
+                    std::remove_if(queue.begin(), queue.end(), [id](const T & value) { return id == value.id; }),
+                    queue.end());
+            }
+
+            //! Convert 8-bit RGBA pixel data to a Qt image.
+            QImage toQt(const AV::PixelData & pixelData)
+            {
+                const int w = pixelData.w();
+                const int h = pixelData.h();
+                QImage out(w, h, QImage::Format_ARGB32);
+                for (int y = 0; y < h; ++y)
+                {
+                    QRgb * qRgb = (QRgb *)out.scanLine(y);
+                    const uchar * p = pixelData.data(0, h - 1 - y);
+                    for (int x = 0; x < w; ++x, p += 4)
+                    {
+                        qRgb[x] = qRgba(p[0], p[1], p[2], p[3]);
+                    }
+                }
+                return out;
+            }
+
         } // namespace
 
         struct FileBrowserThumbnailSystem::Private
         {
             Core::DebugLog * debugLog = nullptr;
             AV::IOFactory * ioFactory = nullptr;
+            FileBrowserDiskCache * diskCache = nullptr;
             std::vector<InfoRequest> infoQueue;
-            std::vector<PixmapRequest> pixmapQueue;
+            std::vector<ImageRequest> imageQueue;
+            quint64 order = 0;
             std::condition_variable requestCV;
             std::mutex requestMutex;
-            std::vector<InfoRequest> infoRequests;
-            std::vector<PixmapRequest> pixmapRequests;
-            QScopedPointer<QOffscreenSurface> offscreenSurface;
-            QScopedPointer<QOpenGLContext> openGLContext;
-            QScopedPointer<QOpenGLDebugLogger> openGLDebugLogger;
-            std::unique_ptr<AV::OpenGLImage> openGLImage;
-            std::atomic<bool> running;
+            std::vector<std::thread> threads;
+            bool running = false;
         };
 
         FileBrowserThumbnailSystem::FileBrowserThumbnailSystem(const QPointer<UIContext> & context, QObject * parent) :
-            QThread(parent),
+            QObject(parent),
             _p(new Private)
         {
             _p->debugLog = context->debugLog();
             _p->ioFactory = context->ioFactory();
+            _p->diskCache = context->fileBrowserDiskCache();
 
-            _p->offscreenSurface.reset(new QOffscreenSurface);
-            QSurfaceFormat surfaceFormat = QSurfaceFormat::defaultFormat();
-            surfaceFormat.setSwapBehavior(QSurfaceFormat::SingleBuffer);
-            surfaceFormat.setSamples(1);
-            _p->offscreenSurface->setFormat(surfaceFormat);
-            _p->offscreenSurface->create();
-
-            _p->openGLContext.reset(new QOpenGLContext);
-            _p->openGLContext->setFormat(surfaceFormat);
-            _p->openGLContext->create();
-            _p->openGLContext->moveToThread(this);
-
-            _p->openGLDebugLogger.reset(new QOpenGLDebugLogger);
-            connect(
-                _p->openGLDebugLogger.data(),
-                &QOpenGLDebugLogger::messageLogged,
-                this,
-                &FileBrowserThumbnailSystem::debugLogMessage);
-
+            // The workers are mostly decoding so one is used for each core.
+            const size_t threadCount = Core::Math::clamp(
+                static_cast<size_t>(std::thread::hardware_concurrency()),
+                static_cast<size_t>(1),
+                threadCountMax);
             _p->running = true;
+            for (size_t i = 0; i < threadCount; ++i)
+            {
+                _p->threads.push_back(std::thread([this] { _work(); }));
+            }
         }
 
         FileBrowserThumbnailSystem::~FileBrowserThumbnailSystem()
-        {}
+        {
+            stop();
+        }
 
-        std::future<AV::IOInfo> FileBrowserThumbnailSystem::getInfo(const Core::FileInfo& fileInfo)
+        size_t FileBrowserThumbnailSystem::threadCount() const
+        {
+            return _p->threads.size();
+        }
+
+        quint64 FileBrowserThumbnailSystem::createId()
+        {
+            static std::atomic<quint64> id(0);
+            return ++id;
+        }
+
+        std::future<AV::IOInfo> FileBrowserThumbnailSystem::getInfo(
+            const Core::FileInfo & fileInfo,
+            quint64                id,
+            int                    priority)
         {
             InfoRequest request;
+            request.id = id;
+            request.priority = priority;
             request.fileInfo = fileInfo;
             auto future = request.promise.get_future();
             std::unique_lock<std::mutex> lock(_p->requestMutex);
+            request.order = _p->order++;
             _p->infoQueue.push_back(std::move(request));
             _p->requestCV.notify_one();
             return future;
         }
 
-        std::future<QPixmap> FileBrowserThumbnailSystem::getPixmap(
-            const Core::FileInfo& fileInfo,
+        std::future<QImage> FileBrowserThumbnailSystem::getImage(
+            const Core::FileInfo &           fileInfo,
             FileBrowserModel::THUMBNAIL_MODE thumbnailMode,
-            const glm::ivec2 & resolution,
-            AV::PixelDataInfo::PROXY proxy)
+            const glm::ivec2 &               resolution,
+            AV::PixelDataInfo::PROXY         proxy,
+            quint64                          id,
+            int                              priority)
         {
-            PixmapRequest request;
+            ImageRequest request;
+            request.id = id;
+            request.priority = priority;
             request.fileInfo = fileInfo;
             request.thumbnailMode = thumbnailMode;
             request.resolution = resolution;
             request.proxy = proxy;
             auto future = request.promise.get_future();
             std::unique_lock<std::mutex> lock(_p->requestMutex);
-            _p->pixmapQueue.push_back(std::move(request));
+            request.order = _p->order++;
+            _p->imageQueue.push_back(std::move(request));
             _p->requestCV.notify_one();
             return future;
         }
 
+        void FileBrowserThumbnailSystem::setPriority(quint64 id, int priority)
+        {
+            std::unique_lock<std::mutex> lock(_p->requestMutex);
+            setRequestPriority(_p->infoQueue, id, priority);
+            setRequestPriority(_p->imageQueue, id, priority);
+        }
+
+        void FileBrowserThumbnailSystem::cancel(quint64 id)
+        {
+            std::unique_lock<std::mutex> lock(_p->requestMutex);
+            cancelRequests(_p->infoQueue, id);
+            cancelRequests(_p->imageQueue, id);
+        }
+
         void FileBrowserThumbnailSystem::stop()
         {
             {
                 std::unique_lock<std::mutex> lock(_p->requestMutex);
                 _p->infoQueue.clear();
-                _p->pixmapQueue.clear();
+                _p->imageQueue.clear();
+                _p->running = false;
             }
-            _p->running = false;
+            _p->requestCV.notify_all();
+            for (auto & thread : _p->threads)
+            {
+                thread.join();
+            }
+            _p->threads.clear();
         }
 
-        void FileBrowserThumbnailSystem::run()
+        void FileBrowserThumbnailSystem::_work()
         {
-            _p->openGLContext->makeCurrent(_p->offscreenSurface.data());
-            if (_p->openGLContext->format().testOption(QSurfaceFormat::DebugContext))
-            {
-                _p->openGLDebugLogger->initialize();
-                _p->openGLDebugLogger->startLogging();
-            }
-            _p->openGLImage.reset(new AV::OpenGLImage);
-            while (_p->running)
+            AV::CPUImage cpuImage;
+            cpuImage.setThreadCount(1);
+            while (true)
             {
+                // Get the next request. The I/O information is handled first
+                // when the priorities are the same since the thumbnails depend
+                // on it.
+                InfoRequest infoRequest;
+                ImageRequest imageRequest;
+                bool info = false;
                 {
                     std::unique_lock<std::mutex> lock(_p->requestMutex);
-                    _p->requestCV.wait_for(
+                    _p->requestCV.wait(
                         lock,
-                        std::chrono::milliseconds(timeout),
-                        [this] { return _p->infoQueue.size() || _p->pixmapQueue.size(); });
-                    _p->infoRequests = std::move(_p->infoQueue);
-                    _p->pixmapRequests = std::move(_p->pixmapQueue);
-                }
-                if (_p->infoRequests.size())
-                {
-                    _handleInfoRequests();
-                }
-                if (_p->pixmapRequests.size())
-                {
-                    _handlePixmapRequests();
+                        [this] { return !_p->running || _p->infoQueue.size() || _p->imageQueue.size(); });
+                    if (!_p->running)
+                        break;
+                    auto infoNext = _p->infoQueue.size() ? nextRequest(_p->infoQueue) : _p->infoQueue.end();
+                    auto imageNext = _p->imageQueue.size() ? nextRequest(_p->imageQueue) : _p->imageQueue.end();
+                    info =
+                        infoNext != _p->infoQueue.end() &&
+                        (imageNext == _p->imageQueue.end() || infoNext->priority >= imageNext->priority);
+                    if (info)
+                    {
+                        infoRequest = std::move(*infoNext);
+                        _p->infoQueue.erase(infoNext);
+                    }
+                    else
+                    {
+                        imageRequest = std::move(*imageNext);
+                        _p->imageQueue.erase(imageNext);
+                    }
                 }
-            }
-            _p->openGLImage.reset();
-            _p->openGLDebugLogger->stopLogging();
-            _p->openGLDebugLogger.reset();
-            _p->openGLContext.reset();
-        }
 
-        void FileBrowserThumbnailSystem::debugLogMessage(const QOpenGLDebugMessage & message)
-        {
-            _p->debugLog->addMessage("djv::UI::FileBrowserThumbnailSystem", message.message());
-        }
-
-        void FileBrowserThumbnailSystem::_handleInfoRequests()
-        {
-            for (auto& request : _p->infoRequests)
-            {
-                AV::IOInfo info;
-                try
-                {
-                    auto load = std::unique_ptr<AV::Load>(_p->ioFactory->load(request.fileInfo, info));
-                }
-                catch (const Core::Error&)
+                if (info)
                 {
+                    AV::IOInfo ioInfo;
+                    try
+                    {
+                        auto load = std::unique_ptr<AV::Load>(_p->ioFactory->load(infoRequest.fileInfo, ioInfo));
+                    }
+                    catch (const Core::Error &)
+                    {
+                    }
+                    catch (const std::exception & error)
+                    {
+                        ioInfo = AV::IOInfo();
+                        _p->debugLog->addMessage("djv::UI::FileBrowserThumbnailSystem", error.what());
+                    }
+                    infoRequest.promise.set_value(ioInfo);
+                    continue;
                 }
-                request.promise.set_value(info);
-            }
-            _p->infoRequests.clear();
-        }
 
-        void FileBrowserThumbnailSystem::_handlePixmapRequests()
-        {
-            //DJV_DEBUG("FileBrowserThumbnailSystem::_handlePixmapRequests");
-            for (auto& request : _p->pixmapRequests)
-            {
-                QPixmap pixmap;
+                //DJV_DEBUG("FileBrowserThumbnailSystem::_work");
+                //DJV_DEBUG_PRINT("file = " << imageRequest.fileInfo);
+                QImage image;
                 try
                 {
-                    //DJV_DEBUG_PRINT("file = " << request.fileInfo);
-                    
-                    AV::IOInfo info;
-                    auto load = std::unique_ptr<AV::Load>(_p->ioFactory->load(request.fileInfo, info));
-                    AV::Image image;
-                    load->read(image);
-                    //DJV_DEBUG_PRINT("image = " << image);
-
-                    AV::Image tmp(AV::PixelDataInfo(request.resolution, image.pixel()));
-                    AV::OpenGLImageOptions options;
-                    options.xform.scale = glm::vec2(tmp.size()) / (glm::vec2(image.size() * AV::PixelDataUtil::proxyScale(image.info().proxy)));
-                    options.colorProfile = image.colorProfile;
-                    if (FileBrowserModel::THUMBNAIL_MODE_HIGH == request.thumbnailMode)
+                    // Check the persistent cache. The cache is keyed on the file
+                    // that is decoded, the first frame of a sequence, and only
+                    // that file is read again so that changed files are not
+                    // matched.
+                    const Core::FileInfo fileInfo(imageRequest.fileInfo.fileName(
+                        imageRequest.fileInfo.sequence().start()));
+                    image = _p->diskCache->get(
+                        fileInfo,
+                        imageRequest.thumbnailMode,
+                        imageRequest.resolution,
+                        imageRequest.proxy);
+                    if (image.isNull())
                     {
-                        options.filter = AV::OpenGLImageFilter::filterHighQuality();
+                        AV::IOInfo ioInfo;
+                        auto load = std::unique_ptr<AV::Load>(_p->ioFactory->load(imageRequest.fileInfo, ioInfo));
+                        AV::Image tmp;
+                        load->read(tmp, AV::ImageIOInfo(-1, 0, imageRequest.proxy));
+                        //DJV_DEBUG_PRINT("image = " << tmp);
+
+                        AV::PixelData scaled(AV::PixelDataInfo(imageRequest.resolution, AV::Pixel::RGBA_U8));
+                        AV::OpenGLImageOptions options;
+                        options.xform.scale = glm::vec2(scaled.size()) / (glm::vec2(tmp.size() * AV::PixelDataUtil::proxyScale(tmp.info().proxy)));
+                        options.colorProfile = tmp.colorProfile;
+                        if (FileBrowserModel::THUMBNAIL_MODE_HIGH == imageRequest.thumbnailMode)
+                        {
+                            options.filter = AV::OpenGLImageFilter::filterHighQuality();
+                        }
+                        cpuImage.copy(tmp, scaled, options);
+                        image = toQt(scaled);
+                        _p->diskCache->insert(
+                            fileInfo,
+                            imageRequest.thumbnailMode,
+                            imageRequest.resolution,
+                            imageRequest.proxy,
+                            image);
                     }
-                    _p->openGLImage->copy(image, tmp, options);
-                    pixmap = _p->openGLImage->toQt(tmp);
                 }
                 catch (const Core::Error & error)
                 {
@@ -295,9 +413,13 @@ namespace djv
                         _p->debugLog->addMessage(m.prefix, m.string);
                     }
                 }
-                request.promise.set_value(pixmap);
+                catch (const std::exception & error)
+                {
+                    image = QImage();
+                    _p->debugLog->addMessage("djv::UI::FileBrowserThumbnailSystem", error.what());
+                }
+                imageRequest.promise.set_value(image);
             }
-            _p->pixmapRequests.clear();
         }
 
     } // namespace UI
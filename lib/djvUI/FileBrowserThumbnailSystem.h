@@ -33,44 +33,62 @@
 
 #include <djvAV/IO.h>
 
-#include <QThread>
+#include <QImage>
+#include <QObject>
 
 #include <future>
 
-class QOpenGLDebugMessage;
-class QPixmap;
-
 namespace djv
 {
     namespace UI
     {
         //! This class provides a file browser thumbnail system.
-        class FileBrowserThumbnailSystem : public QThread
+        //!
+        //! The requests are handled by a pool of worker threads, highest
+        //! priority first. The images are scaled on the CPU so the workers do
+        //! not need an OpenGL context.
+        class FileBrowserThumbnailSystem : public QObject
         {
             Q_OBJECT
 
         public:
             FileBrowserThumbnailSystem(const QPointer<UIContext> &, QObject * parent = nullptr);
-            virtual ~FileBrowserThumbnailSystem();
+            ~FileBrowserThumbnailSystem() override;
+
+            //! Get the number of worker threads.
+            size_t threadCount() const;
+
+            //! Create a new request ID. Requests that share an ID can be
+            //! re-prioritized or canceled together.
+            static quint64 createId();
 
-            std::future<AV::IOInfo> getInfo(const Core::FileInfo&);
-            std::future<QPixmap> getPixmap(
-                const Core::FileInfo&,
+            //! Request the I/O information for a file.
+            std::future<AV::IOInfo> getInfo(
+                const Core::FileInfo &,
+                quint64 id,
+                int     priority = 0);
+
+            //! Request a thumbnail image for a file.
+            std::future<QImage> getImage(
+                const Core::FileInfo &,
                 FileBrowserModel::THUMBNAIL_MODE,
                 const glm::ivec2 &,
-                AV::PixelDataInfo::PROXY);
+                AV::PixelDataInfo::PROXY,
+                quint64 id,
+                int     priority = 0);
 
-            void stop();
+            //! Change the priority of the pending requests with the given ID.
+            void setPriority(quint64 id, int priority);
 
-        protected:
-            void run() override;
+            //! Cancel the pending requests with the given ID. The futures of
+            //! canceled requests are never made ready.
+            void cancel(quint64 id);
 
-        private Q_SLOTS:
-            void debugLogMessage(const QOpenGLDebugMessage &);
+            //! Stop the worker threads.
+            void stop();
 
         private:
-            void _handleInfoRequests();
-            void _handlePixmapRequests();
+            void _work();
 
             DJV_PRIVATE_COPY(FileBrowserThumbnailSystem);
 
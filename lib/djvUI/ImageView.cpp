@@ -55,6 +55,8 @@ namespace djv
             {}
 
             std::shared_ptr<AV::PixelData> data;
+            std::shared_ptr<AV::PixelData> nextData;
+            std::shared_ptr<AV::PixelData> stagedData;
             AV::OpenGLImageOptions options;
             glm::ivec2 viewPos = glm::ivec2(0, 0);
             float viewZoom = 1.f;
@@ -123,6 +125,11 @@ namespace djv
             Q_EMIT viewChanged();
         }
 
+        void ImageView::setNextData(const std::shared_ptr<AV::PixelData> & data)
+        {
+            _p->nextData = data;
+        }
+
         void ImageView::setOptions(const AV::OpenGLImageOptions & options)
         {
             if (options == _p->options)
@@ -263,6 +270,13 @@ namespace djv
                     -1.f,
                     1.f);
                 _p->openGLImage->draw(*_p->data, viewMatrix, options);
+                if (_p->nextData && _p->nextData != _p->data && _p->nextData != _p->stagedData)
+                {
+                    // Keep the staged data until something else is staged so
+                    // that it is not freed while it is still in a pixel buffer.
+                    _p->openGLImage->stage(*_p->nextData);
+                    _p->stagedData = _p->nextData;
+                }
             }
             catch (const Core::Error & error)
             {
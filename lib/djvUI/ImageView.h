@@ -105,6 +105,11 @@ namespace djv
             //! Set the pixel data.
             void setData(const std::shared_ptr<djv::AV::PixelData> &);
 
+            //! Set the pixel data that is expected to be displayed next. The data
+            //! is uploaded after the current pixel data is drawn, so that the
+            //! transfer overlaps with display.
+            void setNextData(const std::shared_ptr<djv::AV::PixelData> &);
+
             //! Set the image options.
             void setOptions(const djv::AV::OpenGLImageOptions &);
 
@@ -93,6 +93,20 @@ namespace djv
             _compressionWidget->setSizePolicy(
                 QSizePolicy::Fixed, QSizePolicy::Fixed);
 
+            _storageWidget = new QComboBox;
+            _storageWidget->addItems(AV::OpenEXR::storageLabels());
+            _storageWidget->setSizePolicy(
+                QSizePolicy::Fixed, QSizePolicy::Fixed);
+
+            _tileSizeWidget = new IntEdit;
+            _tileSizeWidget->setRange(1, 4096);
+            _tileSizeWidget->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+
+            _roundingWidget = new QComboBox;
+            _roundingWidget->addItems(AV::OpenEXR::roundingLabels());
+            _roundingWidget->setSizePolicy(
+                QSizePolicy::Fixed, QSizePolicy::Fixed);
+
 #if OPENEXR_VERSION_HEX >= 0x02020000
             _dwaCompressionLevelWidget = new FloatEditSlider(context);
             _dwaCompressionLevelWidget->editObject()->setClamp(false);
@@ -160,6 +174,25 @@ namespace djv
 #endif // OPENEXR_VERSION_HEX
             _layout->addWidget(prefsGroupBox);
 
+            prefsGroupBox = new PrefsGroupBox(
+                qApp->translate("djv::UI::OpenEXRWidget", "Storage"),
+                qApp->translate("djv::UI::OpenEXRWidget",
+                    "Set how images are stored when saving OpenEXR images. Mipmapped "
+                    "images allow proxies to be loaded without reading the full "
+                    "resolution image."),
+                context);
+            formLayout = prefsGroupBox->createLayout();
+            formLayout->addRow(
+                qApp->translate("djv::UI::OpenEXRWidget", "Storage:"),
+                _storageWidget);
+            formLayout->addRow(
+                qApp->translate("djv::UI::OpenEXRWidget", "Tile size:"),
+                _tileSizeWidget);
+            formLayout->addRow(
+                qApp->translate("djv::UI::OpenEXRWidget", "Rounding:"),
+                _roundingWidget);
+            _layout->addWidget(prefsGroupBox);
+
             _layout->addStretch();
 
             // Initialize.
@@ -201,6 +234,15 @@ namespace djv
             tmp = plugin->option(
                 plugin->options()[AV::OpenEXR::COMPRESSION_OPTION]);
             tmp >> _options.compression;
+            tmp = plugin->option(
+                plugin->options()[AV::OpenEXR::STORAGE_OPTION]);
+            tmp >> _options.storage;
+            tmp = plugin->option(
+                plugin->options()[AV::OpenEXR::TILE_SIZE_OPTION]);
+            tmp >> _options.tileSize;
+            tmp = plugin->option(
+                plugin->options()[AV::OpenEXR::ROUNDING_OPTION]);
+            tmp >> _options.rounding;
 #if OPENEXR_VERSION_HEX >= 0x02020000
             tmp = plugin->option(
                 plugin->options()[AV::OpenEXR::DWA_COMPRESSION_LEVEL_OPTION]);
@@ -254,6 +296,18 @@ namespace djv
                 _compressionWidget,
                 SIGNAL(activated(int)),
                 SLOT(compressionCallback(int)));
+            connect(
+                _storageWidget,
+                SIGNAL(activated(int)),
+                SLOT(storageCallback(int)));
+            connect(
+                _tileSizeWidget,
+                SIGNAL(valueChanged(int)),
+                SLOT(tileSizeCallback(int)));
+            connect(
+                _roundingWidget,
+                SIGNAL(activated(int)),
+                SLOT(roundingCallback(int)));
 #if OPENEXR_VERSION_HEX >= 0x02020000
             connect(
                 _dwaCompressionLevelWidget,
@@ -295,6 +349,15 @@ namespace djv
                 else if (0 == option.compare(plugin()->options()[
                     AV::OpenEXR::COMPRESSION_OPTION], Qt::CaseInsensitive))
                     tmp >> _options.compression;
+                else if (0 == option.compare(plugin()->options()[
+                    AV::OpenEXR::STORAGE_OPTION], Qt::CaseInsensitive))
+                    tmp >> _options.storage;
+                else if (0 == option.compare(plugin()->options()[
+                    AV::OpenEXR::TILE_SIZE_OPTION], Qt::CaseInsensitive))
+                    tmp >> _options.tileSize;
+                else if (0 == option.compare(plugin()->options()[
+                    AV::OpenEXR::ROUNDING_OPTION], Qt::CaseInsensitive))
+                    tmp >> _options.rounding;
 #if OPENEXR_VERSION_HEX >= 0x02020000
                 else if (0 == option.compare(plugin()->options()[
                     AV::OpenEXR::DWA_COMPRESSION_LEVEL_OPTION], Qt::CaseInsensitive))
@@ -371,6 +434,24 @@ namespace djv
             pluginUpdate();
         }
 
+        void OpenEXRWidget::storageCallback(int in)
+        {
+            _options.storage = static_cast<AV::OpenEXR::STORAGE>(in);
+            pluginUpdate();
+        }
+
+        void OpenEXRWidget::tileSizeCallback(int in)
+        {
+            _options.tileSize = in;
+            pluginUpdate();
+        }
+
+        void OpenEXRWidget::roundingCallback(int in)
+        {
+            _options.rounding = static_cast<AV::OpenEXR::ROUNDING>(in);
+            pluginUpdate();
+        }
+
         void OpenEXRWidget::dwaCompressionLevelCallback(float in)
         {
 #if OPENEXR_VERSION_HEX >= 0x02020000
@@ -403,6 +484,15 @@ namespace djv
             tmp << _options.compression;
             plugin()->setOption(plugin()->options()[
                 AV::OpenEXR::COMPRESSION_OPTION], tmp);
+            tmp << _options.storage;
+            plugin()->setOption(plugin()->options()[
+                AV::OpenEXR::STORAGE_OPTION], tmp);
+            tmp << _options.tileSize;
+            plugin()->setOption(plugin()->options()[
+                AV::OpenEXR::TILE_SIZE_OPTION], tmp);
+            tmp << _options.rounding;
+            plugin()->setOption(plugin()->options()[
+                AV::OpenEXR::ROUNDING_OPTION], tmp);
 #if OPENEXR_VERSION_HEX >= 0x02020000
             tmp << _options.dwaCompressionLevel;
             plugin()->setOption(plugin()->options()[
@@ -423,7 +513,10 @@ namespace djv
                 _inputExposureKneeLowWidget <<
                 _inputExposureKneeHighWidget <<
                 _channelsWidget <<
-                _compressionWidget
+                _compressionWidget <<
+                _storageWidget <<
+                _tileSizeWidget <<
+                _roundingWidget
 #if OPENEXR_VERSION_HEX >= 0x02020000
                 <<
                 _dwaCompressionLevelWidget
@@ -458,6 +551,11 @@ namespace djv
             _inputExposureKneeLowWidget->setValue(_options.inputExposure.kneeLow);
             _inputExposureKneeHighWidget->setValue(_options.inputExposure.kneeHigh);
             _channelsWidget->setCurrentIndex(_options.channels);
+            _storageWidget->setCurrentIndex(_options.storage);
+            _tileSizeWidget->setValue(_options.tileSize);
+            _tileSizeWidget->setEnabled(_options.storage != AV::OpenEXR::STORAGE_SCANLINE);
+            _roundingWidget->setCurrentIndex(_options.rounding);
+            _roundingWidget->setEnabled(AV::OpenEXR::STORAGE_MIPMAP == _options.storage);
 #if OPENEXR_VERSION_HEX >= 0x02020000
             _compressionWidget->setCurrentIndex(_options.compression);
             _dwaCompressionLevelWidget->setValue(_options.dwaCompressionLevel);
@@ -67,6 +67,9 @@ namespace djv
             void inputExposureKneeHighCallback(float);
             void channelsCallback(int);
             void compressionCallback(int);
+            void storageCallback(int);
+            void tileSizeCallback(int);
+            void roundingCallback(int);
             void dwaCompressionLevelCallback(float);
 
             void pluginUpdate();
@@ -85,6 +88,9 @@ namespace djv
             FloatEditSlider * _inputExposureKneeHighWidget = nullptr;
             QComboBox * _channelsWidget = nullptr;
             QComboBox * _compressionWidget = nullptr;
+            QComboBox * _storageWidget = nullptr;
+            IntEdit * _tileSizeWidget = nullptr;
+            QComboBox * _roundingWidget = nullptr;
 #if OPENEXR_VERSION_HEX >= 0x02020000
             FloatEditSlider * _dwaCompressionLevelWidget = nullptr;
 #endif // OPENEXR_VERSION_HEX
@@ -35,6 +35,7 @@
 #include <djvUI/DebugLogDialog.h>
 #include <djvUI/FileBrowser.h>
 #include <djvUI/FileBrowserCache.h>
+#include <djvUI/FileBrowserDiskCache.h>
 #include <djvUI/FileBrowserPrefs.h>
 #include <djvUI/FileBrowserThumbnailSystem.h>
 #include <djvUI/HelpPrefs.h>
@@ -125,6 +126,7 @@ namespace djv
             struct FileBrowser
             {
                 QScopedPointer<FileBrowserCache>           cache;
+                QScopedPointer<FileBrowserDiskCache>       diskCache;
                 QScopedPointer<FileBrowserThumbnailSystem> thumbnailSystem;
                 QScopedPointer<UI::FileBrowser>            dialog;
             };
@@ -174,8 +176,9 @@ namespace djv
             // Initialize.
             _p->fileBrowser->cache.reset(new FileBrowserCache);
             _p->fileBrowser->cache->setMaxCost(fileBrowserPrefs()->thumbnailCache());
+            _p->fileBrowser->diskCache.reset(new FileBrowserDiskCache);
+            _p->fileBrowser->diskCache->setMaxSize(fileBrowserPrefs()->thumbnailDiskCache());
             _p->fileBrowser->thumbnailSystem.reset(new FileBrowserThumbnailSystem(this));
-            _p->fileBrowser->thumbnailSystem->start();
             _p->iconLibrary.reset(new IconLibrary);
             _p->proxyStyle = new UI::ProxyStyle(this);
             qApp->setStyle(_p->proxyStyle);
@@ -192,7 +195,6 @@ namespace djv
         {
             //DJV_DEBUG("UIContext::~UIContext");
             _p->fileBrowser->thumbnailSystem->stop();
-            _p->fileBrowser->thumbnailSystem->wait();
             QThreadPool::globalInstance()->waitForDone();
             
             //! \bug We manually reset these here so that our "_p" pointer is
@@ -351,6 +353,11 @@ namespace djv
             return _p->fileBrowser->cache.data();
         }
 
+        FileBrowserDiskCache * UIContext::fileBrowserDiskCache() const
+        {
+            return _p->fileBrowser->diskCache.data();
+        }
+
         QPointer<FileBrowserThumbnailSystem> UIContext::fileBrowserThumbnailSystem() const
         {
             return _p->fileBrowser->thumbnailSystem.data();
@@ -45,6 +45,7 @@ namespace djv
         class DebugLogDialog;
         class FileBrowser;
         class FileBrowserCache;
+        class FileBrowserDiskCache;
         class FileBrowserPrefs;
         class FileBrowserThumbnailSystem;
         class HelpPrefs;
@@ -119,6 +120,9 @@ namespace djv
             //! Get the file browser cache.
             FileBrowserCache * fileBrowserCache() const;
 
+            //! Get the persistent file browser thumbnail cache.
+            FileBrowserDiskCache * fileBrowserDiskCache() const;
+
             //! Get the file browser thumbnail system.
             QPointer<FileBrowserThumbnailSystem> fileBrowserThumbnailSystem() const;
 
@@ -229,8 +229,16 @@ namespace djv
             prefs.set("displayProfile", _p->displayProfile);
             prefs.set("lock", _p->lock);
 
-            context()->makeGLContextCurrent();
-            _p->openGLImage.reset();
+            if (_p->openGLImage && context()->hasGLContext())
+            {
+                try
+                {
+                    context()->makeGLContextCurrent();
+                    _p->openGLImage.reset();
+                }
+                catch (const Core::Error &)
+                {}
+            }
         }
 
         void ColorPickerTool::showEvent(QShowEvent *)
@@ -29,6 +29,8 @@
 
 #include <djvViewLib/FileCache.h>
 
+#include <djvViewLib/FileCacheCompress.h>
+#include <djvViewLib/FileCacheSpill.h>
 #include <djvViewLib/FilePrefs.h>
 #include <djvViewLib/ViewContext.h>
 
@@ -37,47 +39,365 @@
 #include <djvCore/Assert.h>
 #include <djvCore/ListUtil.h>
 #include <djvCore/Memory.h>
-#include <djvCore/Time.h>
+#include <djvCore/MemoryPool.h>
 
+#include <QHash>
 #include <QPointer>
+#include <QTimerEvent>
 
 #include <algorithm>
 #include <functional>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace djv
 {
     namespace ViewLib
     {
-        FileCacheKey::FileCacheKey() :
-            timestamp(Core::Time::current())
+        FileCacheKey::FileCacheKey()
         {}
 
-        FileCacheKey::FileCacheKey(void * window, qint64 frame) :
-            window(window),
+        FileCacheKey::FileCacheKey(
+            const QString & fileName,
+            qint64 frame,
+            int layer,
+            AV::PixelDataInfo::PROXY proxy,
+            bool u8Conversion,
+            ::time_t time) :
+            fileName(fileName),
             frame(frame),
-            timestamp(Core::Time::current())
+            layer(layer),
+            proxy(proxy),
+            u8Conversion(u8Conversion),
+            time(time)
         {}
 
+        bool FileCacheKey::operator == (const FileCacheKey & other) const
+        {
+            return
+                frame == other.frame &&
+                layer == other.layer &&
+                proxy == other.proxy &&
+                u8Conversion == other.u8Conversion &&
+                time == other.time &&
+                fileName == other.fileName;
+        }
+
         bool FileCacheKey::operator < (const FileCacheKey & other) const
         {
-            if (window != other.window)
-            {
-                return window < other.window;
-            }
+            if (fileName != other.fileName)
+                return fileName < other.fileName;
+            if (time != other.time)
+                return time < other.time;
+            if (layer != other.layer)
+                return layer < other.layer;
+            if (proxy != other.proxy)
+                return proxy < other.proxy;
+            if (u8Conversion != other.u8Conversion)
+                return u8Conversion < other.u8Conversion;
             return frame < other.frame;
         }
 
+        namespace
+        {
+            struct KeyHash
+            {
+                size_t operator () (const FileCacheKey & key) const
+                {
+                    size_t out = qHash(key.fileName);
+                    for (const size_t value : {
+                        std::hash<qint64>()(key.frame),
+                        static_cast<size_t>(key.layer),
+                        static_cast<size_t>(key.proxy),
+                        static_cast<size_t>(key.u8Conversion),
+                        std::hash<qint64>()(static_cast<qint64>(key.time)) })
+                    {
+                        out ^= value + 0x9e3779b9 + (out << 6) + (out >> 2);
+                    }
+                    return out;
+                }
+            };
+
+            enum LIST
+            {
+                PROBATION,
+                PROTECTED
+            };
+
+            struct Item
+            {
+                std::shared_ptr<AV::Image> image;
+                quint64 byteCount = 0;
+                LIST list = PROBATION;
+                std::list<FileCacheKey>::iterator listIt;
+                std::vector<void *> windows;
+                bool used = false;
+            };
+
+            typedef std::unordered_map<FileCacheKey, Item, KeyHash> ItemMap;
+
+            struct CompressedItem
+            {
+                std::shared_ptr<FileCacheCompressData> data;
+                quint64 byteCount = 0;
+                std::list<FileCacheKey>::iterator listIt;
+            };
+
+            typedef std::unordered_map<FileCacheKey, CompressedItem, KeyHash> CompressedItemMap;
+
+            struct SpilledItem
+            {
+                std::shared_ptr<FileCacheSpillData> data;
+                std::list<FileCacheKey>::iterator listIt;
+            };
+
+            typedef std::unordered_map<FileCacheKey, SpilledItem, KeyHash> SpilledItemMap;
+
+            //! The interval in milliseconds for collecting compressed and
+            //! decompressed items.
+            const int timerInterval = 10;
+
+        } // namespace
+
         struct FileCache::Private
         {
             Private(const QPointer<ViewContext> & context) :
                 maxBytes(static_cast<quint64>(context->filePrefs()->cacheSizeGB() * Core::Memory::gigabyte)),
+                compressedMaxBytes(static_cast<quint64>(context->filePrefs()->compressedCacheSizeGB() * Core::Memory::gigabyte)),
+                spilledMaxBytes(static_cast<quint64>(context->filePrefs()->diskCacheSizeGB() * Core::Memory::gigabyte)),
                 context(context)
             {}
 
-            std::map<FileCacheKey, std::shared_ptr<AV::Image> > items;
+            ItemMap items;
+
+            // The lists are ordered from the most to the least recently used.
+            std::list<FileCacheKey> probation;
+            std::list<FileCacheKey> protect;
+            quint64 protectBytes = 0;
+
+            // The items referenced by each window.
+            std::unordered_map<void *, std::unordered_set<FileCacheKey, KeyHash> > windowItems;
+            std::unordered_map<void *, quint64> windowBytes;
             quint64 maxBytes = 0;
             quint64 cacheBytes = 0;
+
+            // The compressed items, the list is ordered from the most to the
+            // least recently used.
+            CompressedItemMap compressedItems;
+            std::list<FileCacheKey> compressedList;
+            quint64 compressedMaxBytes = 0;
+            quint64 compressedBytes = 0;
+            std::unique_ptr<FileCacheCompress> compress;
+
+            // The evicted items that are waiting to be compressed or written
+            // to disk. They are counted against the cache size until the
+            // workers release them.
+            std::unordered_map<FileCacheKey, quint64, KeyHash> pendingItems;
+            quint64 pendingBytes = 0;
+
+            // The items that have been written to scratch files, the list is
+            // ordered from the most to the least recently used.
+            SpilledItemMap spilledItems;
+            std::list<FileCacheKey> spilledList;
+            quint64 spilledMaxBytes = 0;
+            quint64 spilledBytes = 0;
+            std::unique_ptr<FileCacheSpill> spill;
+
+            int timer = 0;
+
             QPointer<ViewContext> context;
+
+            std::list<FileCacheKey> & list(LIST value)
+            {
+                return PROBATION == value ? probation : protect;
+            }
+
+            // The protected list may use at most this much of the cache, the
+            // rest is reserved for the items on probation.
+            quint64 protectMaxBytes() const
+            {
+                return maxBytes / 4 * 3;
+            }
+
+            // The evicted items waiting to be compressed or written to disk may
+            // use at most this much of the cache. Items that are evicted when
+            // the workers are this far behind are not compressed or written.
+            quint64 pendingMaxBytes() const
+            {
+                return maxBytes / 8;
+            }
+
+            // Get whether an evicted item is still held by a worker.
+            bool isPending(const FileCacheKey & key) const
+            {
+                return
+                    (compress && compress->isPending(key)) ||
+                    (spill && spill->isPending(key));
+            }
+
+            // Add an evicted item that is held by a worker.
+            void pendingAdd(const FileCacheKey & key, quint64 byteCount)
+            {
+                if (pendingItems.insert(std::make_pair(key, byteCount)).second)
+                {
+                    pendingBytes += byteCount;
+                }
+            }
+
+            // Get whether there is room for an evicted item to be held by a
+            // worker.
+            bool pendingRoom(const FileCacheKey & key, quint64 byteCount) const
+            {
+                return
+                    pendingItems.find(key) != pendingItems.end() ||
+                    pendingBytes + byteCount <= pendingMaxBytes();
+            }
+
+            // Remove the evicted items that have been released by the workers.
+            void pendingUpdate()
+            {
+                for (auto i = pendingItems.begin(); i != pendingItems.end();)
+                {
+                    if (!isPending(i->first))
+                    {
+                        pendingBytes -= i->second;
+                        i = pendingItems.erase(i);
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+            }
+
+            // Move an item to the front of its list.
+            void refresh(Item & item)
+            {
+                auto & itemList = list(item.list);
+                itemList.splice(itemList.begin(), itemList, item.listIt);
+            }
+
+            // Mark an item as used. Items on probation are moved to the
+            // protected list when they are used a second time.
+            void touch(Item & item)
+            {
+                if (PROTECTED == item.list || !item.used)
+                {
+                    item.used = true;
+                    refresh(item);
+                    return;
+                }
+                protect.splice(protect.begin(), probation, item.listIt);
+                item.list = PROTECTED;
+                protectBytes += item.byteCount;
+
+                // Move the least recently used protected items back to
+                // probation when the protected list grows too large.
+                while (protectBytes > protectMaxBytes() && protect.size() > 1)
+                {
+                    auto & demoted = items.find(protect.back())->second;
+                    probation.splice(probation.begin(), protect, demoted.listIt);
+                    demoted.list = PROBATION;
+                    protectBytes -= demoted.byteCount;
+                }
+            }
+
+            bool reference(void * window, ItemMap::iterator i)
+            {
+                auto & windows = i->second.windows;
+                if (std::find(windows.begin(), windows.end(), window) != windows.end())
+                    return false;
+                windows.push_back(window);
+                windowItems[window].insert(i->first);
+                windowBytes[window] += i->second.byteCount;
+                return true;
+            }
+
+            void release(void * window)
+            {
+                const auto i = windowItems.find(window);
+                if (i == windowItems.end())
+                    return;
+                for (const auto & key : i->second)
+                {
+                    auto & item = items.find(key)->second;
+                    item.windows.erase(std::find(item.windows.begin(), item.windows.end(), window));
+                    if (item.windows.empty())
+                    {
+                        // Move the item to the end of the probation list so
+                        // that it is the next to be evicted.
+                        probation.splice(probation.end(), list(item.list), item.listIt);
+                        if (PROTECTED == item.list)
+                        {
+                            protectBytes -= item.byteCount;
+                            item.list = PROBATION;
+                        }
+                    }
+                }
+                windowItems.erase(i);
+                windowBytes.erase(window);
+            }
+
+            void erase(ItemMap::iterator i)
+            {
+                auto & item = i->second;
+                if (PROTECTED == item.list)
+                {
+                    protectBytes -= item.byteCount;
+                }
+                list(item.list).erase(item.listIt);
+                cacheBytes -= item.byteCount;
+                for (const auto window : item.windows)
+                {
+                    auto & keys = windowItems[window];
+                    keys.erase(i->first);
+                    if (keys.empty())
+                    {
+                        windowItems.erase(window);
+                    }
+                    auto j = windowBytes.find(window);
+                    if (j != windowBytes.end())
+                    {
+                        j->second -= item.byteCount;
+                        if (!j->second)
+                        {
+                            windowBytes.erase(j);
+                        }
+                    }
+                }
+                items.erase(i);
+            }
+
+            void compressedErase(CompressedItemMap::iterator i)
+            {
+                compressedList.erase(i->second.listIt);
+                compressedBytes -= i->second.byteCount;
+                compressedItems.erase(i);
+            }
+
+            void spilledErase(SpilledItemMap::iterator i)
+            {
+                FileCacheSpill::remove(*i->second.data);
+                spilledList.erase(i->second.listIt);
+                spilledBytes -= i->second.data->byteCount;
+                spilledItems.erase(i);
+            }
+
+            void spilledClear()
+            {
+                while (!spilledItems.empty())
+                {
+                    spilledErase(spilledItems.begin());
+                }
+            }
+
+            bool hasPending() const
+            {
+                return
+                    (compress && compress->hasPending()) ||
+                    (spill && spill->hasPending());
+            }
         };
 
         FileCache::FileCache(const QPointer<ViewContext> & context, QObject * parent) :
@@ -93,12 +413,33 @@ namespace djv
                 context->filePrefs(),
                 SIGNAL(cacheSizeGBChanged(float)),
                 SLOT(cacheSizeGBCallback(float)));
+            connect(
+                context->filePrefs(),
+                SIGNAL(compressedCacheSizeGBChanged(float)),
+                SLOT(setCompressedMaxSizeGB(float)));
+            connect(
+                context->filePrefs(),
+                SIGNAL(diskCacheSizeGBChanged(float)),
+                SLOT(setDiskMaxSizeGB(float)));
+            if (_p->compressedMaxBytes)
+            {
+                _p->compress.reset(new FileCacheCompress);
+            }
+            if (_p->spilledMaxBytes)
+            {
+                _p->spill.reset(new FileCacheSpill);
+            }
         }
 
         FileCache::~FileCache()
         {
             //DJV_DEBUG("FileCache::~FileCache");
             //debug();
+            if (_p->spill)
+            {
+                _p->spill->cancel();
+            }
+            _p->spilledClear();
         }
 
         bool FileCache::hasItem(const FileCacheKey & key)
@@ -108,14 +449,63 @@ namespace djv
 
         std::shared_ptr<AV::Image> FileCache::item(const FileCacheKey & key) const
         {
-            return _p->items.find(key)->second;
+            auto i = _p->items.find(key);
+            if (i == _p->items.end())
+            {
+                return nullptr;
+            }
+            _p->touch(i->second);
+            return i->second.image;
+        }
+
+        std::shared_ptr<AV::Image> FileCache::peekItem(const FileCacheKey & key) const
+        {
+            const auto i = _p->items.find(key);
+            return i != _p->items.end() ? i->second.image : nullptr;
         }
 
-        void FileCache::addItem(const FileCacheKey & key, const std::shared_ptr<AV::Image> & item)
+        void FileCache::touchItems(void * window, const std::vector<FileCacheKey> & keys)
         {
-            _p->items[key] = item;
-            _p->cacheBytes += item->dataByteCount();
-            if (_p->cacheBytes > _p->maxBytes)
+            bool changed = false;
+            for (const auto & key : keys)
+            {
+                auto i = _p->items.find(key);
+                if (i != _p->items.end())
+                {
+                    _p->refresh(i->second);
+                    changed |= _p->reference(window, i);
+                }
+            }
+            if (changed)
+            {
+                Q_EMIT cacheChanged();
+            }
+        }
+
+        void FileCache::addItem(void * window, const FileCacheKey & key, const std::shared_ptr<AV::Image> & image)
+        {
+            auto i = _p->items.find(key);
+            if (i != _p->items.end())
+            {
+                _p->refresh(i->second);
+                if (window && _p->reference(window, i))
+                {
+                    Q_EMIT cacheChanged();
+                }
+                return;
+            }
+            Item item;
+            item.image = image;
+            item.byteCount = image->dataByteCount();
+            _p->probation.push_front(key);
+            item.listIt = _p->probation.begin();
+            i = _p->items.insert(std::make_pair(key, item)).first;
+            _p->cacheBytes += item.byteCount;
+            if (window)
+            {
+                _p->reference(window, i);
+            }
+            if (_p->cacheBytes + _p->pendingBytes > _p->maxBytes)
             {
                 purge();
             }
@@ -125,31 +515,97 @@ namespace djv
 
         void FileCache::clearItems(void * window)
         {
-            auto i = _p->items.begin();
-            while (i != _p->items.end())
+            _p->release(window);
+            Q_EMIT cacheChanged();
+            debug();
+        }
+
+        bool FileCache::hasCompressedItem(const FileCacheKey & key) const
+        {
+            return _p->compressedItems.find(key) != _p->compressedItems.end();
+        }
+
+        std::shared_ptr<AV::Image> FileCache::decompressItem(const FileCacheKey & key)
+        {
+            auto i = _p->compressedItems.find(key);
+            if (i == _p->compressedItems.end())
             {
-                if (window == i->first.window)
-                {
-                    _p->cacheBytes -= i->second->dataByteCount();
-                    i = _p->items.erase(i);
-                }
-                else
+                return nullptr;
+            }
+            _p->compressedList.splice(_p->compressedList.begin(), _p->compressedList, i->second.listIt);
+            return FileCacheCompress::decompress(*i->second.data);
+        }
+
+        void FileCache::decompressItems(void * window, const std::vector<FileCacheKey> & keys)
+        {
+            if (!_p->compress)
+                return;
+            std::vector<std::pair<FileCacheKey, std::shared_ptr<FileCacheCompressData> > > requests;
+            for (const auto & key : keys)
+            {
+                auto i = _p->compressedItems.find(key);
+                if (i != _p->compressedItems.end() && _p->items.find(key) == _p->items.end())
                 {
-                    ++i;
+                    _p->compressedList.splice(_p->compressedList.begin(), _p->compressedList, i->second.listIt);
+                    requests.push_back(std::make_pair(key, i->second.data));
                 }
             }
-            Q_EMIT cacheChanged();
-            debug();
+            _p->compress->requestDecompress(window, requests);
+            if (requests.size() && !_p->timer)
+            {
+                _p->timer = startTimer(timerInterval);
+            }
+        }
+
+        bool FileCache::isDecompressing(const FileCacheKey & key) const
+        {
+            return _p->compress && _p->compress->isPending(key);
+        }
+
+        bool FileCache::hasDiskItem(const FileCacheKey & key) const
+        {
+            return _p->spilledItems.find(key) != _p->spilledItems.end();
+        }
+
+        std::shared_ptr<AV::Image> FileCache::diskItem(const FileCacheKey & key)
+        {
+            auto i = _p->spilledItems.find(key);
+            if (i == _p->spilledItems.end())
+            {
+                return nullptr;
+            }
+            _p->spilledList.splice(_p->spilledList.begin(), _p->spilledList, i->second.listIt);
+            auto out = FileCacheSpill::read(*i->second.data);
+            if (!out)
+            {
+                _p->spilledErase(i);
+            }
+            return out;
         }
 
         void FileCache::clear()
         {
-            auto i = _p->items.begin();
-            while (i != _p->items.end())
+            if (_p->compress)
+            {
+                _p->compress->cancel();
+            }
+            _p->compressedItems.clear();
+            _p->compressedList.clear();
+            _p->compressedBytes = 0;
+            if (_p->spill)
             {
-                _p->cacheBytes -= i->second->dataByteCount();
-                i = _p->items.erase(i);
+                _p->spill->cancel();
             }
+            _p->spilledClear();
+            _p->pendingItems.clear();
+            _p->pendingBytes = 0;
+            _p->items.clear();
+            _p->probation.clear();
+            _p->protect.clear();
+            _p->protectBytes = 0;
+            _p->windowItems.clear();
+            _p->windowBytes.clear();
+            _p->cacheBytes = 0;
             Q_EMIT cacheChanged();
             debug();
         }
@@ -159,44 +615,46 @@ namespace djv
             auto i = _p->items.find(key);
             if (i != _p->items.end())
             {
-                _p->cacheBytes -= i->second->dataByteCount();
-                _p->items.erase(i);
+                _p->erase(i);
+            }
+            auto j = _p->compressedItems.find(key);
+            if (j != _p->compressedItems.end())
+            {
+                _p->compressedErase(j);
+            }
+            auto k = _p->spilledItems.find(key);
+            if (k != _p->spilledItems.end())
+            {
+                _p->spilledErase(k);
             }
         }
 
         std::vector<std::shared_ptr<AV::Image> > FileCache::items(void * window)
         {
             std::vector<std::shared_ptr<AV::Image> > out;
-            for (auto i = _p->items.begin(); i != _p->items.end(); ++i)
+            const auto i = _p->windowItems.find(window);
+            if (i != _p->windowItems.end())
             {
-                if (window == i->first.window)
+                for (const auto & key : i->second)
                 {
-                    out.push_back(i->second);
+                    out.push_back(_p->items.find(key)->second.image);
                 }
             }
             return out;
         }
 
-        namespace
-        {
-            bool compare(qint64 a, qint64 b)
-            {
-                return a < b;
-            }
-
-        } // namespace
-
         Core::FrameList FileCache::frames(void * window)
         {
             Core::FrameList frames;
-            for (auto i = _p->items.begin(); i != _p->items.end(); ++i)
+            const auto i = _p->windowItems.find(window);
+            if (i != _p->windowItems.end())
             {
-                if (window == i->first.window)
+                for (const auto & key : i->second)
                 {
-                    frames.push_back(i->first.frame);
+                    frames.push_back(key.frame);
                 }
             }
-            qSort(frames.begin(), frames.end(), compare);
+            frames.sort();
             return frames;
         }
 
@@ -212,14 +670,8 @@ namespace djv
 
         float FileCache::currentSizeGB(void * window) const
         {
-            quint64 size = 0;
-            for (auto i = _p->items.begin(); i != _p->items.end(); ++i)
-            {
-                if (window == i->first.window)
-                {
-                    size += i->second->dataByteCount();
-                }
-            }
+            const auto i = _p->windowBytes.find(window);
+            const quint64 size = i != _p->windowBytes.end() ? i->second : 0;
             return size / static_cast<float>(Core::Memory::gigabyte);
         }
 
@@ -233,6 +685,26 @@ namespace djv
             return _p->cacheBytes;
         }
 
+        float FileCache::compressedMaxSizeGB() const
+        {
+            return _p->compressedMaxBytes / static_cast<float>(Core::Memory::gigabyte);
+        }
+
+        float FileCache::compressedSizeGB() const
+        {
+            return _p->compressedBytes / static_cast<float>(Core::Memory::gigabyte);
+        }
+
+        float FileCache::diskMaxSizeGB() const
+        {
+            return _p->spilledMaxBytes / static_cast<float>(Core::Memory::gigabyte);
+        }
+
+        float FileCache::diskSizeGB() const
+        {
+            return _p->spilledBytes / static_cast<float>(Core::Memory::gigabyte);
+        }
+
         const QVector<float> & FileCache::sizeGBDefaults()
         {
             static const QVector<float> data = QVector<float>() <<
@@ -257,9 +729,11 @@ namespace djv
             {
                 DJV_DEBUG_PRINT(
                     "item (count = " <<
-                    i->second.use_count() <<
+                    i->second.image.use_count() <<
+                    ", windows = " <<
+                    i->second.windows.size() <<
                     ") = " <<
-                    reinterpret_cast<qint64>(i->first.window) <<
+                    i->first.fileName <<
                     " " <<
                     i->first.frame);
             }*/
@@ -271,6 +745,10 @@ namespace djv
             //DJV_DEBUG_PRINT("size = " << size);
             //debug();
             _p->maxBytes = static_cast<quint64>(size * Core::Memory::gigabyte);
+
+            // The blocks kept in the memory pool are not counted with the
+            // cache, so limit the pool to a fraction of the cache size.
+            Core::MemoryPool::setMaxPooledBytes(_p->maxBytes / 8);
             //if (_p->cacheBytes > _p->maxBytes)
             purge();
             //debug();
@@ -281,26 +759,166 @@ namespace djv
             //DJV_DEBUG("FileCache::purge");
             debug();
 
-            // Delete as many items as possible to bring the cache size below the maximum size.
-            std::map<::time_t, FileCacheKey> sortedByTime;
-            for (auto i : _p->items)
+            // Evict the items on probation first so that the frames which have
+            // been used more than once stay in the cache. The evicted items
+            // that are waiting to be compressed or written to disk are counted
+            // with the cache.
+            _p->pendingUpdate();
+            while (_p->cacheBytes + _p->pendingBytes > _p->maxBytes && !_p->items.empty())
+            {
+                const auto & list = !_p->probation.empty() ? _p->probation : _p->protect;
+                const auto i = _p->items.find(list.back());
+
+                // Compress the evicted item and write it to disk in the
+                // background.
+                if (_p->compress &&
+                    _p->pendingRoom(i->first, i->second.byteCount) &&
+                    _p->compressedItems.find(i->first) == _p->compressedItems.end() &&
+                    !_p->compress->isPending(i->first))
+                {
+                    _p->compress->requestCompress(i->first, i->second.image);
+                    _p->pendingAdd(i->first, i->second.byteCount);
+                }
+
+                // Items larger than the disk cache are not written since they
+                // would be evicted as soon as they are added.
+                if (_p->spill &&
+                    i->second.byteCount <= _p->spilledMaxBytes &&
+                    _p->pendingRoom(i->first, i->second.byteCount) &&
+                    _p->spilledItems.find(i->first) == _p->spilledItems.end() &&
+                    !_p->spill->isPending(i->first))
+                {
+                    _p->spill->requestWrite(i->first, i->second.image);
+                    _p->pendingAdd(i->first, i->second.byteCount);
+                }
+                if ((_p->compress || _p->spill) && !_p->timer)
+                {
+                    _p->timer = startTimer(timerInterval);
+                }
+
+                _p->erase(i);
+            }
+
+            Q_EMIT cacheChanged();
+            debug();
+        }
+
+        void FileCache::compressedPurge()
+        {
+            while (_p->compressedBytes > _p->compressedMaxBytes && !_p->compressedList.empty())
             {
-                sortedByTime[i.first.timestamp] = i.first;
+                _p->compressedErase(_p->compressedItems.find(_p->compressedList.back()));
             }
-            auto j = sortedByTime.begin();
-            while (_p->cacheBytes > _p->maxBytes && j != sortedByTime.end())
+        }
+
+        void FileCache::setCompressedMaxSizeGB(float size)
+        {
+            _p->compressedMaxBytes = static_cast<quint64>(size * Core::Memory::gigabyte);
+            if (_p->compressedMaxBytes)
             {
-                auto k = _p->items.find(j->second);
-                if (k != _p->items.end())
+                if (!_p->compress)
                 {
-                    _p->cacheBytes -= k->second->dataByteCount();
-                    _p->items.erase(k);
-                    j = sortedByTime.erase(j);
+                    _p->compress.reset(new FileCacheCompress);
                 }
             }
+            else
+            {
+                _p->compress.reset();
+                _p->pendingUpdate();
+            }
+            compressedPurge();
+            Q_EMIT cacheChanged();
+        }
+
+        void FileCache::diskPurge()
+        {
+            while (_p->spilledBytes > _p->spilledMaxBytes && !_p->spilledList.empty())
+            {
+                _p->spilledErase(_p->spilledItems.find(_p->spilledList.back()));
+            }
+        }
 
+        void FileCache::setDiskMaxSizeGB(float size)
+        {
+            _p->spilledMaxBytes = static_cast<quint64>(size * Core::Memory::gigabyte);
+            if (_p->spilledMaxBytes)
+            {
+                if (!_p->spill)
+                {
+                    _p->spill.reset(new FileCacheSpill);
+                }
+            }
+            else
+            {
+                _p->spilledClear();
+                _p->spill.reset();
+                _p->pendingUpdate();
+            }
+            diskPurge();
             Q_EMIT cacheChanged();
-            debug();
+        }
+
+        void FileCache::timerEvent(QTimerEvent *)
+        {
+            if (_p->compress)
+            {
+                compressedTimerUpdate();
+            }
+
+            // Add the items that have finished writing.
+            if (_p->spill)
+            {
+                for (const auto & i : _p->spill->takeWritten())
+                {
+                    if (_p->spilledItems.find(i.first) == _p->spilledItems.end())
+                    {
+                        SpilledItem item;
+                        item.data = i.second;
+                        _p->spilledList.push_front(i.first);
+                        item.listIt = _p->spilledList.begin();
+                        _p->spilledItems[i.first] = item;
+                        _p->spilledBytes += i.second->byteCount;
+                    }
+                    else
+                    {
+                        FileCacheSpill::remove(*i.second);
+                    }
+                }
+                diskPurge();
+            }
+
+            _p->pendingUpdate();
+            if (!_p->hasPending())
+            {
+                killTimer(_p->timer);
+                _p->timer = 0;
+            }
+        }
+
+        void FileCache::compressedTimerUpdate()
+        {
+            // Add the items that have finished compressing.
+            for (const auto & i : _p->compress->takeCompressed())
+            {
+                if (_p->compressedItems.find(i.first) == _p->compressedItems.end())
+                {
+                    CompressedItem item;
+                    item.data = i.second;
+                    item.byteCount = i.second->data.size();
+                    _p->compressedList.push_front(i.first);
+                    item.listIt = _p->compressedList.begin();
+                    _p->compressedItems[i.first] = item;
+                    _p->compressedBytes += item.byteCount;
+                }
+            }
+            compressedPurge();
+
+            // Add the items that have finished decompressing. The windows
+            // reference them when they are next requested.
+            for (const auto & i : _p->compress->takeDecompressed())
+            {
+                addItem(nullptr, i.first, i.second);
+            }
         }
 
         void FileCache::cacheEnabledCallback(bool cache)
@@ -31,14 +31,15 @@
 
 #include <djvViewLib/ViewLib.h>
 
+#include <djvAV/PixelData.h>
+
 #include <djvCore/Sequence.h>
-#include <djvCore/Time.h>
 #include <djvCore/Util.h>
 
 #include <QObject>
 
 #include <memory>
-#include <map>
+#include <vector>
 
 namespace djv
 {
@@ -52,19 +53,49 @@ namespace djv
     {
         class ViewContext;
 
+        //! This struct provides the identity of a cached frame. Windows that
+        //! show the same file with the same options share the cached frames.
         struct FileCacheKey
         {
             FileCacheKey();
-            FileCacheKey(void * window, qint64 frame);
-
-            void * window = nullptr;
+            FileCacheKey(
+                const QString & fileName,
+                qint64 frame,
+                int layer,
+                AV::PixelDataInfo::PROXY,
+                bool u8Conversion,
+                ::time_t time);
+
+            QString fileName;
             qint64 frame = 0;
-            ::time_t timestamp = 0;
+            int layer = 0;
+            AV::PixelDataInfo::PROXY proxy = static_cast<AV::PixelDataInfo::PROXY>(0);
+            bool u8Conversion = false;
+            ::time_t time = 0;
 
+            bool operator == (const FileCacheKey &) const;
             bool operator < (const FileCacheKey &) const;
         };
 
         //! This class provides the file cache.
+        //!
+        //! Items are evicted in least recently used order. New items start on
+        //! a probation list and are only moved to the protected list when they
+        //! are shown a second time, so scrubbing through frames once does not
+        //! evict the frames of a playback loop.
+        //!
+        //! Each window holds references to the items it uses. Items that are no
+        //! longer referenced by any window stay in the cache, so re-opening a
+        //! file does not decode the frames again, but they are evicted first.
+        //!
+        //! When the compressed cache is enabled, evicted items are compressed
+        //! in the background and kept in a second tier with a separate size.
+        //! Compressed items are decompressed ahead of the playhead instead of
+        //! being read from disk again.
+        //!
+        //! When the disk cache is enabled, evicted items are also written to
+        //! scratch files on a local disk and mapped back into memory when they
+        //! are needed again.
         class FileCache : public QObject
         {
             Q_OBJECT
@@ -76,26 +107,59 @@ namespace djv
             //! Get whether the cache contains an item.
             bool hasItem(const FileCacheKey &);
 
-            //! Get an item from the cache.
+            //! Get an item from the cache to be shown and mark it as used. A null
+            //! pointer is returned if the item is not in the cache.
             std::shared_ptr<AV::Image> item(const FileCacheKey &) const;
 
-            //! Add an item to the cache.
-            void addItem(const FileCacheKey &, const std::shared_ptr<AV::Image> &);
+            //! Get an item from the cache without marking it as used. A null
+            //! pointer is returned if the item is not in the cache.
+            std::shared_ptr<AV::Image> peekItem(const FileCacheKey &) const;
+
+            //! Mark the given items as recently used and referenced by the given
+            //! window, without moving them to the protected list. The items should
+            //! be ordered from the least to the most important, for example the
+            //! frames furthest from the playhead first.
+            void touchItems(void *, const std::vector<FileCacheKey> &);
 
-            //! Remove all items with a zero reference count that match the given window.
+            //! Add an item to the cache that is referenced by the given window. If
+            //! the cache already contains the item the existing item is kept.
+            void addItem(void *, const FileCacheKey &, const std::shared_ptr<AV::Image> &);
+
+            //! Release the references of the given window.
             void clearItems(void *);
 
-            //! Remove all items with a zero reference count.
+            //! Get whether the compressed cache contains an item.
+            bool hasCompressedItem(const FileCacheKey &) const;
+
+            //! Decompress an item from the compressed cache. A null pointer is
+            //! returned if the item is not in the compressed cache.
+            std::shared_ptr<AV::Image> decompressItem(const FileCacheKey &);
+
+            //! Set the items to decompress in the background for the given window,
+            //! in priority order. The decompressed items are added to the cache.
+            void decompressItems(void *, const std::vector<FileCacheKey> &);
+
+            //! Get whether an item is being decompressed in the background.
+            bool isDecompressing(const FileCacheKey &) const;
+
+            //! Get whether the disk cache contains an item.
+            bool hasDiskItem(const FileCacheKey &) const;
+
+            //! Map an item from the disk cache. A null pointer is returned if the
+            //! item is not in the disk cache.
+            std::shared_ptr<AV::Image> diskItem(const FileCacheKey &);
+
+            //! Remove all items.
             void clear();
 
             //! Remove an item.
             void removeItem(const FileCacheKey &);
 
-            //! Get the list of items that match the given window.
+            //! Get the list of items referenced by the given window.
             std::vector<std::shared_ptr<AV::Image> > items(void *);
 
-            //! Get the list of frames that match the given window. The frames are sorted in
-            //! ascending order.
+            //! Get the list of frames referenced by the given window. The frames are
+            //! sorted in ascending order.
             Core::FrameList frames(void *);
 
             //! Get the maximum cache size in gigabytes.
@@ -104,7 +168,8 @@ namespace djv
             //! Get the maximum cache size in bytes.
             quint64 maxSizeBytes() const;
 
-            //! Get the current size in gigabytes for the given window.
+            //! Get the current size in gigabytes of the items referenced by the given
+            //! window.
             float currentSizeGB(void *) const;
 
             //! Get the current cache size in gigabytes.
@@ -113,6 +178,18 @@ namespace djv
             //! Get the current cache size in bytes.
             quint64 currentSizeBytes() const;
 
+            //! Get the maximum compressed cache size in gigabytes.
+            float compressedMaxSizeGB() const;
+
+            //! Get the current compressed cache size in gigabytes.
+            float compressedSizeGB() const;
+
+            //! Get the maximum disk cache size in gigabytes.
+            float diskMaxSizeGB() const;
+
+            //! Get the current disk cache size in gigabytes.
+            float diskSizeGB() const;
+
             //! Get the cache size defaults in gigabytes.
             static const QVector<float> & sizeGBDefaults();
 
@@ -123,6 +200,14 @@ namespace djv
             //! Set the maximum cache size in gigabytes.
             void setMaxSizeGB(float);
 
+            //! Set the maximum compressed cache size in gigabytes. A size of zero
+            //! disables the compressed cache.
+            void setCompressedMaxSizeGB(float);
+
+            //! Set the maximum disk cache size in gigabytes. A size of zero
+            //! disables the disk cache.
+            void setDiskMaxSizeGB(float);
+
         Q_SIGNALS:
             //! This signal is emitted when the cache is modified.
             void cacheChanged();
@@ -131,12 +216,24 @@ namespace djv
             void cacheEnabledCallback(bool);
             void cacheSizeGBCallback(float);
 
-        private:
-            void removeItem(int index);
+        protected:
+            void timerEvent(QTimerEvent *) override;
 
-            // Delete null references only if the cache size exceeds the maximum.
+        private:
+            // Evict the least recently used items until the cache size is below
+            // the maximum.
             void purge();
 
+            // Evict the least recently used compressed items until the compressed
+            // cache size is below the maximum.
+            void compressedPurge();
+
+            // Evict the least recently used items from the disk cache until the
+            // disk cache size is below the maximum.
+            void diskPurge();
+
+            void compressedTimerUpdate();
+
             DJV_PRIVATE_COPY(FileCache);
 
             struct Private;
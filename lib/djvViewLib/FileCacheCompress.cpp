@@ -0,0 +1,350 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvViewLib/FileCacheCompress.h>
+
+#include <djvAV/Pixel.h>
+
+#include <djvCore/Math.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace djv
+{
+    namespace ViewLib
+    {
+        namespace
+        {
+            // The zlib compression level, the fastest is used so that images
+            // can be compressed as quickly as they are evicted.
+            const int compressLevel = 1;
+
+            struct Request
+            {
+                void *                                 window = nullptr;
+                FileCacheKey                           key;
+                std::shared_ptr<AV::Image>             image;
+                std::shared_ptr<FileCacheCompressData> data;
+            };
+
+            // Get the size of the elements that are split into planes, and the
+            // number of elements in a pixel. Packed pixels are treated as a
+            // single element.
+            void elements(AV::Pixel::PIXEL pixel, int & byteCount, int & count)
+            {
+                const int pixelByteCount = AV::Pixel::byteCount(pixel);
+                byteCount = AV::Pixel::channelByteCount(pixel);
+                if (!byteCount)
+                {
+                    byteCount = pixelByteCount;
+                }
+                count = pixelByteCount / byteCount;
+            }
+
+        } // namespace
+
+        struct FileCacheCompress::Private
+        {
+            std::vector<std::thread> threads;
+
+            mutable std::mutex mutex;
+            std::condition_variable cv;
+            std::deque<Request> decompressRequests;
+            std::deque<Request> compressRequests;
+            std::set<FileCacheKey> inFlight;
+            std::vector<std::pair<FileCacheKey, std::shared_ptr<FileCacheCompressData> > > compressed;
+            std::vector<std::pair<FileCacheKey, std::shared_ptr<AV::Image> > > decompressed;
+            quint64 generation = 0;
+            bool stop = false;
+        };
+
+        FileCacheCompress::FileCacheCompress() :
+            _p(new Private)
+        {
+            // Leave threads free for the pre-loader and the user interface.
+            const int count = Core::Math::clamp(
+                static_cast<int>(std::thread::hardware_concurrency()) / 2, 1, 4);
+            for (int i = 0; i < count; ++i)
+            {
+                _p->threads.push_back(std::thread(&FileCacheCompress::worker, this));
+            }
+        }
+
+        FileCacheCompress::~FileCacheCompress()
+        {
+            {
+                std::unique_lock<std::mutex> lock(_p->mutex);
+                _p->stop = true;
+                _p->cv.notify_all();
+            }
+            for (auto & thread : _p->threads)
+            {
+                thread.join();
+            }
+        }
+
+        std::shared_ptr<FileCacheCompressData> FileCacheCompress::compress(const AV::Image & image)
+        {
+            // The size given to qCompress() is an int.
+            const quint64 dataByteCount = image.dataByteCount();
+            if (dataByteCount > static_cast<quint64>(std::numeric_limits<int>::max()))
+            {
+                return nullptr;
+            }
+
+            auto out = std::shared_ptr<FileCacheCompressData>(new FileCacheCompressData);
+            out->info = image.info();
+            out->tags = image.tags;
+            out->colorProfile = image.colorProfile;
+
+            int elementByteCount = 0;
+            int elementCount = 0;
+            elements(out->info.pixel, elementByteCount, elementCount);
+            const quint64 count = dataByteCount / elementByteCount;
+            std::vector<quint8> planes(dataByteCount);
+            const quint8 * p = image.data();
+            for (int i = 0; i < elementByteCount; ++i)
+            {
+                quint8 * plane = planes.data() + i * count;
+                const quint8 * in = p + i;
+                for (quint64 j = 0; j < count; ++j, in += elementByteCount)
+                {
+                    plane[j] = *in;
+                }
+                for (quint64 j = count; j > static_cast<quint64>(elementCount); --j)
+                {
+                    plane[j - 1] -= plane[j - 1 - elementCount];
+                }
+            }
+
+            // Copy the bytes that do not fill an element.
+            const quint64 tail = count * elementByteCount;
+            std::copy(p + tail, p + dataByteCount, planes.data() + tail);
+
+            out->data = qCompress(planes.data(), static_cast<int>(dataByteCount), compressLevel);
+            return out;
+        }
+
+        std::shared_ptr<AV::Image> FileCacheCompress::decompress(const FileCacheCompressData & data)
+        {
+            const QByteArray planes = qUncompress(data.data);
+            auto out = std::shared_ptr<AV::Image>(new AV::Image(data.info));
+            const quint64 dataByteCount = out->dataByteCount();
+            if (static_cast<quint64>(planes.size()) != dataByteCount)
+            {
+                return nullptr;
+            }
+            out->tags = data.tags;
+            out->colorProfile = data.colorProfile;
+
+            int elementByteCount = 0;
+            int elementCount = 0;
+            elements(data.info.pixel, elementByteCount, elementCount);
+            const quint64 count = dataByteCount / elementByteCount;
+            quint8 * p = out->data();
+            std::vector<quint8> plane(count);
+            for (int i = 0; i < elementByteCount; ++i)
+            {
+                const quint8 * in = reinterpret_cast<const quint8 *>(planes.data()) + i * count;
+                std::copy(in, in + count, plane.data());
+                for (quint64 j = elementCount; j < count; ++j)
+                {
+                    plane[j] += plane[j - elementCount];
+                }
+                quint8 * outP = p + i;
+                for (quint64 j = 0; j < count; ++j, outP += elementByteCount)
+                {
+                    *outP = plane[j];
+                }
+            }
+            const quint64 tail = count * elementByteCount;
+            std::copy(
+                reinterpret_cast<const quint8 *>(planes.data()) + tail,
+                reinterpret_cast<const quint8 *>(planes.data()) + dataByteCount,
+                p + tail);
+            return out;
+        }
+
+        void FileCacheCompress::requestCompress(const FileCacheKey & key, const std::shared_ptr<AV::Image> & image)
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            Request request;
+            request.key = key;
+            request.image = image;
+            _p->compressRequests.push_back(request);
+            _p->cv.notify_one();
+        }
+
+        void FileCacheCompress::requestDecompress(
+            void * window,
+            const std::vector<std::pair<FileCacheKey, std::shared_ptr<FileCacheCompressData> > > & items)
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            _p->decompressRequests.erase(
+                std::remove_if(
+                    _p->decompressRequests.begin(),
+                    _p->decompressRequests.end(),
+                    [window](const Request & request)
+                    {
+                        return window == request.window;
+                    }),
+                _p->decompressRequests.end());
+            for (const auto & i : items)
+            {
+                if (_p->inFlight.find(i.first) == _p->inFlight.end())
+                {
+                    Request request;
+                    request.window = window;
+                    request.key = i.first;
+                    request.data = i.second;
+                    _p->decompressRequests.push_back(request);
+                }
+            }
+            _p->cv.notify_all();
+        }
+
+        bool FileCacheCompress::isPending(const FileCacheKey & key) const
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            const auto compare = [key](const Request & request)
+            {
+                return key == request.key;
+            };
+            return
+                _p->inFlight.find(key) != _p->inFlight.end() ||
+                std::find_if(_p->decompressRequests.begin(), _p->decompressRequests.end(), compare) != _p->decompressRequests.end() ||
+                std::find_if(_p->compressRequests.begin(), _p->compressRequests.end(), compare) != _p->compressRequests.end();
+        }
+
+        bool FileCacheCompress::hasPending() const
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            return
+                _p->inFlight.size() > 0 ||
+                _p->decompressRequests.size() > 0 ||
+                _p->compressRequests.size() > 0 ||
+                _p->compressed.size() > 0 ||
+                _p->decompressed.size() > 0;
+        }
+
+        void FileCacheCompress::cancel()
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            _p->decompressRequests.clear();
+            _p->compressRequests.clear();
+            _p->compressed.clear();
+            _p->decompressed.clear();
+            ++_p->generation;
+        }
+
+        std::vector<std::pair<FileCacheKey, std::shared_ptr<FileCacheCompressData> > > FileCacheCompress::takeCompressed()
+        {
+            std::vector<std::pair<FileCacheKey, std::shared_ptr<FileCacheCompressData> > > out;
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            std::swap(out, _p->compressed);
+            return out;
+        }
+
+        std::vector<std::pair<FileCacheKey, std::shared_ptr<AV::Image> > > FileCacheCompress::takeDecompressed()
+        {
+            std::vector<std::pair<FileCacheKey, std::shared_ptr<AV::Image> > > out;
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            std::swap(out, _p->decompressed);
+            return out;
+        }
+
+        void FileCacheCompress::worker()
+        {
+            while (1)
+            {
+                // Wait for a request, decompressing takes priority since the
+                // images are needed for playback.
+                Request request;
+                quint64 generation = 0;
+                {
+                    std::unique_lock<std::mutex> lock(_p->mutex);
+                    _p->cv.wait(lock, [this]
+                    {
+                        return _p->stop || _p->decompressRequests.size() > 0 || _p->compressRequests.size() > 0;
+                    });
+                    if (_p->stop)
+                        break;
+                    auto & requests = _p->decompressRequests.size() > 0 ? _p->decompressRequests : _p->compressRequests;
+                    request = requests.front();
+                    requests.pop_front();
+                    _p->inFlight.insert(request.key);
+                    generation = _p->generation;
+                }
+
+                // The request is dropped if it fails, for example when there
+                // is not enough memory.
+                const bool compressing = request.image != nullptr;
+                try
+                {
+                    if (compressing)
+                    {
+                        request.data = compress(*request.image);
+                        request.image.reset();
+                    }
+                    else
+                    {
+                        request.image = decompress(*request.data);
+                    }
+                }
+                catch (const std::exception &)
+                {
+                    request.data.reset();
+                    request.image.reset();
+                }
+
+                std::unique_lock<std::mutex> lock(_p->mutex);
+                _p->inFlight.erase(request.key);
+                if (generation == _p->generation && !_p->stop)
+                {
+                    if (compressing && request.data)
+                    {
+                        _p->compressed.push_back(std::make_pair(request.key, request.data));
+                    }
+                    else if (!compressing && request.image)
+                    {
+                        _p->decompressed.push_back(std::make_pair(request.key, request.image));
+                    }
+                }
+            }
+        }
+
+    } // namespace ViewLib
+} // namespace djv
@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <djvViewLib/FileCache.h>
+
+#include <djvAV/Image.h>
+
+#include <QByteArray>
+
+#include <memory>
+#include <vector>
+
+namespace djv
+{
+    namespace ViewLib
+    {
+        //! This struct provides a compressed image.
+        struct FileCacheCompressData
+        {
+            AV::PixelDataInfo info;
+            AV::Tags          tags;
+            AV::ColorProfile  colorProfile;
+            QByteArray        data;
+        };
+
+        //! This class provides the compression for the file cache.
+        //!
+        //! Images are compressed losslessly. The bytes of each channel are split
+        //! into planes, each byte is replaced with the difference from the same
+        //! byte of the previous pixel, and the result is compressed with
+        //! qCompress(). The work is done by a pool of worker threads and the
+        //! results are collected on the main thread.
+        class FileCacheCompress
+        {
+        public:
+            FileCacheCompress();
+            ~FileCacheCompress();
+
+            //! Compress an image. A null pointer is returned if the image is too
+            //! large to compress.
+            static std::shared_ptr<FileCacheCompressData> compress(const AV::Image &);
+
+            //! Decompress an image. A null pointer is returned if the data is
+            //! not valid.
+            static std::shared_ptr<AV::Image> decompress(const FileCacheCompressData &);
+
+            //! Queue an image to be compressed.
+            void requestCompress(const FileCacheKey &, const std::shared_ptr<AV::Image> &);
+
+            //! Set the images to decompress for the given window in priority
+            //! order. This replaces any images for the window that have been
+            //! requested but not started. The window is only used to group the
+            //! requests.
+            void requestDecompress(
+                void * window,
+                const std::vector<std::pair<FileCacheKey, std::shared_ptr<FileCacheCompressData> > > &);
+
+            //! Get whether an image has been requested or is being compressed
+            //! or decompressed.
+            bool isPending(const FileCacheKey &) const;
+
+            //! Get whether there are images that have been requested or are
+            //! being compressed or decompressed.
+            bool hasPending() const;
+
+            //! Cancel the requests that have not been started and discard the
+            //! results that have not been taken.
+            void cancel();
+
+            //! Take the images that have finished compressing.
+            std::vector<std::pair<FileCacheKey, std::shared_ptr<FileCacheCompressData> > > takeCompressed();
+
+            //! Take the images that have finished decompressing.
+            std::vector<std::pair<FileCacheKey, std::shared_ptr<AV::Image> > > takeDecompressed();
+
+        private:
+            void worker();
+
+            DJV_PRIVATE_COPY(FileCacheCompress);
+
+            struct Private;
+            std::unique_ptr<Private> _p;
+        };
+
+    } // namespace ViewLib
+} // namespace djv
@@ -0,0 +1,273 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvViewLib/FileCacheSpill.h>
+
+#include <djvCore/Error.h>
+#include <djvCore/FileIO.h>
+#include <djvCore/System.h>
+
+#include <QDir>
+#include <QFile>
+#include <QScopedPointer>
+#include <QTemporaryDir>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace djv
+{
+    namespace ViewLib
+    {
+        namespace
+        {
+            struct Request
+            {
+                FileCacheKey               key;
+                std::shared_ptr<AV::Image> image;
+            };
+
+        } // namespace
+
+        struct FileCacheSpill::Private
+        {
+            std::unique_ptr<QTemporaryDir> dir;
+            quint64 fileCount = 0;
+            std::thread thread;
+
+            mutable std::mutex mutex;
+            std::condition_variable cv;
+            std::deque<Request> requests;
+            std::set<FileCacheKey> inFlight;
+            std::vector<std::pair<FileCacheKey, std::shared_ptr<FileCacheSpillData> > > written;
+            quint64 generation = 0;
+            bool stop = false;
+        };
+
+        FileCacheSpill::FileCacheSpill() :
+            _p(new Private)
+        {
+            // Each process creates a new directory with a unique name that
+            // only the user can access, and removes it on exit. An existing
+            // path is never reused.
+            _p->dir.reset(new QTemporaryDir(pathDefault() + "/djv-XXXXXX"));
+
+            // A single thread is used since the writes are limited by the disk.
+            _p->thread = std::thread(&FileCacheSpill::worker, this);
+        }
+
+        FileCacheSpill::~FileCacheSpill()
+        {
+            {
+                std::unique_lock<std::mutex> lock(_p->mutex);
+                _p->stop = true;
+                _p->cv.notify_all();
+            }
+            _p->thread.join();
+        }
+
+        QString FileCacheSpill::pathDefault()
+        {
+            const QString env = Core::System::env("DJV_SPILL_CACHE_PATH");
+            if (!env.isEmpty())
+                return env;
+            return QDir::tempPath();
+        }
+
+        QString FileCacheSpill::path() const
+        {
+            return _p->dir->isValid() ? _p->dir->path() : QString();
+        }
+
+        std::shared_ptr<AV::Image> FileCacheSpill::read(const FileCacheSpillData & data)
+        {
+            std::shared_ptr<AV::Image> out;
+            try
+            {
+                QScopedPointer<Core::FileIO> io(new Core::FileIO);
+                io->open(data.fileName, Core::FileIO::READ);
+                if (io->size() == data.byteCount)
+                {
+                    if (io->mmapP())
+                    {
+                        io->readAhead();
+                        const quint8 * p = io->mmapP();
+                        out = std::shared_ptr<AV::Image>(new AV::Image(data.info, p, io.data()));
+                        io.take();
+                    }
+                    else
+                    {
+                        out = std::shared_ptr<AV::Image>(new AV::Image(data.info));
+                        io->get(out->data(), data.byteCount);
+                    }
+                    out->tags = data.tags;
+                    out->colorProfile = data.colorProfile;
+                }
+            }
+            catch (const Core::Error &)
+            {
+                out.reset();
+            }
+            catch (const std::exception &)
+            {
+                out.reset();
+            }
+            return out;
+        }
+
+        void FileCacheSpill::remove(const FileCacheSpillData & data)
+        {
+            QFile::remove(data.fileName);
+        }
+
+        void FileCacheSpill::requestWrite(const FileCacheKey & key, const std::shared_ptr<AV::Image> & image)
+        {
+            if (!_p->dir->isValid())
+                return;
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            Request request;
+            request.key = key;
+            request.image = image;
+            _p->requests.push_back(request);
+            _p->cv.notify_one();
+        }
+
+        bool FileCacheSpill::isPending(const FileCacheKey & key) const
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            return
+                _p->inFlight.find(key) != _p->inFlight.end() ||
+                std::find_if(
+                    _p->requests.begin(),
+                    _p->requests.end(),
+                    [key](const Request & request)
+                    {
+                        return key == request.key;
+                    }) != _p->requests.end();
+        }
+
+        bool FileCacheSpill::hasPending() const
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            return _p->inFlight.size() > 0 || _p->requests.size() > 0 || _p->written.size() > 0;
+        }
+
+        void FileCacheSpill::cancel()
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            _p->requests.clear();
+            for (const auto & i : _p->written)
+            {
+                remove(*i.second);
+            }
+            _p->written.clear();
+            ++_p->generation;
+        }
+
+        std::vector<std::pair<FileCacheKey, std::shared_ptr<FileCacheSpillData> > > FileCacheSpill::takeWritten()
+        {
+            std::vector<std::pair<FileCacheKey, std::shared_ptr<FileCacheSpillData> > > out;
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            std::swap(out, _p->written);
+            return out;
+        }
+
+        void FileCacheSpill::worker()
+        {
+            while (1)
+            {
+                // Wait for a request.
+                Request request;
+                quint64 generation = 0;
+                quint64 fileCount = 0;
+                {
+                    std::unique_lock<std::mutex> lock(_p->mutex);
+                    _p->cv.wait(lock, [this]
+                    {
+                        return _p->stop || _p->requests.size() > 0;
+                    });
+                    if (_p->stop)
+                        break;
+                    request = _p->requests.front();
+                    _p->requests.pop_front();
+                    _p->inFlight.insert(request.key);
+                    generation = _p->generation;
+                    fileCount = _p->fileCount++;
+                }
+
+                // Write the image. The request is dropped if it fails, for
+                // example when the disk is full or there is not enough memory.
+                std::shared_ptr<FileCacheSpillData> data;
+                bool valid = false;
+                try
+                {
+                    data = std::shared_ptr<FileCacheSpillData>(new FileCacheSpillData);
+                    data->fileName = QString("%1/%2.raw").arg(_p->dir->path()).arg(fileCount);
+                    data->info = request.image->info();
+                    data->tags = request.image->tags;
+                    data->colorProfile = request.image->colorProfile;
+                    data->byteCount = request.image->dataByteCount();
+                    Core::FileIO io;
+                    io.open(data->fileName, Core::FileIO::WRITE);
+                    io.set(request.image->data(), data->byteCount);
+                    valid = true;
+                }
+                catch (const Core::Error &)
+                {}
+                catch (const std::exception &)
+                {}
+                if (!valid && data)
+                {
+                    remove(*data);
+                }
+                request.image.reset();
+
+                std::unique_lock<std::mutex> lock(_p->mutex);
+                _p->inFlight.erase(request.key);
+                if (valid)
+                {
+                    if (generation == _p->generation && !_p->stop)
+                    {
+                        _p->written.push_back(std::make_pair(request.key, data));
+                    }
+                    else
+                    {
+                        remove(*data);
+                    }
+                }
+            }
+        }
+
+    } // namespace ViewLib
+} // namespace djv
@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <djvViewLib/FileCache.h>
+
+#include <djvAV/Image.h>
+
+#include <memory>
+#include <vector>
+
+namespace djv
+{
+    namespace ViewLib
+    {
+        //! This struct provides an image that has been written to a scratch file.
+        struct FileCacheSpillData
+        {
+            QString           fileName;
+            AV::PixelDataInfo info;
+            AV::Tags          tags;
+            AV::ColorProfile  colorProfile;
+            quint64           byteCount = 0;
+        };
+
+        //! This class provides the disk tier of the file cache.
+        //!
+        //! Images are written to scratch files by a worker thread and mapped
+        //! back into memory without copying. The scratch files are kept in a
+        //! new directory for each process, created with QTemporaryDir so that
+        //! only the user can access it, which is removed on exit.
+        class FileCacheSpill
+        {
+        public:
+            FileCacheSpill();
+            ~FileCacheSpill();
+
+            //! Get the default scratch directory. This can be set with the
+            //! environment variable DJV_SPILL_CACHE_PATH.
+            static QString pathDefault();
+
+            //! Get the scratch directory. An empty string is returned if the
+            //! directory could not be created, in which case no images are
+            //! written.
+            QString path() const;
+
+            //! Map an image from a scratch file. A null pointer is returned if
+            //! the file cannot be read.
+            static std::shared_ptr<AV::Image> read(const FileCacheSpillData &);
+
+            //! Remove a scratch file.
+            static void remove(const FileCacheSpillData &);
+
+            //! Queue an image to be written.
+            void requestWrite(const FileCacheKey &, const std::shared_ptr<AV::Image> &);
+
+            //! Get whether an image has been requested or is being written.
+            bool isPending(const FileCacheKey &) const;
+
+            //! Get whether there are images that have been requested or are
+            //! being written.
+            bool hasPending() const;
+
+            //! Cancel the requests that have not been started and remove the
+            //! files that have not been taken.
+            void cancel();
+
+            //! Take the images that have finished writing.
+            std::vector<std::pair<FileCacheKey, std::shared_ptr<FileCacheSpillData> > > takeWritten();
+
+        private:
+            void worker();
+
+            DJV_PRIVATE_COPY(FileCacheSpill);
+
+            struct Private;
+            std::unique_ptr<Private> _p;
+        };
+
+    } // namespace ViewLib
+} // namespace djv
@@ -103,8 +103,16 @@ namespace djv
             //DJV_DEBUG("FileExport::~FileExport");
             delete _p->dialog;
 
-            _p->context->makeGLContextCurrent();
-            _p->openGLImage.reset();
+            if (_p->openGLImage && _p->context->hasGLContext())
+            {
+                try
+                {
+                    _p->context->makeGLContextCurrent();
+                    _p->openGLImage.reset();
+                }
+                catch (const Core::Error &)
+                {}
+            }
         }
 
         void FileExport::start(const FileExportInfo & info)
@@ -213,12 +221,6 @@ namespace djv
             //DJV_DEBUG("FileExport::callback");
             //DJV_DEBUG_PRINT("in = " << in);
 
-            _p->context->makeGLContextCurrent();
-            if (!_p->openGLImage)
-            {
-                _p->openGLImage.reset(new AV::OpenGLImage);
-            }
-
             // Load the frame.
             AV::Image image;
             try
@@ -256,6 +258,11 @@ namespace djv
                 try
                 {
                     //DJV_DEBUG_PRINT("process");
+                    _p->context->makeGLContextCurrent();
+                    if (!_p->openGLImage)
+                    {
+                        _p->openGLImage.reset(new AV::OpenGLImage);
+                    }
                     _p->openGLImage->copy(image, tmp, options);
                 }
                 catch (Core::Error error)
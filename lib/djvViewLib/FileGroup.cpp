@@ -33,9 +33,11 @@
 #include <djvViewLib/FileCache.h>
 #include <djvViewLib/FileMenu.h>
 #include <djvViewLib/FilePrefs.h>
+#include <djvViewLib/FilePreload.h>
 #include <djvViewLib/FileToolBar.h>
 #include <djvViewLib/ImagePrefs.h>
 #include <djvViewLib/ImageView.h>
+#include <djvViewLib/PlaybackGroup.h>
 #include <djvViewLib/Session.h>
 #include <djvViewLib/ViewContext.h>
 
@@ -58,17 +60,27 @@
 #include <QApplication>
 #include <QDir>
 
+#include <algorithm>
+
 namespace djv
 {
     namespace ViewLib
     {
+        namespace
+        {
+            //! The interval in milliseconds for collecting pre-loaded frames.
+            const int timerInterval = 10;
+
+        } // namespace
+
         struct FileGroup::Private
         {
             Private(const QPointer<ViewContext> & context) :
                 proxy(context->filePrefs()->proxy()),
                 u8Conversion(context->filePrefs()->hasU8Conversion()),
                 cacheEnabled(context->filePrefs()->isCacheEnabled()),
-                preload(context->filePrefs()->hasPreload())
+                preload(context->filePrefs()->hasPreload()),
+                preloader(new FilePreload(context))
             {}
 
             Core::FileInfo fileInfo;
@@ -84,6 +96,9 @@ namespace djv
             bool preloadActive = false;
             int preloadTimer = 0;
             qint64 preloadFrame = 0;
+            Enum::PLAYBACK preloadPlayback = Enum::STOP;
+            std::unique_ptr<FilePreload> preloader;
+            bool preloaderError = false;
             QPointer<FileActions> actions;
         };
 
@@ -114,8 +129,6 @@ namespace djv
             {
                 open(_p->fileInfo);
             }
-            context->makeGLContextCurrent();
-            _p->openGLImage.reset(new AV::OpenGLImage);
             preloadUpdate();
             update();
 
@@ -226,7 +239,7 @@ namespace djv
             connect(
                 context->ioFactory(),
                 SIGNAL(optionChanged()),
-                SLOT(reloadCallback()));
+                SLOT(ioOptionCallback()));
         }
 
         FileGroup::~FileGroup()
@@ -236,9 +249,20 @@ namespace djv
                 killTimer(_p->preloadTimer);
                 _p->preloadTimer = 0;
             }
+            _p->preloader->stop();
             cacheDel();
-            context()->makeGLContextCurrent();
-            _p->openGLImage.reset();
+            // Only make the context current if there are OpenGL objects to
+            // release; destructors must not create the context or throw.
+            if (_p->openGLImage && context()->hasGLContext())
+            {
+                try
+                {
+                    context()->makeGLContextCurrent();
+                    _p->openGLImage.reset();
+                }
+                catch (const Core::Error &)
+                {}
+            }
         }
 
         const Core::FileInfo & FileGroup::fileInfo() const
@@ -281,21 +305,35 @@ namespace djv
             return _p->preloadFrame;
         }
 
+        Enum::PLAYBACK FileGroup::preloadPlayback() const
+        {
+            return _p->preloadPlayback;
+        }
+
         std::shared_ptr<AV::Image> FileGroup::image(qint64 frame) const
         {
             //DJV_DEBUG("FileGroup::image");
             //DJV_DEBUG_PRINT("frame = " << frame);
             std::shared_ptr<AV::Image> out;
-            context()->makeGLContextCurrent();
             auto cache = context()->fileCache();
-            const auto key = FileCacheKey(session(), frame);
+            const auto key = cacheKey(frame);
             if (cache->hasItem(key))
             {
                 out = cache->item(key);
             }
             else
             {
-                if (_p->load)
+                if (cache->hasDiskItem(key))
+                {
+                    //DJV_DEBUG_PRINT("mapping image");
+                    out = cache->diskItem(key);
+                }
+                if (!out && cache->hasCompressedItem(key))
+                {
+                    //DJV_DEBUG_PRINT("decompressing image");
+                    out = cache->decompressItem(key);
+                }
+                if (!out && _p->load)
                 {
                     //DJV_DEBUG_PRINT("loading image");
                     out = std::shared_ptr<AV::Image>(new AV::Image);
@@ -322,6 +360,11 @@ namespace djv
                         if (_p->u8Conversion)
                         {
                             //DJV_DEBUG_PRINT("u8 conversion");
+                            context()->makeGLContextCurrent();
+                            if (!_p->openGLImage)
+                            {
+                                _p->openGLImage.reset(new AV::OpenGLImage);
+                            }
                             AV::PixelDataInfo info(out->info());
                             info.pixel = AV::Pixel::pixel(AV::Pixel::format(info.pixel), AV::Pixel::U8);
                             auto tmp = out;
@@ -345,12 +388,23 @@ namespace djv
                 if (_p->cacheEnabled && out)
                 {
                     //DJV_DEBUG_PRINT("cache image");
-                    cache->addItem(key, out);
+                    cache->addItem(session(), key, out);
                 }
             }
             return out;
         }
 
+        FileCacheKey FileGroup::cacheKey(qint64 frame) const
+        {
+            return FileCacheKey(
+                _p->fileInfo.fileName(),
+                frame,
+                _p->layer,
+                _p->proxy,
+                _p->u8Conversion,
+                _p->fileInfo.time());
+        }
+
         const AV::IOInfo & FileGroup::ioInfo() const
         {
             return _p->ioInfo;
@@ -385,6 +439,11 @@ namespace djv
             if (!tmp.fileName().isEmpty())
             {
                 //DJV_DEBUG_PRINT("loading...");
+
+                // Read the file time, which is part of the cache keys, so that
+                // the frames of a file which has changed on disk are not found
+                // in the cache.
+                tmp.stat();
                 try
                 {
                     _p->load = context()->ioFactory()->load(tmp, _p->ioInfo);
@@ -492,11 +551,31 @@ namespace djv
         {
             if (frame == _p->preloadFrame)
                 return;
+            // Cancel the pending requests when seeking.
+            const int totalFrames = _p->ioInfo.sequence.frames.count();
+            const qint64 next = Core::Math::wrap<qint64>(_p->preloadFrame + 1, 0, totalFrames - 1);
+            const qint64 prev = Core::Math::wrap<qint64>(_p->preloadFrame - 1, 0, totalFrames - 1);
+            if (frame != next && frame != prev)
+            {
+                _p->preloader->cancel();
+            }
             _p->preloadFrame = frame;
             preloadUpdate();
             update();
         }
 
+        void FileGroup::setPreloadPlayback(Enum::PLAYBACK playback)
+        {
+            if (playback == _p->preloadPlayback)
+                return;
+            //DJV_DEBUG("FileGroup::setPreloadPlayback");
+            //DJV_DEBUG_PRINT("playback = " << playback);
+            _p->preloadPlayback = playback;
+            _p->preloader->cancel();
+            preloadUpdate();
+            update();
+        }
+
         void FileGroup::timerEvent(QTimerEvent *)
         {
             //DJV_DEBUG("FileGroup::timerEvent");
@@ -506,81 +585,125 @@ namespace djv
             //DJV_DEBUG_PRINT("cache byte count     = " << cache->currentSizeBytes());
             //DJV_DEBUG_PRINT("cache max byte count = " << cache->maxSizeBytes());
 
-            const auto items = cache->items(session());
+            // Add the frames that have finished loading to the cache.
+            for (const auto & i : _p->preloader->takeFrames())
+            {
+                //DJV_DEBUG_PRINT("image = " << *i.second);
+                cache->addItem(session(), cacheKey(i.first), i.second);
+            }
 
-            // Search for the next frame that isn't in the cache.
-            bool      preload = false;
-            quint64   byteCount = 0;
-            qint64    frame = _p->preloadFrame;
-            int       frameCount = 0;
+            // Start the pre-loader.
             const int totalFrames = _p->ioInfo.sequence.frames.count();
-            for (;
-                byteCount <= cache->maxSizeBytes() &&
-                frameCount < totalFrames;
-                frame = Core::Math::wrap<qint64>(frame + 1, 0, totalFrames - 1), ++frameCount)
+            // The pre-loader is not restarted after an error until the file,
+            // layer, or proxy changes.
+            if (_p->load && totalFrames && !_p->preloader->isRunning() && !_p->preloaderError)
             {
-                const auto key = FileCacheKey(session(), frame);
-                if (cache->hasItem(key))
+                FilePreloadInfo info;
+                info.fileInfo = _p->fileInfo;
+                info.ioInfo = _p->ioInfo;
+                info.layer = _p->layer;
+                info.proxy = _p->proxy;
+                info.u8Conversion = _p->u8Conversion;
+                try
                 {
-                    byteCount += cache->item(key)->dataByteCount();
+                    _p->preloader->start(info);
                 }
-                else
+                catch (Core::Error error)
                 {
-                    byteCount += AV::PixelDataUtil::dataByteCount(_p->ioInfo.layers[0]);
-                    if (byteCount <= cache->maxSizeBytes())
-                    {
-                        preload = true;
-                    }
-                    break;
+                    error.add(
+                        Enum::errorLabels()[Enum::ERROR_READ_IMAGE].
+                        arg(QDir::toNativeSeparators(_p->fileInfo)));
+                    context()->printError(error);
+                    _p->preloader->stop();
+                    _p->preloaderError = true;
                 }
             }
-            //DJV_DEBUG_PRINT("byteCount = " << byteCount);
-            //DJV_DEBUG_PRINT("preload   = " << preload);
-            //DJV_DEBUG_PRINT("frame     = " << frame);
 
-            if (preload)
+            // Search for the frames that aren't in the cache in priority order.
+            // When playing the search starts far enough ahead of the current
+            // frame that the frames are loaded before they are needed.
+            std::vector<qint64> requests;
+            std::vector<FileCacheKey> compressedKeys;
+            std::vector<FileCacheKey> diskKeys;
+            if (_p->preloader->isRunning())
             {
-                context()->makeGLContextCurrent();
-                auto image = std::shared_ptr<AV::Image>(new AV::Image);
-                if (_p->load)
+                const qint64 lead =
+                    _p->preloadPlayback != Enum::STOP ?
+                    Core::Math::ceil(
+                        Core::Speed::speedToFloat(session()->playbackGroup()->speed()) *
+                        _p->preloader->averageSeconds()) :
+                    0;
+                const size_t requestsMax = static_cast<size_t>(_p->preloader->threadCount() * 2);
+                const quint64 frameByteCount = AV::PixelDataUtil::dataByteCount(_p->ioInfo.layers[0]);
+                quint64 byteCount = 0;
+                std::vector<FileCacheKey> cachedKeys;
+                for (int i = 0; i < totalFrames && requests.size() < requestsMax; ++i)
                 {
-                    //DJV_DEBUG_PRINT("loading image");
-                    try
+                    qint64 frame = _p->preloadFrame;
+                    switch (_p->preloadPlayback)
                     {
-                        _p->load->read(
-                            *image,
-                            AV::ImageIOInfo(
-                                _p->ioInfo.sequence.frames.count() ?
-                                _p->ioInfo.sequence.frames[frame] :
-                                -1,
-                                _p->layer,
-                                _p->proxy));
-                        if (image->isValid() && _p->u8Conversion)
+                    case Enum::FORWARD: frame += lead + i; break;
+                    case Enum::REVERSE: frame -= lead + i; break;
+                    default:
+                        // Pre-load two frames ahead for every frame behind.
+                        switch (i % 3)
                         {
-                            //DJV_DEBUG_PRINT("u8 conversion");
-                            //DJV_DEBUG_PRINT("image = " << *image);
-                            AV::PixelDataInfo info(image->info());
-                            info.pixel = AV::Pixel::pixel(AV::Pixel::format(info.pixel), AV::Pixel::U8);
-                            auto tmp = image;
-                            image = std::shared_ptr<AV::Image>(new AV::Image(info));
-                            image->tags = tmp->tags;
-                            AV::OpenGLImageOptions options;
-                            options.colorProfile = tmp->colorProfile;
-                            options.proxyScale = false;
-                            _p->openGLImage->copy(*tmp, *image, options);
+                        case 0: frame += (i / 3) * 2;     break;
+                        case 1: frame += (i / 3) * 2 + 1; break;
+                        case 2: frame -= i / 3 + 1;       break;
                         }
+                        break;
+                    }
+                    frame = Core::Math::wrap<qint64>(frame, 0, totalFrames - 1);
+                    const auto key = cacheKey(frame);
+                    const bool cached = cache->hasItem(key);
+                    byteCount += cached ? cache->peekItem(key)->dataByteCount() : frameByteCount;
+                    if (byteCount > cache->maxSizeBytes())
+                        break;
+                    if (cached)
+                    {
+                        cachedKeys.push_back(key);
+                    }
+                    else if (cache->hasDiskItem(key))
+                    {
+                        // Frames in the disk cache are mapped a few at a time
+                        // since the pages are read when they are first used.
+                        if (diskKeys.size() < requestsMax)
+                        {
+                            diskKeys.push_back(key);
+                        }
+                    }
+                    else if (cache->hasCompressedItem(key))
+                    {
+                        // Decompressing is faster than reading the frame
+                        // again.
+                        compressedKeys.push_back(key);
                     }
-                    catch (const Core::Error &)
+                    else if (!cache->isDecompressing(key))
                     {
+                        requests.push_back(frame);
                     }
                 }
-                if (image->isValid())
+
+                // Mark the cached frames around the playhead as used, the
+                // frames closest to the playhead last, so that they are the
+                // last to be evicted. This also references the frames that were
+                // cached by other windows showing the same file.
+                std::reverse(cachedKeys.begin(), cachedKeys.end());
+                cache->touchItems(session(), cachedKeys);
+                cache->decompressItems(session(), compressedKeys);
+                for (const auto & key : diskKeys)
                 {
-                    //DJV_DEBUG_PRINT("image = " << *image);
-                    cache->addItem(FileCacheKey(session(), frame), image);
+                    if (auto image = cache->diskItem(key))
+                    {
+                        cache->addItem(session(), key, image);
+                    }
                 }
+                //DJV_DEBUG_PRINT("byteCount = " << byteCount);
+                //DJV_DEBUG_PRINT("requests  = " << requests.size());
+                _p->preloader->request(requests);
             }
-            else
+            if (requests.empty() && !_p->preloader->hasPending() && compressedKeys.empty() && diskKeys.empty())
             {
                 killTimer(_p->preloadTimer);
                 _p->preloadTimer = 0;
@@ -630,6 +753,9 @@ namespace djv
             _p->load.reset();
             if (!_p->fileInfo.fileName().isEmpty())
             {
+                // Update the file time so that frames which have changed on
+                // disk are not found in the cache.
+                _p->fileInfo.stat();
                 try
                 {
                     _p->load = context()->ioFactory()->load(_p->fileInfo, _p->ioInfo);
@@ -654,6 +780,7 @@ namespace djv
                 Q_EMIT setFrameStore();
             }
             Q_EMIT reloadFrame();
+            _p->preloader->stop();
             _p->load.reset();
             if (!_p->fileInfo.fileName().isEmpty())
             {
@@ -756,6 +883,14 @@ namespace djv
             context()->fileCache()->clear();
         }
 
+        void FileGroup::ioOptionCallback()
+        {
+            // The cached frames of every file were loaded with the previous
+            // options.
+            context()->fileCache()->clear();
+            reloadCallback();
+        }
+
         void FileGroup::messagesCallback()
         {
             auto dialog = context()->messagesDialog();
@@ -786,11 +921,12 @@ namespace djv
             {
                 if (!_p->preloadTimer)
                 {
-                    _p->preloadTimer = startTimer(0);
+                    _p->preloadTimer = startTimer(timerInterval);
                 }
             }
             else
             {
+                _p->preloader->cancel();
                 if (_p->preloadTimer)
                 {
                     killTimer(_p->preloadTimer);
@@ -815,6 +951,8 @@ namespace djv
         void FileGroup::cacheDel()
         {
             //DJV_DEBUG("FileGroup::cacheDel");
+            _p->preloader->stop();
+            _p->preloaderError = false;
             context()->fileCache()->clearItems(session());
         }
 
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <djvViewLib/AbstractGroup.h>
+#include <djvViewLib/Enum.h>
 
 #include <djvAV/IO.h>
 #include <djvAV/Pixel.h>
@@ -43,6 +44,7 @@ namespace djv
     namespace ViewLib
     {
         class FileCacheRef;
+        struct FileCacheKey;
 
         //! This class provides the file group. The file group encapsulates all
         //! of thefunctionality relating to files such as the currently opened file,
@@ -82,9 +84,15 @@ namespace djv
             //! Get the cache pre-load frame.
             qint64 preloadFrame() const;
 
+            //! Get the cache pre-load playback direction.
+            Enum::PLAYBACK preloadPlayback() const;
+
             //! Get an image.
             std::shared_ptr<AV::Image> image(qint64 frame) const;
 
+            //! Get the file cache key for the given frame.
+            FileCacheKey cacheKey(qint64 frame) const;
+
             //! Get image I/O information.
             const AV::IOInfo & ioInfo() const;
 
@@ -116,6 +124,10 @@ namespace djv
             //! Set the cache pre-load frame.
             void setPreloadFrame(qint64);
 
+            //! Set the cache pre-load playback direction. Frames are pre-loaded
+            //! in the direction of playback first.
+            void setPreloadPlayback(djv::ViewLib::Enum::PLAYBACK);
+
         Q_SIGNALS:
             //! This signal is emitted when the I/O information is changed.
             void ioInfoChanged(const djv::AV::IOInfo &);
@@ -152,6 +164,7 @@ namespace djv
             void layerNextCallback();
             void proxyCallback(QAction *);
             void cacheClearCallback();
+            void ioOptionCallback();
             void messagesCallback();
             void prefsCallback();
             void debugLogCallback();
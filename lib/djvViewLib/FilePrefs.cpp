@@ -46,6 +46,8 @@ namespace djv
             _u8Conversion(u8ConversionDefault()),
             _cacheEnabled(cacheEnabledDefault()),
             _cacheSizeGB(cacheSizeGBDefault()),
+            _compressedCacheSizeGB(compressedCacheSizeGBDefault()),
+            _diskCacheSizeGB(diskCacheSizeGBDefault()),
             _preload(preloadDefault()),
             _displayCache(displayCacheDefault())
         {
@@ -55,6 +57,8 @@ namespace djv
             prefs.get("u8Conversion", _u8Conversion);
             prefs.get("cache", _cacheEnabled);
             prefs.get("cacheSize", _cacheSizeGB);
+            prefs.get("compressedCacheSize", _compressedCacheSizeGB);
+            prefs.get("diskCacheSize", _diskCacheSizeGB);
             prefs.get("preload", _preload);
             prefs.get("displayCache", _displayCache);
             if (_recent.count() > Core::FileInfoUtil::recentMax)
@@ -69,6 +73,8 @@ namespace djv
             prefs.set("u8Conversion", _u8Conversion);
             prefs.set("cache", _cacheEnabled);
             prefs.set("cacheSize", _cacheSizeGB);
+            prefs.set("compressedCacheSize", _compressedCacheSizeGB);
+            prefs.set("diskCacheSize", _diskCacheSizeGB);
             prefs.set("preload", _preload);
             prefs.set("displayCache", _displayCache);
         }
@@ -127,6 +133,26 @@ namespace djv
             return _cacheSizeGB;
         }
 
+        float FilePrefs::compressedCacheSizeGBDefault()
+        {
+            return 0.f;
+        }
+
+        float FilePrefs::compressedCacheSizeGB() const
+        {
+            return _compressedCacheSizeGB;
+        }
+
+        float FilePrefs::diskCacheSizeGBDefault()
+        {
+            return 0.f;
+        }
+
+        float FilePrefs::diskCacheSizeGB() const
+        {
+            return _diskCacheSizeGB;
+        }
+
         bool FilePrefs::preloadDefault()
         {
             return true;
@@ -183,6 +209,24 @@ namespace djv
             Q_EMIT prefChanged();
         }
 
+        void FilePrefs::setCompressedCacheSizeGB(float size)
+        {
+            if (size == _compressedCacheSizeGB)
+                return;
+            _compressedCacheSizeGB = size;
+            Q_EMIT compressedCacheSizeGBChanged(_compressedCacheSizeGB);
+            Q_EMIT prefChanged();
+        }
+
+        void FilePrefs::setDiskCacheSizeGB(float size)
+        {
+            if (size == _diskCacheSizeGB)
+                return;
+            _diskCacheSizeGB = size;
+            Q_EMIT diskCacheSizeGBChanged(_diskCacheSizeGB);
+            Q_EMIT prefChanged();
+        }
+
         void FilePrefs::setPreload(bool preload)
         {
             if (preload == _preload)
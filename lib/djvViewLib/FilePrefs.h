@@ -80,6 +80,18 @@ namespace djv
             //! Get the cache size in gigabytes.
             float cacheSizeGB() const;
 
+            //! Get the default compressed cache size in gigabytes.
+            static float compressedCacheSizeGBDefault();
+
+            //! Get the compressed cache size in gigabytes.
+            float compressedCacheSizeGB() const;
+
+            //! Get the default disk cache size in gigabytes.
+            static float diskCacheSizeGBDefault();
+
+            //! Get the disk cache size in gigabytes.
+            float diskCacheSizeGB() const;
+
             //! Get the default for whether the cache is pre-loaded.
             static bool preloadDefault();
 
@@ -105,6 +117,12 @@ namespace djv
             //! Set the cache size in gigabytes.
             void setCacheSizeGB(float);
 
+            //! Set the compressed cache size in gigabytes.
+            void setCompressedCacheSizeGB(float);
+
+            //! Set the disk cache size in gigabytes.
+            void setDiskCacheSizeGB(float);
+
             //! Set whether the cache pre-load is enabled.
             void setPreload(bool);
 
@@ -127,6 +145,12 @@ namespace djv
             //! This signal is emitted when the cache size is changed.
             void cacheSizeGBChanged(float);
 
+            //! This signal is emitted when the compressed cache size is changed.
+            void compressedCacheSizeGBChanged(float);
+
+            //! This signal is emitted when the disk cache size is changed.
+            void diskCacheSizeGBChanged(float);
+
             //! This signal is emitted when the cache pre-load is changed.
             void preloadChanged(bool);
 
@@ -139,6 +163,8 @@ namespace djv
             bool                           _u8Conversion;
             bool                           _cacheEnabled;
             float                          _cacheSizeGB;
+            float                          _compressedCacheSizeGB;
+            float                          _diskCacheSizeGB;
             bool                           _preload;
             bool                           _displayCache;
         };
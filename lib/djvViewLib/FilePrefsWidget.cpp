@@ -56,6 +56,8 @@ namespace djv
             QPointer<QCheckBox>       u8ConversionWidget;
             QPointer<QCheckBox>       cacheWidget;
             QPointer<CacheSizeWidget> cacheSizeWidget;
+            QPointer<CacheSizeWidget> compressedCacheSizeWidget;
+            QPointer<CacheSizeWidget> diskCacheSizeWidget;
             QPointer<QCheckBox>       preloadWidget;
             QPointer<QCheckBox>       displayCacheWidget;
         };
@@ -79,6 +81,10 @@ namespace djv
 
             _p->cacheSizeWidget = new CacheSizeWidget(context.data());
 
+            _p->compressedCacheSizeWidget = new CacheSizeWidget(context.data());
+
+            _p->diskCacheSizeWidget = new CacheSizeWidget(context.data());
+
             _p->preloadWidget = new QCheckBox(
                 qApp->translate("djv::ViewLib::FilePrefsWidget", "Preload cache"));
 
@@ -113,13 +119,21 @@ namespace djv
             prefsGroupBox = new UI::PrefsGroupBox(
                 qApp->translate("djv::ViewLib::FilePrefsWidget", "Memory Cache"),
                 qApp->translate("djv::ViewLib::FilePrefsWidget",
-                    "The memory cache stores images for faster playback performance."),
+                    "The memory cache stores images for faster playback performance. "
+                    "Images that do not fit in the cache can be kept in a compressed cache "
+                    "and in a disk cache on a local drive, a size of zero disables them."),
                 context.data());
             formLayout = prefsGroupBox->createLayout();
             formLayout->addRow(_p->cacheWidget);
             formLayout->addRow(
                 qApp->translate("djv::ViewLib::FilePrefsWidget", "Cache size (gigabytes):"),
                 _p->cacheSizeWidget);
+            formLayout->addRow(
+                qApp->translate("djv::ViewLib::FilePrefsWidget", "Compressed cache size (gigabytes):"),
+                _p->compressedCacheSizeWidget);
+            formLayout->addRow(
+                qApp->translate("djv::ViewLib::FilePrefsWidget", "Disk cache size (gigabytes):"),
+                _p->diskCacheSizeWidget);
             formLayout->addRow(_p->preloadWidget);
             formLayout->addRow(_p->displayCacheWidget);
             layout->addWidget(prefsGroupBox);
@@ -146,6 +160,14 @@ namespace djv
                 _p->cacheSizeWidget,
                 SIGNAL(cacheSizeGBChanged(float)),
                 SLOT(cacheSizeGBCallback(float)));
+            connect(
+                _p->compressedCacheSizeWidget,
+                SIGNAL(cacheSizeGBChanged(float)),
+                SLOT(compressedCacheSizeGBCallback(float)));
+            connect(
+                _p->diskCacheSizeWidget,
+                SIGNAL(cacheSizeGBChanged(float)),
+                SLOT(diskCacheSizeGBCallback(float)));
             connect(
                 _p->preloadWidget,
                 SIGNAL(toggled(bool)),
@@ -169,6 +191,8 @@ namespace djv
             context()->filePrefs()->setU8Conversion(FilePrefs::u8ConversionDefault());
             context()->filePrefs()->setCacheEnabled(FilePrefs::cacheEnabledDefault());
             context()->filePrefs()->setCacheSizeGB(FilePrefs::cacheSizeGBDefault());
+            context()->filePrefs()->setCompressedCacheSizeGB(FilePrefs::compressedCacheSizeGBDefault());
+            context()->filePrefs()->setDiskCacheSizeGB(FilePrefs::diskCacheSizeGBDefault());
             context()->filePrefs()->setPreload(FilePrefs::preloadDefault());
             context()->filePrefs()->setDisplayCache(FilePrefs::displayCacheDefault());
         }
@@ -193,6 +217,16 @@ namespace djv
             context()->filePrefs()->setCacheSizeGB(in);
         }
 
+        void FilePrefsWidget::compressedCacheSizeGBCallback(float in)
+        {
+            context()->filePrefs()->setCompressedCacheSizeGB(in);
+        }
+
+        void FilePrefsWidget::diskCacheSizeGBCallback(float in)
+        {
+            context()->filePrefs()->setDiskCacheSizeGB(in);
+        }
+
         void FilePrefsWidget::preloadCallback(bool in)
         {
             context()->filePrefs()->setPreload(in);
@@ -210,12 +244,16 @@ namespace djv
                 _p->u8ConversionWidget <<
                 _p->cacheWidget <<
                 _p->cacheSizeWidget <<
+                _p->compressedCacheSizeWidget <<
+                _p->diskCacheSizeWidget <<
                 _p->preloadWidget <<
                 _p->displayCacheWidget);
             _p->proxyWidget->setCurrentIndex(context()->filePrefs()->proxy());
             _p->u8ConversionWidget->setChecked(context()->filePrefs()->hasU8Conversion());
             _p->cacheWidget->setChecked(context()->filePrefs()->isCacheEnabled());
             _p->cacheSizeWidget->setCacheSizeGB(context()->filePrefs()->cacheSizeGB());
+            _p->compressedCacheSizeWidget->setCacheSizeGB(context()->filePrefs()->compressedCacheSizeGB());
+            _p->diskCacheSizeWidget->setCacheSizeGB(context()->filePrefs()->diskCacheSizeGB());
             _p->preloadWidget->setChecked(context()->filePrefs()->hasPreload());
             _p->displayCacheWidget->setChecked(context()->filePrefs()->hasDisplayCache());
         }
@@ -55,6 +55,8 @@ namespace djv
             void u8ConversionCallback(bool);
             void cacheEnabledCallback(bool);
             void cacheSizeGBCallback(float);
+            void compressedCacheSizeGBCallback(float);
+            void diskCacheSizeGBCallback(float);
             void preloadCallback(bool);
             void displayCacheCallback(bool);
 
@@ -0,0 +1,260 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvViewLib/FilePreload.h>
+
+#include <djvViewLib/ViewContext.h>
+
+#include <djvAV/CPUImage.h>
+#include <djvAV/Image.h>
+
+#include <djvCore/Error.h>
+#include <djvCore/Timer.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace djv
+{
+    namespace ViewLib
+    {
+        struct FilePreload::Private
+        {
+            QPointer<ViewContext> context;
+            FilePreloadInfo info;
+            std::vector<std::unique_ptr<AV::Load> > loads;
+            std::vector<std::thread> threads;
+
+            mutable std::mutex mutex;
+            std::condition_variable cv;
+            std::deque<qint64> requests;
+            std::set<qint64> inFlight;
+            std::vector<std::pair<qint64, std::shared_ptr<AV::Image> > > frames;
+            float averageSeconds = 0.f;
+            bool stop = false;
+        };
+
+        FilePreload::FilePreload(const QPointer<ViewContext> & context) :
+            _p(new Private)
+        {
+            _p->context = context;
+        }
+
+        FilePreload::~FilePreload()
+        {
+            stop();
+        }
+
+        bool FilePreload::isRunning() const
+        {
+            return _p->threads.size() > 0;
+        }
+
+        void FilePreload::start(const FilePreloadInfo & info)
+        {
+            //DJV_DEBUG("FilePreload::start");
+            //DJV_DEBUG_PRINT("file = " << info.fileInfo);
+            stop();
+            _p->info = info;
+
+            // Movies are read by a single thread since they are decoded
+            // sequentially. The main thread is left free for the user interface.
+            const int count =
+                info.ioInfo.sequence.frames.count() > 1 && info.fileInfo.isSequenceValid() ?
+                std::max(static_cast<int>(std::thread::hardware_concurrency()) - 1, 1) :
+                1;
+            //DJV_DEBUG_PRINT("count = " << count);
+            AV::IOInfo ioInfo;
+            _p->loads.push_back(_p->context->ioFactory()->load(info.fileInfo, ioInfo));
+            for (int i = 1; i < count; ++i)
+            {
+                auto clone = _p->loads[0]->clone();
+                if (!clone)
+                {
+                    clone = _p->context->ioFactory()->load(info.fileInfo, ioInfo);
+                }
+                _p->loads.push_back(std::move(clone));
+            }
+            _p->stop = false;
+            for (int i = 0; i < count; ++i)
+            {
+                _p->threads.push_back(std::thread(&FilePreload::worker, this, i));
+            }
+        }
+
+        void FilePreload::stop()
+        {
+            {
+                std::unique_lock<std::mutex> lock(_p->mutex);
+                _p->stop = true;
+                _p->requests.clear();
+                _p->cv.notify_all();
+            }
+            for (auto & thread : _p->threads)
+            {
+                thread.join();
+            }
+            _p->threads.clear();
+            _p->loads.clear();
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            _p->inFlight.clear();
+            _p->frames.clear();
+        }
+
+        int FilePreload::threadCount() const
+        {
+            return static_cast<int>(_p->threads.size());
+        }
+
+        void FilePreload::request(const std::vector<qint64> & frames)
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            _p->requests.clear();
+            for (const auto frame : frames)
+            {
+                if (_p->inFlight.find(frame) == _p->inFlight.end())
+                {
+                    _p->requests.push_back(frame);
+                }
+            }
+            _p->cv.notify_all();
+        }
+
+        void FilePreload::cancel()
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            _p->requests.clear();
+        }
+
+        bool FilePreload::isPending(qint64 frame) const
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            return
+                _p->inFlight.find(frame) != _p->inFlight.end() ||
+                std::find(_p->requests.begin(), _p->requests.end(), frame) != _p->requests.end();
+        }
+
+        bool FilePreload::hasPending() const
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            return _p->inFlight.size() > 0 || _p->requests.size() > 0 || _p->frames.size() > 0;
+        }
+
+        float FilePreload::averageSeconds() const
+        {
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            return _p->averageSeconds;
+        }
+
+        std::vector<std::pair<qint64, std::shared_ptr<AV::Image> > > FilePreload::takeFrames()
+        {
+            std::vector<std::pair<qint64, std::shared_ptr<AV::Image> > > out;
+            std::unique_lock<std::mutex> lock(_p->mutex);
+            std::swap(out, _p->frames);
+            return out;
+        }
+
+        void FilePreload::worker(int index)
+        {
+            AV::Load * load = _p->loads[index].get();
+            const FilePreloadInfo & info = _p->info;
+            AV::CPUImage cpuImage;
+            cpuImage.setThreadCount(1);
+            while (1)
+            {
+                // Wait for a request.
+                qint64 frame = 0;
+                {
+                    std::unique_lock<std::mutex> lock(_p->mutex);
+                    _p->cv.wait(lock, [this]
+                    {
+                        return _p->stop || _p->requests.size() > 0;
+                    });
+                    if (_p->stop)
+                        break;
+                    frame = _p->requests.front();
+                    _p->requests.pop_front();
+                    _p->inFlight.insert(frame);
+                }
+
+                // Read the frame.
+                Core::Timer timer;
+                timer.start();
+                auto image = std::shared_ptr<AV::Image>(new AV::Image);
+                try
+                {
+                    load->read(
+                        *image,
+                        AV::ImageIOInfo(
+                            info.ioInfo.sequence.frames.count() ?
+                            info.ioInfo.sequence.frames[frame] :
+                            -1,
+                            info.layer,
+                            info.proxy));
+                    if (image->isValid() && info.u8Conversion)
+                    {
+                        AV::PixelDataInfo pixelDataInfo(image->info());
+                        pixelDataInfo.pixel = AV::Pixel::pixel(AV::Pixel::format(pixelDataInfo.pixel), AV::Pixel::U8);
+                        auto tmp = image;
+                        image = std::shared_ptr<AV::Image>(new AV::Image(pixelDataInfo));
+                        image->tags = tmp->tags;
+                        AV::OpenGLImageOptions options;
+                        options.colorProfile = tmp->colorProfile;
+                        options.proxyScale = false;
+                        cpuImage.copy(*tmp, *image, options);
+                    }
+                }
+                catch (const Core::Error &)
+                {}
+                catch (const std::exception &)
+                {
+                    image = std::shared_ptr<AV::Image>(new AV::Image);
+                }
+                timer.check();
+
+                std::unique_lock<std::mutex> lock(_p->mutex);
+                _p->inFlight.erase(frame);
+                if (image->isValid() && !_p->stop)
+                {
+                    _p->frames.push_back(std::make_pair(frame, image));
+                    _p->averageSeconds =
+                        _p->averageSeconds > 0.f ?
+                        (_p->averageSeconds * .9f + timer.seconds() * .1f) :
+                        timer.seconds();
+                }
+            }
+        }
+
+    } // namespace ViewLib
+} // namespace djv
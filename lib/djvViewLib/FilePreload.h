@@ -0,0 +1,125 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <djvViewLib/ViewLib.h>
+
+#include <djvAV/IO.h>
+
+#include <djvCore/FileInfo.h>
+#include <djvCore/Util.h>
+
+#include <QPointer>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        class Image;
+
+    } // namespace AV
+
+    namespace ViewLib
+    {
+        class ViewContext;
+
+        //! This struct provides file pre-load information.
+        struct FilePreloadInfo
+        {
+            Core::FileInfo           fileInfo;
+            AV::IOInfo               ioInfo;
+            int                      layer = 0;
+            AV::PixelDataInfo::PROXY proxy = AV::PixelDataInfo::PROXY_NONE;
+            bool                     u8Conversion = false;
+        };
+
+        //! This class provides a multi-threaded frame pre-loader.
+        //!
+        //! Frames are requested in priority order from the main thread and read
+        //! by a pool of worker threads, each with its own loader. The loaded
+        //! frames are collected on the main thread with takeFrames() so that
+        //! the file cache is only accessed from the main thread.
+        class FilePreload
+        {
+        public:
+            explicit FilePreload(const QPointer<ViewContext> &);
+            ~FilePreload();
+
+            //! Get whether the worker threads are running.
+            bool isRunning() const;
+
+            //! Start the worker threads.
+            //!
+            //! Throws:
+            //! - Core::Error
+            void start(const FilePreloadInfo &);
+
+            //! Stop the worker threads. This waits for any frames that are
+            //! being read and discards the results.
+            void stop();
+
+            //! Get the number of worker threads.
+            int threadCount() const;
+
+            //! Set the frames to load in priority order. This replaces any
+            //! frames that have been requested but not started.
+            void request(const std::vector<qint64> &);
+
+            //! Cancel the frames that have been requested but not started.
+            void cancel();
+
+            //! Get whether a frame has been requested or is being read.
+            bool isPending(qint64) const;
+
+            //! Get whether there are frames that have been requested or are
+            //! being read.
+            bool hasPending() const;
+
+            //! Get the average time in seconds to read a frame.
+            float averageSeconds() const;
+
+            //! Take the frames that have finished loading.
+            std::vector<std::pair<qint64, std::shared_ptr<AV::Image> > > takeFrames();
+
+        private:
+            void worker(int);
+
+            DJV_PRIVATE_COPY(FilePreload);
+
+            struct Private;
+            std::unique_ptr<Private> _p;
+        };
+
+    } // namespace ViewLib
+} // namespace djv
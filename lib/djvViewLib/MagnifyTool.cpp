@@ -231,8 +231,16 @@ namespace djv
             prefs.set("colorProfile", _p->colorProfile);
             prefs.set("displayProfile", _p->displayProfile);
 
-            context()->makeGLContextCurrent();
-            _p->openGLImage.reset();
+            if (_p->openGLImage && context()->hasGLContext())
+            {
+                try
+                {
+                    context()->makeGLContextCurrent();
+                    _p->openGLImage.reset();
+                }
+                catch (const Core::Error &)
+                {}
+            }
         }
 
         void MagnifyTool::showEvent(QShowEvent *)
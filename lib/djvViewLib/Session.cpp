@@ -54,6 +54,7 @@
 #include <djvUI/OpenGLPrefs.h>
 
 #include <djvCore/DebugLog.h>
+#include <djvCore/Math.h>
 
 #include <QApplication>
 #include <QDockWidget>
@@ -363,7 +364,7 @@ namespace djv
             //DJV_DEBUG("Session::reloadFrameCallback");
             const qint64 frame = _p->playbackGroup->frame();
             //DJV_DEBUG_PRINT("frame = " << frame);
-            _p->context->fileCache()->removeItem(FileCacheKey(this, frame));
+            _p->context->fileCache()->removeItem(_p->fileGroup->cacheKey(frame));
         }
 
         void Session::exportSequenceCallback(const Core::FileInfo & in)
@@ -439,23 +440,36 @@ namespace djv
 
             _p->fileGroup->setPreloadFrame(frame);
 
+            // Give the view the next frame if it is already cached, so that it
+            // can be uploaded while the current frame is displayed.
+            std::shared_ptr<AV::Image> nextImage;
+            const Enum::PLAYBACK playback = _p->playbackGroup->playback();
+            const qint64 frameCount = _p->playbackGroup->sequence().frames.count();
+            if (playback != Enum::STOP && frameCount > 1 && !_p->imageGroup->isFrameStoreVisible())
+            {
+                const qint64 nextFrame = Core::Math::wrap<qint64>(
+                    Enum::FORWARD == playback ? frame + 1 : frame - 1,
+                    0,
+                    frameCount - 1);
+                auto cache = _p->context->fileCache();
+                const auto key = _p->fileGroup->cacheKey(nextFrame);
+                if (cache->hasItem(key))
+                {
+                    nextImage = cache->peekItem(key);
+                }
+            }
+            _p->viewWidget->setNextData(nextImage);
+
             Q_EMIT imageChanged(image());
             Q_EMIT imageOptionsChanged(imageOptions());
         }
 
         void Session::playbackUpdate()
         {
-            switch (_p->playbackGroup->playback())
-            {
-            case Enum::FORWARD:
-            case Enum::REVERSE:
-                _p->fileGroup->setPreloadActive(false);
-                break;
-            case Enum::STOP:
-                _p->fileGroup->setPreloadActive(true);
-                break;
-            default: break;
-            }
+            // Frames are pre-loaded in the background so pre-loading stays
+            // active during playback.
+            _p->fileGroup->setPreloadPlayback(_p->playbackGroup->playback());
+            _p->fileGroup->setPreloadActive(true);
         }
 
     } // namespace ViewLib
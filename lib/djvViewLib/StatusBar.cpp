@@ -149,12 +149,6 @@ namespace djv
 
             _p->pick = value;
 
-            _p->context->makeGLContextCurrent();
-            if (!_p->openGLImage)
-            {
-                _p->openGLImage.reset(new AV::OpenGLImage);
-            }
-
             const glm::ivec2 pick = Core::VectorUtil::floor(glm::vec2(_p->pick - _p->viewPos) / _p->viewZoom);
             //DJV_DEBUG_PRINT("pick = " << pick);
 
@@ -163,6 +157,12 @@ namespace djv
             {
                 try
                 {
+                    _p->context->makeGLContextCurrent();
+                    if (!_p->openGLImage)
+                    {
+                        _p->openGLImage.reset(new AV::OpenGLImage);
+                    }
+
                     AV::PixelData tmp(AV::PixelDataInfo(glm::ivec2(1, 1), _p->image->pixel()));
                     AV::OpenGLImageOptions _options = _p->openGLImageOptions;
                     _options.xform.position -= pick;
@@ -0,0 +1,140 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+#include <djvAVBench/Benchmark.h>
+
+#include <djvCore/Error.h>
+#include <djvCore/ErrorUtil.h>
+
+#include <QDateTime>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QSysInfo>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+
+namespace djv
+{
+    namespace AVBench
+    {
+        Benchmark::Benchmark(int iterations, const QString & filter) :
+            _iterations(std::max(iterations, 1)),
+            _filter(filter)
+        {}
+
+        int Benchmark::iterations() const
+        {
+            return _iterations;
+        }
+
+        bool Benchmark::isEnabled(const QString & name) const
+        {
+            return _filter.isEmpty() || name.contains(_filter);
+        }
+
+        void Benchmark::run(
+            const QString &               name,
+            quint64                       byteCount,
+            const std::function<void()> & function)
+        {
+            if (!isEnabled(name))
+                return;
+            Result result;
+            result.name = name;
+            result.byteCount = byteCount;
+            try
+            {
+                function();
+                std::vector<double> times;
+                for (int i = 0; i < _iterations; ++i)
+                {
+                    const auto start = std::chrono::steady_clock::now();
+                    function();
+                    const auto end = std::chrono::steady_clock::now();
+                    times.push_back(std::chrono::duration<double>(end - start).count());
+                }
+                std::sort(times.begin(), times.end());
+                result.min = times.front();
+                result.median = times[times.size() / 2];
+                double sum = 0.0;
+                for (const auto time : times)
+                {
+                    sum += time;
+                }
+                result.mean = sum / times.size();
+            }
+            catch (const Core::Error & error)
+            {
+                result.error = Core::ErrorUtil::format(error).join(" ");
+            }
+            catch (const std::exception & error)
+            {
+                result.error = error.what();
+            }
+            std::cerr << name.toUtf8().data() << ": " << result.median * 1000.0 << "ms" << std::endl;
+            _results.push_back(result);
+        }
+
+        QJsonDocument Benchmark::json() const
+        {
+            QJsonArray results;
+            for (const auto & result : _results)
+            {
+                QJsonObject object;
+                object["name"] = result.name;
+                object["bytes"] = static_cast<double>(result.byteCount);
+                if (result.error.isEmpty())
+                {
+                    object["min"] = result.min;
+                    object["median"] = result.median;
+                    object["mean"] = result.mean;
+                    object["bytesPerSecond"] =
+                        result.median > 0.0 ?
+                        static_cast<double>(result.byteCount) / result.median :
+                        0.0;
+                }
+                else
+                {
+                    object["error"] = result.error;
+                }
+                results.append(object);
+            }
+            QJsonObject out;
+            out["date"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+            out["cpu"] = QSysInfo::currentCpuArchitecture();
+            out["os"] = QSysInfo::prettyProductName();
+            out["iterations"] = _iterations;
+            out["results"] = results;
+            return QJsonDocument(out);
+        }
+
+    } // namespace AVBench
+} // namespace djv
@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <QJsonDocument>
+#include <QString>
+
+#include <functional>
+#include <vector>
+
+namespace djv
+{
+    namespace AVBench
+    {
+        //! This class provides a simple benchmark runner.
+        //!
+        //! Each benchmark is run once to warm up and then timed for a fixed
+        //! number of iterations. The minimum, median, and mean times are
+        //! recorded so that results can be compared between builds.
+        class Benchmark
+        {
+        public:
+            Benchmark(int iterations, const QString & filter = QString());
+
+            //! Get the number of timed iterations.
+            int iterations() const;
+
+            //! Get whether a benchmark name matches the filter.
+            bool isEnabled(const QString & name) const;
+
+            //! Run a benchmark. The byte count is the amount of data that is
+            //! processed by each call, and is used to calculate the throughput.
+            //! Errors thrown by the function are recorded in the results.
+            void run(
+                const QString &                 name,
+                quint64                         byteCount,
+                const std::function<void()> &   function);
+
+            //! Get the results as JSON.
+            QJsonDocument json() const;
+
+        private:
+            struct Result
+            {
+                QString name;
+                quint64 byteCount = 0;
+                double  min       = 0.0;
+                double  median    = 0.0;
+                double  mean      = 0.0;
+                QString error;
+            };
+
+            int                 _iterations = 0;
+            QString             _filter;
+            std::vector<Result> _results;
+        };
+
+    } // namespace AVBench
+} // namespace djv
@@ -0,0 +1,417 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+#include <djvAVBench/Benchmark.h>
+
+#include <djvAV/AudioData.h>
+#include <djvAV/AVContext.h>
+#include <djvAV/IO.h>
+#include <djvAV/Image.h>
+#include <djvAV/OpenGLImage.h>
+#include <djvAV/PixelDataUtil.h>
+
+#include <djvCore/CoreContext.h>
+#include <djvCore/Error.h>
+#include <djvCore/FileInfoUtil.h>
+#include <djvCore/FileIO.h>
+#include <djvCore/Memory.h>
+
+#include <QApplication>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+using namespace djv;
+
+namespace
+{
+    //! Fill pixel data with a gradient.
+    void gradient(AV::PixelData & out)
+    {
+        AV::PixelData tmp(AV::PixelDataInfo(out.size(), AV::Pixel::L_F32));
+        AV::PixelDataUtil::gradient(tmp);
+        AV::OpenGLImage().copy(tmp, out);
+    }
+
+    QString sizeLabel(const glm::ivec2 & size)
+    {
+        return QString("%1x%2").arg(size.x).arg(size.y);
+    }
+
+    void pixelConvert(AVBench::Benchmark & benchmark)
+    {
+        const glm::ivec2 size(512, 512);
+        const int count = size.x * size.y;
+        for (int i = 0; i < AV::Pixel::PIXEL_COUNT; ++i)
+        {
+            const auto inPixel = static_cast<AV::Pixel::PIXEL>(i);
+            AV::PixelData in(AV::PixelDataInfo(size, inPixel));
+            gradient(in);
+            for (int j = 0; j < AV::Pixel::PIXEL_COUNT; ++j)
+            {
+                const auto outPixel = static_cast<AV::Pixel::PIXEL>(j);
+                AV::PixelData out(AV::PixelDataInfo(size, outPixel));
+                benchmark.run(
+                    QString("Pixel::convert/%1/%2/%3").
+                    arg(AV::Pixel::pixelLabels()[i]).
+                    arg(AV::Pixel::pixelLabels()[j]).
+                    arg(sizeLabel(size)),
+                    in.dataByteCount(),
+                    [&in, &out, inPixel, outPixel, count]
+                {
+                    AV::Pixel::convert(in.data(), inPixel, out.data(), outPixel, count);
+                });
+            }
+        }
+    }
+
+    void pixelDataUtil(AVBench::Benchmark & benchmark)
+    {
+        const glm::ivec2 size(1920, 1080);
+        const QVector<AV::Pixel::PIXEL> pixels = QVector<AV::Pixel::PIXEL>() <<
+            AV::Pixel::RGB_U8 <<
+            AV::Pixel::RGBA_U8 <<
+            AV::Pixel::RGB_U16 <<
+            AV::Pixel::RGB_F16 <<
+            AV::Pixel::RGBA_F32;
+        for (const auto pixel : pixels)
+        {
+            AV::PixelData in(AV::PixelDataInfo(size, pixel));
+            gradient(in);
+            for (int i = 1; i < AV::PixelDataInfo::PROXY_COUNT; ++i)
+            {
+                const auto proxy = static_cast<AV::PixelDataInfo::PROXY>(i);
+                AV::PixelData out(AV::PixelDataInfo(
+                    AV::PixelDataUtil::proxyScale(size, proxy),
+                    pixel));
+                benchmark.run(
+                    QString("PixelDataUtil::proxyScale/%1/%2/%3").
+                    arg(AV::Pixel::pixelLabels()[pixel]).
+                    arg(AV::PixelDataInfo::proxyLabels()[proxy]).
+                    arg(sizeLabel(size)),
+                    in.dataByteCount(),
+                    [&in, &out, proxy]
+                {
+                    AV::PixelDataUtil::proxyScale(in, out, proxy);
+                });
+            }
+            AV::PixelData out(in.info());
+            benchmark.run(
+                QString("PixelDataUtil::planarInterleave/%1/%2").
+                arg(AV::Pixel::pixelLabels()[pixel]).
+                arg(sizeLabel(size)),
+                in.dataByteCount(),
+                [&in, &out]
+            {
+                AV::PixelDataUtil::planarInterleave(in, out);
+            });
+            benchmark.run(
+                QString("PixelDataUtil::planarDeinterleave/%1/%2").
+                arg(AV::Pixel::pixelLabels()[pixel]).
+                arg(sizeLabel(size)),
+                in.dataByteCount(),
+                [&in, &out]
+            {
+                AV::PixelDataUtil::planarDeinterleave(in, out);
+            });
+        }
+    }
+
+    void memoryEndian(AVBench::Benchmark & benchmark)
+    {
+        const quint64 size = 64 * Core::Memory::megabyte;
+        std::vector<quint8> in(size);
+        std::vector<quint8> out(size);
+        for (quint64 i = 0; i < size; ++i)
+        {
+            in[i] = static_cast<quint8>(i);
+        }
+        for (const int wordSize : { 2, 4, 8 })
+        {
+            benchmark.run(
+                QString("Memory::convertEndian/%1").arg(wordSize),
+                size,
+                [&in, &out, size, wordSize]
+            {
+                Core::Memory::convertEndian(in.data(), out.data(), size / wordSize, wordSize);
+            });
+            benchmark.run(
+                QString("Memory::convertEndian/%1/inPlace").arg(wordSize),
+                size,
+                [&out, size, wordSize]
+            {
+                Core::Memory::convertEndian(out.data(), size / wordSize, wordSize);
+            });
+        }
+    }
+
+    void io(AVBench::Benchmark & benchmark, AV::AVContext & context, const QString & path)
+    {
+        const QVector<glm::ivec2> sizes = QVector<glm::ivec2>() <<
+            glm::ivec2(256, 256) <<
+            glm::ivec2(1920, 1080) <<
+            glm::ivec2(4096, 2160);
+        const QVector<AV::Pixel::PIXEL> pixels = QVector<AV::Pixel::PIXEL>() <<
+            AV::Pixel::RGB_U8 <<
+            AV::Pixel::RGBA_F16;
+        for (auto plugin : context.ioFactory()->plugins())
+        {
+            auto ioPlugin = static_cast<AV::IOPlugin *>(plugin);
+            const QStringList & extensions = ioPlugin->extensions();
+            if (!extensions.count() || "FFmpeg" == ioPlugin->pluginName())
+                continue;
+            const QString fileName = path + "/bench" + extensions[0];
+            for (const auto & size : sizes)
+            {
+                for (const auto pixel : pixels)
+                {
+                    const QString name = QString("%1/%2/%3").
+                        arg(ioPlugin->pluginName()).
+                        arg(AV::Pixel::pixelLabels()[pixel]).
+                        arg(sizeLabel(size));
+                    if (!benchmark.isEnabled("IO::save/" + name) &&
+                        !benchmark.isEnabled("IO::load/" + name))
+                        continue;
+                    AV::Image image(AV::PixelDataInfo(size, pixel));
+                    gradient(image);
+                    benchmark.run(
+                        "IO::save/" + name,
+                        image.dataByteCount(),
+                        [ioPlugin, &fileName, &image]
+                    {
+                        if (auto save = ioPlugin->createSave(fileName, AV::IOInfo(image.info())))
+                        {
+                            save->write(image);
+                            save->close();
+                        }
+                    });
+                    if (!QFile::exists(fileName))
+                        continue;
+                    AV::Image tmp;
+                    benchmark.run(
+                        "IO::load/" + name,
+                        image.dataByteCount(),
+                        [ioPlugin, &fileName, &tmp]
+                    {
+                        if (auto load = ioPlugin->createLoad(fileName))
+                        {
+                            load->read(tmp);
+                        }
+                    });
+                    QFile::remove(fileName);
+                }
+            }
+        }
+    }
+
+    void touch(const QString & fileName)
+    {
+        Core::FileIO io;
+        io.open(fileName, Core::FileIO::WRITE);
+    }
+
+    void fileInfoList(AVBench::Benchmark & benchmark, const QString & path)
+    {
+        struct Directory
+        {
+            QString name;
+            int     sequences;
+            int     frames;
+        };
+        const QVector<Directory> directories = QVector<Directory>() <<
+            Directory{ "files", 10000, 1 } <<
+            Directory{ "sequence", 1, 10000 } <<
+            Directory{ "sequences", 1000, 10 };
+        for (const auto & directory : directories)
+        {
+            const QString name = QString("FileInfoUtil::list/%1").arg(directory.name);
+            if (!benchmark.isEnabled(name))
+                continue;
+
+            // Create the files in a shuffled order so that the directory order
+            // does not match the sequence order.
+            const QString dirPath = path + "/" + directory.name + "/";
+            QDir().mkpath(dirPath);
+            std::vector<QString> fileNames;
+            for (int i = 0; i < directory.sequences; ++i)
+            {
+                for (int j = 0; j < directory.frames; ++j)
+                {
+                    fileNames.push_back(directory.frames > 1 ?
+                        QString("%1render%2.%3.exr").arg(dirPath).arg(i).arg(j, 4, 10, QChar('0')) :
+                        QString("%1file%2.txt").arg(dirPath).arg(i));
+                }
+            }
+            std::shuffle(fileNames.begin(), fileNames.end(), std::mt19937(0));
+            for (const auto & fileName : fileNames)
+            {
+                touch(fileName);
+            }
+
+            benchmark.run(
+                name,
+                0,
+                [dirPath]
+            {
+                Core::FileInfoUtil::list(dirPath, Core::Sequence::FORMAT_RANGE, false);
+            });
+            benchmark.run(
+                name + "/stat",
+                0,
+                [dirPath]
+            {
+                Core::FileInfoUtil::list(dirPath, Core::Sequence::FORMAT_RANGE, true);
+            });
+        }
+    }
+
+    void audioConvert(AVBench::Benchmark & benchmark)
+    {
+        const AV::AudioInfo info(2, AV::Audio::F32, 48000, 48000 * 10);
+        for (int i = 1; i < AV::Audio::TYPE_COUNT; ++i)
+        {
+            const auto inType = static_cast<AV::Audio::TYPE>(i);
+            AV::AudioData in(AV::AudioInfo(info.channels, inType, info.sampleRate, info.sampleCount));
+            in.zero();
+            for (int j = 1; j < AV::Audio::TYPE_COUNT; ++j)
+            {
+                const auto outType = static_cast<AV::Audio::TYPE>(j);
+                benchmark.run(
+                    QString("AudioData::convert/%1/%2").
+                    arg(AV::Audio::typeLabels()[i]).
+                    arg(AV::Audio::typeLabels()[j]),
+                    in.byteCount(),
+                    [&in, outType]
+                {
+                    AV::AudioData::convert(in, outType);
+                });
+            }
+        }
+    }
+
+    void printUsage()
+    {
+        std::cout <<
+            "djvAVBench [-iterations value] [-filter value] [-output file]\n"
+            "\n"
+            "    -iterations value  Number of timed iterations for each benchmark (default 10).\n"
+            "    -filter value      Only run benchmarks with names containing this value.\n"
+            "    -output file       Write the JSON results to a file instead of stdout.\n";
+    }
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    int r = 1;
+    try
+    {
+        Core::CoreContext::initLibPaths(argc, argv);
+        QApplication app(argc, argv);
+
+        int iterations = 10;
+        QString filter;
+        QString output;
+        QStringList args = app.arguments();
+        args.pop_front();
+        while (args.count())
+        {
+            const QString arg = args.takeFirst();
+            if ("-iterations" == arg && args.count())
+            {
+                iterations = args.takeFirst().toInt();
+            }
+            else if ("-filter" == arg && args.count())
+            {
+                filter = args.takeFirst();
+            }
+            else if ("-output" == arg && args.count())
+            {
+                output = args.takeFirst();
+            }
+            else
+            {
+                printUsage();
+                return 1;
+            }
+        }
+
+        AV::AVContext context(argc, argv);
+        QTemporaryDir tmpDir;
+        if (!tmpDir.isValid())
+        {
+            throw Core::Error(
+                "djvAVBench",
+                QString("Cannot create temporary directory"));
+        }
+
+        AVBench::Benchmark benchmark(iterations, filter);
+        pixelConvert(benchmark);
+        pixelDataUtil(benchmark);
+        memoryEndian(benchmark);
+        io(benchmark, context, tmpDir.path());
+        fileInfoList(benchmark, tmpDir.path());
+        audioConvert(benchmark);
+
+        const QByteArray json = benchmark.json().toJson();
+        if (output.isEmpty())
+        {
+            std::cout << json.data();
+        }
+        else
+        {
+            QFile file(output);
+            if (!file.open(QIODevice::WriteOnly))
+            {
+                throw Core::Error(
+                    "djvAVBench",
+                    QString("Cannot open: \"%1\"").arg(output));
+            }
+            file.write(json);
+        }
+        r = 0;
+    }
+    catch (const Core::Error & error)
+    {
+        Q_FOREACH(const Core::Error::Message & message, error.messages())
+        {
+            std::cout << "ERROR " <<
+                message.prefix.toUtf8().data() << ": " <<
+                message.string.toUtf8().data() << std::endl;
+        }
+    }
+    catch (const std::exception & error)
+    {
+        std::cout << "ERROR: " << error.what() << std::endl;
+    }
+    return r;
+}
@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvAVTest/CPUImageTest.h>
+
+#include <djvAV/CPUImage.h>
+#include <djvAV/PixelDataUtil.h>
+
+#include <djvCore/Assert.h>
+#include <djvCore/Debug.h>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        void CPUImageTest::run(int & argc, char ** argv)
+        {
+            DJV_DEBUG("CPUImageTest::run");
+            members();
+            copy();
+            average();
+            histogram();
+        }
+
+        void CPUImageTest::members()
+        {
+            DJV_DEBUG("CPUImageTest::members");
+            {
+                AV::CPUImage image;
+                DJV_ASSERT(0 == image.threadCount());
+                image.setThreadCount(2);
+                DJV_ASSERT(2 == image.threadCount());
+            }
+            {
+                const AV::OpenGLImageBackend::BACKEND backend = AV::OpenGLImageBackend::backend();
+                AV::OpenGLImageBackend::setBackend(AV::OpenGLImageBackend::CPU);
+                DJV_ASSERT(AV::OpenGLImageBackend::CPU == AV::OpenGLImageBackend::backend());
+                AV::OpenGLImageBackend::setBackend(backend);
+            }
+        }
+
+        void CPUImageTest::copy()
+        {
+            DJV_DEBUG("CPUImageTest::copy");
+            for (int i = 0; i < AV::Pixel::PIXEL_COUNT; ++i)
+            {
+                const AV::Pixel::PIXEL pixel = static_cast<AV::Pixel::PIXEL>(i);
+                DJV_DEBUG_PRINT("pixel = " << pixel);
+                AV::PixelData a;
+                AV::PixelDataUtil::gradient(a);
+                AV::PixelData b(AV::PixelDataInfo(a.size(), pixel));
+                AV::CPUImage().copy(a, b);
+                DJV_DEBUG_PRINT("b = " << b);
+            }
+            {
+                AV::PixelData a;
+                AV::PixelDataUtil::gradient(a);
+                AV::PixelData b(a.info());
+                AV::CPUImage().copy(a, b);
+                DJV_ASSERT(a == b);
+            }
+            {
+                AV::PixelData a(AV::PixelDataInfo(64, 64, AV::Pixel::RGBA_U8));
+                a.zero();
+                AV::PixelData b(AV::PixelDataInfo(64, 64, AV::Pixel::RGBA_U8));
+                AV::CPUImage image;
+                image.setThreadCount(4);
+                image.copy(a, b);
+                DJV_ASSERT(a == b);
+            }
+            {
+                AV::PixelData a;
+                AV::PixelDataUtil::gradient(a);
+                AV::PixelData b(AV::PixelDataInfo(a.w() / 2, a.h() / 2, a.pixel()));
+                AV::OpenGLImageOptions options;
+                options.xform.scale = glm::vec2(.5f, .5f);
+                for (int i = 0; i < AV::OpenGLImageFilter::FILTER_COUNT; ++i)
+                {
+                    const AV::OpenGLImageFilter::FILTER filter = static_cast<AV::OpenGLImageFilter::FILTER>(i);
+                    DJV_DEBUG_PRINT("filter = " << filter);
+                    options.filter = AV::OpenGLImageFilter(filter, filter);
+                    AV::CPUImage().copy(a, b, options);
+                }
+            }
+        }
+
+        void CPUImageTest::average()
+        {
+            DJV_DEBUG("CPUImageTest::average");
+            for (int i = 0; i < AV::Pixel::PIXEL_COUNT; ++i)
+            {
+                const AV::Pixel::PIXEL pixel = static_cast<AV::Pixel::PIXEL>(i);
+                AV::PixelData data(AV::PixelDataInfo(32, 32, pixel));
+                data.zero();
+                AV::Color color;
+                AV::CPUImage().average(data, color);
+                DJV_DEBUG_PRINT("average = " << color);
+                DJV_ASSERT(AV::Color(pixel) == color);
+            }
+        }
+
+        void CPUImageTest::histogram()
+        {
+            DJV_DEBUG("CPUImageTest::histogram");
+            for (int i = 0; i < AV::Pixel::PIXEL_COUNT; ++i)
+            {
+                const AV::Pixel::PIXEL pixel = static_cast<AV::Pixel::PIXEL>(i);
+                AV::PixelData data(AV::PixelDataInfo(32, 32, pixel));
+                data.zero();
+                AV::PixelData histogram;
+                AV::Color min, max;
+                AV::CPUImage().histogram(data, histogram, 256, min, max);
+                DJV_DEBUG_PRINT("min = " << min);
+                DJV_DEBUG_PRINT("max = " << max);
+                DJV_ASSERT(256 == histogram.w());
+                DJV_ASSERT(1024 == reinterpret_cast<const AV::Pixel::U16_T *>(histogram.data())[0]);
+                DJV_ASSERT(AV::Color(pixel) == min);
+                DJV_ASSERT(AV::Color(pixel) == max);
+            }
+        }
+
+    } // namespace AVTest
+} // namespace djv
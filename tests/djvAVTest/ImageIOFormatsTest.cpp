@@ -46,6 +46,8 @@
 
 #include <algorithm>
 
+#include <string.h>
+
 using namespace djv::Core;
 using namespace djv::AV;
 
@@ -243,6 +245,36 @@ namespace djv
                         DJV_ASSERT(a == b);
                     }
                 }
+
+                // Proxy reads should match the proxy scale of the full image.
+                for (int i = 1; i < AV::PixelDataInfo::PROXY_COUNT; ++i)
+                {
+                    const auto proxy = static_cast<AV::PixelDataInfo::PROXY>(i);
+                    AV::Image proxyImage;
+                    load->read(proxyImage, AV::ImageIOInfo(-1, 0, proxy));
+                    AV::PixelDataInfo proxyInfo = tmp.info();
+                    proxyInfo.size = AV::PixelDataUtil::proxyScale(tmp.size(), proxy);
+                    AV::PixelData proxyData(proxyInfo);
+                    AV::PixelDataUtil::proxyScale(tmp, proxyData, proxy);
+                    DJV_ASSERT(proxyImage.size() == proxyData.size());
+                    if (proxyImage.pixel() == proxyData.pixel() &&
+                        proxyImage.info().endian == proxyData.info().endian &&
+                        proxyImage.info().bgr == proxyData.info().bgr)
+                    {
+                        for (int y = 0; y < proxyData.h(); ++y)
+                        {
+                            DJV_ASSERT(0 == memcmp(
+                                proxyImage.data(0, y),
+                                proxyData.data(0, y),
+                                proxyData.w() * proxyData.pixelByteCount()));
+                        }
+                    }
+                }
+
+                if (plugin->canReadRegion())
+                {
+                    runRegionTest(*load, tmp);
+                }
             }
             catch (const Error & error)
             {
@@ -278,5 +310,50 @@ namespace djv
             }
         }
 
+        void ImageIOFormatsTest::runRegionTest(AV::Load & load, const AV::Image & image)
+        {
+            DJV_DEBUG("ImageIOFormatsTest::runRegionTest");
+            DJV_DEBUG_PRINT("image = " << image);
+
+            // Region reads should match a crop of the full image. The regions
+            // include the first and last rows and columns, which are at the
+            // top or the bottom of the file depending on its orientation.
+            const int w = image.w();
+            const int h = image.h();
+            QVector<Box2i> regions = QVector<Box2i>() <<
+                Box2i(0, 0, w, 1) <<
+                Box2i(0, h - 1, w, 1) <<
+                Box2i(0, 0, 1, h) <<
+                Box2i(w - 1, 0, 1, h) <<
+                Box2i(w / 2, h / 2, w - w / 2, h - h / 2) <<
+                Box2i(0, 0, w, h);
+            if (w > 2 && h > 2)
+            {
+                regions += Box2i(1, 1, w - 2, h - 2);
+            }
+            Q_FOREACH(const Box2i & region, regions)
+            {
+                DJV_DEBUG_PRINT("region = " << region);
+                AV::ImageIOInfo frame;
+                frame.region = region;
+                AV::Image regionImage;
+                load.read(regionImage, frame);
+                AV::PixelData regionData;
+                AV::PixelDataUtil::crop(image, regionData, region);
+                DJV_ASSERT(regionImage.size() == regionData.size());
+                DJV_ASSERT(regionImage.pixel() == regionData.pixel());
+                DJV_ASSERT(regionImage.info().mirror == regionData.info().mirror);
+                DJV_ASSERT(regionImage.info().endian == regionData.info().endian);
+                DJV_ASSERT(regionImage.info().bgr == regionData.info().bgr);
+                for (int y = 0; y < regionData.h(); ++y)
+                {
+                    DJV_ASSERT(0 == memcmp(
+                        regionImage.data(0, y),
+                        regionData.data(0, y),
+                        regionData.w() * regionData.pixelByteCount()));
+                }
+            }
+        }
+
     } // namespace AVTest
 } // namespace djv
@@ -54,6 +54,7 @@ namespace djv
             void initData();
             void initImages();
             void runTest(AV::IOPlugin *, const AV::Image &);
+            void runRegionTest(AV::Load &, const AV::Image &);
 
             QVector<glm::ivec2>       _sizes;
             QVector<AV::Pixel::PIXEL> _pixels;
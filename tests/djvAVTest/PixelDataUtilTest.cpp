@@ -51,6 +51,7 @@ namespace djv
             DJV_DEBUG("PixelDataUtilTest::run");
             byteCount();
             proxy();
+            crop();
             interleave();
             gradient();
         }
@@ -114,6 +115,46 @@ namespace djv
             }
         }
 
+        void PixelDataUtilTest::crop()
+        {
+            DJV_DEBUG("PixelDataUtilTest::crop");
+            AV::PixelData data(AV::PixelDataInfo(4, 4, AV::Pixel::L_U8));
+            for (int y = 0; y < 4; ++y)
+            {
+                for (int x = 0; x < 4; ++x)
+                {
+                    *data.data(x, y) = y * 4 + x;
+                }
+            }
+            AV::PixelData cropData;
+            AV::PixelDataUtil::crop(data, cropData, Box2i(1, 2, 2, 2));
+            DJV_DEBUG_PRINT("info = " << cropData.info());
+            DJV_ASSERT(glm::ivec2(2, 2) == cropData.size());
+            DJV_ASSERT(data.pixel() == cropData.pixel());
+            DJV_ASSERT(9 == *cropData.data(0, 0));
+            DJV_ASSERT(10 == *cropData.data(1, 0));
+            DJV_ASSERT(13 == *cropData.data(0, 1));
+            DJV_ASSERT(14 == *cropData.data(1, 1));
+            {
+                const Box2i box(1, 0, 2, 1);
+                DJV_ASSERT(box == AV::PixelDataUtil::mirror(box, data.size(), AV::PixelDataInfo::Mirror()));
+                DJV_ASSERT(Box2i(1, 3, 2, 1) == AV::PixelDataUtil::mirror(box, data.size(), AV::PixelDataInfo::Mirror(false, true)));
+                DJV_ASSERT(Box2i(1, 0, 2, 1) == AV::PixelDataUtil::mirror(Box2i(1, 0, 2, 1), data.size(), AV::PixelDataInfo::Mirror(true, false)));
+                DJV_ASSERT(Box2i(0, 3, 1, 1) == AV::PixelDataUtil::mirror(Box2i(3, 0, 1, 1), data.size(), AV::PixelDataInfo::Mirror(true, true)));
+            }
+            {
+                // Cropping the top row of an image that is displayed mirrored
+                // reads the bottom row of the pixel data.
+                AV::PixelData mirrorData;
+                AV::PixelDataUtil::crop(
+                    data,
+                    mirrorData,
+                    AV::PixelDataUtil::mirror(Box2i(0, 0, 4, 1), data.size(), AV::PixelDataInfo::Mirror(false, true)));
+                DJV_ASSERT(12 == *mirrorData.data(0, 0));
+                DJV_ASSERT(15 == *mirrorData.data(3, 0));
+            }
+        }
+
         void PixelDataUtilTest::interleave()
         {
             DJV_DEBUG("PixelDataUtilTest::interleave");
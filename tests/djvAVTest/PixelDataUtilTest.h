@@ -43,6 +43,7 @@ namespace djv
         private:
             void byteCount();
             void proxy();
+            void crop();
             void interleave();
             void gradient();
             void qt();
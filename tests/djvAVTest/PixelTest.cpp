@@ -38,6 +38,8 @@
 
 #include <QStringList>
 
+#include <vector>
+
 using namespace djv::Core;
 using namespace djv::AV;
 
@@ -51,6 +53,7 @@ namespace djv
             mask();
             members();
             convert();
+            simd();
             operators();
         }
 
@@ -379,6 +382,47 @@ namespace djv
             }
         }
 
+        void PixelTest::simd()
+        {
+            DJV_DEBUG("PixelTest::simd");
+            const bool simd = AV::Pixel::simd();
+            const int sizes[] = { 1, 4, 5, 17, 1024 };
+            for (int i = 0; i < AV::Pixel::PIXEL_COUNT; ++i)
+            {
+                for (int j = 0; j < AV::Pixel::PIXEL_COUNT; ++j)
+                {
+                    const AV::Pixel::PIXEL inPixel = static_cast<AV::Pixel::PIXEL>(i);
+                    const AV::Pixel::PIXEL outPixel = static_cast<AV::Pixel::PIXEL>(j);
+                    for (const auto size : sizes)
+                    {
+                        for (int bgr = 0; bgr < 2; ++bgr)
+                        {
+                            // Generate the input from integer data so that the
+                            // floating point values are valid.
+                            const AV::Pixel::PIXEL u16Pixel =
+                                AV::Pixel::pixel(AV::Pixel::format(inPixel), AV::Pixel::U16);
+                            std::vector<quint16> u16(size * AV::Pixel::channels(u16Pixel));
+                            for (size_t k = 0; k < u16.size(); ++k)
+                            {
+                                u16[k] = static_cast<quint16>(k * 4099 + i * 11);
+                            }
+                            std::vector<quint8> in(size * AV::Pixel::byteCount(inPixel));
+                            AV::Pixel::convert(u16.data(), u16Pixel, in.data(), inPixel, size);
+                            const int outByteCount = size * AV::Pixel::byteCount(outPixel);
+                            std::vector<quint8> a(outByteCount);
+                            std::vector<quint8> b(outByteCount);
+                            AV::Pixel::setSIMD(false);
+                            AV::Pixel::convert(in.data(), inPixel, a.data(), outPixel, size, 1, bgr);
+                            AV::Pixel::setSIMD(true);
+                            AV::Pixel::convert(in.data(), inPixel, b.data(), outPixel, size, 1, bgr);
+                            DJV_ASSERT(a == b);
+                        }
+                    }
+                }
+            }
+            AV::Pixel::setSIMD(simd);
+        }
+
         void PixelTest::operators()
         {
             DJV_DEBUG("PixelTest::operators");
@@ -57,6 +57,7 @@ namespace djv
             split();
             exists();
             list();
+            stat();
             match();
             sequence();
             expand();
@@ -168,6 +169,63 @@ namespace djv
             DJV_ASSERT(list.indexOf(FileInfo(fileName.arg("1,3"))));
             list = FileInfoUtil::list(".", Sequence::FORMAT_RANGE);
             DJV_ASSERT(list.indexOf(FileInfo(fileName.arg("1-3"))));
+            list = FileInfoUtil::list(".", Sequence::FORMAT_SPARSE, false);
+            for (const auto & fileInfo : list)
+            {
+                if (fileInfo.base() == "FileInfoUtilTest." && fileInfo.extension() == ".test")
+                {
+                    DJV_ASSERT(FileInfo::SEQUENCE == fileInfo.type());
+                    DJV_ASSERT(2 == fileInfo.sequence().frames.count());
+                    FileInfo tmp = fileInfo;
+                    DJV_ASSERT(tmp.stat());
+                    DJV_ASSERT(FileInfo::SEQUENCE == tmp.type());
+                }
+            }
+        }
+
+        void FileInfoUtilTest::stat()
+        {
+            DJV_DEBUG("FileInfoUtilTest::stat");
+            const FileInfoList list = FileInfoUtil::list(".", Sequence::FORMAT_SPARSE, false);
+            {
+                FileInfoList tmp = list;
+                int end = 0;
+                FileInfoUtil::stat(tmp, [&end](int begin, int _end)
+                {
+                    DJV_ASSERT(begin == end);
+                    DJV_ASSERT(_end > begin);
+                    end = _end;
+                    return true;
+                });
+                DJV_ASSERT(end == tmp.count());
+                for (int i = 0; i < tmp.count(); ++i)
+                {
+                    FileInfo fileInfo = list[i];
+                    fileInfo.stat();
+                    DJV_ASSERT(fileInfo.type() == tmp[i].type());
+                    DJV_ASSERT(fileInfo.exists() == tmp[i].exists());
+                    DJV_ASSERT(fileInfo.size() == tmp[i].size());
+                    DJV_ASSERT(fileInfo.user() == tmp[i].user());
+                    DJV_ASSERT(fileInfo.permissions() == tmp[i].permissions());
+                    DJV_ASSERT(fileInfo.time() == tmp[i].time());
+                }
+            }
+            {
+                FileInfoList tmp = list;
+                int calls = 0;
+                FileInfoUtil::stat(tmp, [&calls](int, int)
+                {
+                    ++calls;
+                    return false;
+                });
+                DJV_ASSERT(calls <= 1);
+            }
+            {
+                FileInfoList tmp;
+                tmp.append(FileInfo("FileInfoUtilTest.missing", false));
+                FileInfoUtil::stat(tmp);
+                DJV_ASSERT(!tmp[0].exists());
+            }
         }
 
         void FileInfoUtilTest::match()
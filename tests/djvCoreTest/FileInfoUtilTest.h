@@ -44,6 +44,7 @@ namespace djv
             void split();
             void exists();
             void list();
+            void stat();
             void match();
             void sequence();
             void expand();
@@ -0,0 +1,167 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+#include <djvCoreTest/FrameListTest.h>
+
+#include <djvCore/Assert.h>
+#include <djvCore/Debug.h>
+#include <djvCore/FrameList.h>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace CoreTest
+    {
+        void FrameListTest::run(int &, char **)
+        {
+            DJV_DEBUG("FrameListTest::run");
+            ctors();
+            runs();
+            members();
+            sort();
+            operators();
+        }
+
+        void FrameListTest::ctors()
+        {
+            DJV_DEBUG("FrameListTest::ctors");
+            {
+                const FrameList list;
+                DJV_ASSERT(list.isEmpty());
+                DJV_ASSERT(list.isSorted());
+            }
+            {
+                const FrameList list(1, 3);
+                DJV_ASSERT(3 == list.count());
+                DJV_ASSERT(1 == list[0] && 2 == list[1] && 3 == list[2]);
+                DJV_ASSERT(list.isSorted());
+            }
+            {
+                const FrameList list(3, 1);
+                DJV_ASSERT(3 == list.count());
+                DJV_ASSERT(3 == list[0] && 2 == list[1] && 1 == list[2]);
+                DJV_ASSERT(!list.isSorted());
+            }
+            {
+                const QVector<qint64> vector = QVector<qint64>() << 1 << 2 << 3 << 5 << 4;
+                const FrameList list(vector);
+                DJV_ASSERT(vector == list.toVector());
+            }
+        }
+
+        void FrameListTest::runs()
+        {
+            DJV_DEBUG("FrameListTest::runs");
+            {
+                const FrameList list = FrameList() << 1 << 2 << 3 << 10 << 11;
+                DJV_ASSERT(2 == list.runs().size());
+                DJV_ASSERT(1 == list.runs()[0].start && 3 == list.runs()[0].count);
+                DJV_ASSERT(10 == list.runs()[1].start && 2 == list.runs()[1].count);
+            }
+            {
+                const FrameList list = FrameList() << 1 << 2 << 1;
+                DJV_ASSERT(2 == list.runs().size());
+                DJV_ASSERT(1 == list.runs()[1].start && 1 == list.runs()[1].count);
+            }
+            {
+                const FrameList list = FrameList(0, 999999);
+                DJV_ASSERT(1 == list.runs().size());
+                DJV_ASSERT(1000000 == list.count());
+                DJV_ASSERT(500000 == list[500000]);
+                DJV_ASSERT(123456 == list.indexOf(123456));
+            }
+        }
+
+        void FrameListTest::members()
+        {
+            DJV_DEBUG("FrameListTest::members");
+            {
+                const FrameList list = FrameList() << 1 << 2 << 3 << 10 << 11;
+                DJV_ASSERT(1 == list.first());
+                DJV_ASSERT(11 == list.last());
+                DJV_ASSERT(3 == list.indexOf(10));
+                DJV_ASSERT(-1 == list.indexOf(5));
+                DJV_ASSERT(list.contains(11));
+                DJV_ASSERT((FrameList() << 3 << 10) == list.mid(2, 2));
+                DJV_ASSERT((FrameList() << 10 << 11) == list.mid(3));
+            }
+            {
+                const FrameList list = FrameList() << 5 << 1 << 5;
+                DJV_ASSERT(0 == list.indexOf(5));
+                DJV_ASSERT(1 == list.indexOf(1));
+            }
+            {
+                FrameList list(1, 3);
+                list.pop_front();
+                DJV_ASSERT((FrameList() << 2 << 3) == list);
+                list.clear();
+                DJV_ASSERT(list.isEmpty());
+            }
+            {
+                QVector<qint64> vector;
+                const FrameList list = FrameList() << 1 << 2 << 4;
+                for (auto i : list)
+                {
+                    vector += i;
+                }
+                DJV_ASSERT(vector == list.toVector());
+            }
+        }
+
+        void FrameListTest::sort()
+        {
+            DJV_DEBUG("FrameListTest::sort");
+            {
+                FrameList list = FrameList() << 10 << 11 << 1 << 2 << 3;
+                list.sort();
+                DJV_ASSERT((FrameList(1, 3) << 10 << 11) == list);
+                DJV_ASSERT(list.isSorted());
+            }
+            {
+                FrameList list = FrameList(3, 1) << 2 << 7;
+                list.sort();
+                DJV_ASSERT((FrameList() << 1 << 2 << 2 << 3 << 7) == list);
+            }
+        }
+
+        void FrameListTest::operators()
+        {
+            DJV_DEBUG("FrameListTest::operators");
+            {
+                FrameList list(1, 2);
+                list += 3;
+                list += FrameList(4, 5);
+                DJV_ASSERT(FrameList(1, 5) == list);
+                DJV_ASSERT(1 == list.runs().size());
+                DJV_ASSERT(FrameList(1, 4) != list);
+            }
+        }
+
+    } // namespace CoreTest
+} // namespace djv
@@ -0,0 +1,111 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvCoreTest/MemoryPoolTest.h>
+
+#include <djvCore/Assert.h>
+#include <djvCore/Debug.h>
+#include <djvCore/Memory.h>
+#include <djvCore/MemoryPool.h>
+
+#include <string.h>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace CoreTest
+    {
+        void MemoryPoolTest::run(int &, char **)
+        {
+            DJV_DEBUG("MemoryPoolTest::run");
+            sizeClass();
+            members();
+        }
+
+        void MemoryPoolTest::sizeClass()
+        {
+            DJV_DEBUG("MemoryPoolTest::sizeClass");
+            const quint64 data[] =
+            {
+                1, 63, 64, 65, 4096, 4097, 1000000, 1920 * 1080 * 3 * 2
+            };
+            for (size_t i = 0; i < sizeof(data) / sizeof(data[0]); ++i)
+            {
+                const quint64 size = MemoryPool::sizeClass(data[i]);
+                DJV_DEBUG_PRINT(data[i] << " = " << size);
+                DJV_ASSERT(size >= data[i]);
+                DJV_ASSERT(0 == size % MemoryPool::alignment);
+                DJV_ASSERT(size - data[i] <= data[i] / 8 + MemoryPool::alignment);
+            }
+            DJV_ASSERT(MemoryPool::sizeClass(1000000) == MemoryPool::sizeClass(1000001));
+        }
+
+        void MemoryPoolTest::members()
+        {
+            DJV_DEBUG("MemoryPoolTest::members");
+            MemoryPool::clear();
+            {
+                const MemoryPoolStats stats = MemoryPool::stats();
+                quint8 * p = MemoryPool::allocate(1000);
+                DJV_ASSERT(p);
+                DJV_ASSERT(0 == reinterpret_cast<quintptr>(p) % MemoryPool::alignment);
+                memset(p, 0, 1000);
+                DJV_ASSERT(MemoryPool::stats().allocCount == stats.allocCount + 1);
+                MemoryPool::release(p, 1000);
+                DJV_ASSERT(MemoryPool::stats().releaseCount == stats.releaseCount + 1);
+                DJV_ASSERT(MemoryPool::stats().pooledBytes == MemoryPool::sizeClass(1000));
+                quint8 * p2 = MemoryPool::allocate(1001);
+                DJV_ASSERT(p2 == p);
+                DJV_ASSERT(MemoryPool::stats().reuseCount == stats.reuseCount + 1);
+                DJV_ASSERT(0 == MemoryPool::stats().pooledBytes);
+                MemoryPool::release(p2, 1001);
+                MemoryPool::clear();
+                DJV_ASSERT(0 == MemoryPool::stats().pooledBytes);
+                DJV_ASSERT(MemoryPool::stats().usedBytes == stats.usedBytes);
+            }
+            {
+                const quint64 maxPooledBytes = MemoryPool::maxPooledBytes();
+                MemoryPool::setMaxPooledBytes(0);
+                DJV_ASSERT(0 == MemoryPool::maxPooledBytes());
+                quint8 * p = MemoryPool::allocate(4 * Memory::megabyte);
+                DJV_ASSERT(0 == reinterpret_cast<quintptr>(p) % MemoryPool::alignment);
+                const quint64 freeCount = MemoryPool::stats().freeCount;
+                MemoryPool::release(p, 4 * Memory::megabyte);
+                DJV_ASSERT(MemoryPool::stats().freeCount == freeCount + 1);
+                DJV_ASSERT(0 == MemoryPool::stats().pooledBytes);
+                MemoryPool::setMaxPooledBytes(maxPooledBytes);
+            }
+            {
+                MemoryPool::release(nullptr, 0);
+            }
+        }
+
+    } // namespace CoreTest
+} // namespace djv
@@ -244,6 +244,10 @@ namespace djv
                 { Sequence(FrameList() << 1 << 2 << 3 << 5 << 6), "1-3,5-6" },
                 { Sequence(FrameList() << 1 << 2 << 3 << 5 << 6 << 7), "1-3,5-7" },
                 { Sequence(FrameList() << 1 << 2 << 3 << 3 << 2 << 1), "1-3,3-1" },
+                { Sequence(FrameList() << 1 << 3 << 5), "1,3,5" },
+                { Sequence(FrameList() << 1 << 2 << 1), "1-2,1" },
+                { Sequence(FrameList() << 1 << 2 << 3 << 2 << 1), "1-3,2-1" },
+                { Sequence(FrameList() << 3 << 2 << 1 << 2 << 3), "3-1,2-3" },
                 { Sequence(FrameList() << -1), "-1" },
                 { Sequence(FrameList() << -1 << -2), "-1--2" },
                 { Sequence(FrameList() << -1 << -2 << -3), "-1--3" },
@@ -286,6 +290,10 @@ namespace djv
                 { "1-3,5-6", Sequence(FrameList() << 1 << 2 << 3 << 5 << 6) },
                 { "1-3,5-7", Sequence(FrameList() << 1 << 2 << 3 << 5 << 6 << 7) },
                 { "1-3,3-1", Sequence(FrameList() << 1 << 2 << 3 << 3 << 2 << 1) },
+                { "1,3,5", Sequence(FrameList() << 1 << 3 << 5) },
+                { "1-2,1", Sequence(FrameList() << 1 << 2 << 1) },
+                { "1-3,2-1", Sequence(FrameList() << 1 << 2 << 3 << 2 << 1) },
+                { "3-1,2-3", Sequence(FrameList() << 3 << 2 << 1 << 2 << 3) },
                 { "-1", Sequence(FrameList() << -1) },
                 { "-1--2", Sequence(FrameList() << -1 << -2) },
                 { "-1--3", Sequence(FrameList() << -1 << -2 << -3) },
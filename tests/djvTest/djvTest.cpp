@@ -33,6 +33,7 @@
 #include <djvAVTest/ColorProfileTest.h>
 #include <djvAVTest/ColorTest.h>
 #include <djvAVTest/ColorUtilTest.h>
+#include <djvAVTest/CPUImageTest.h>
 #include <djvAVTest/ImageIOFormatsTest.h>
 #include <djvAVTest/ImageIOTest.h>
 #include <djvAVTest/ImageTest.h>
@@ -52,8 +53,10 @@
 #include <djvCoreTest/FileInfoUtilTest.h>
 #include <djvCoreTest/FileIOTest.h>
 #include <djvCoreTest/FileIOUtilTest.h>
+#include <djvCoreTest/FrameListTest.h>
 #include <djvCoreTest/ListUtilTest.h>
 #include <djvCoreTest/MathTest.h>
+#include <djvCoreTest/MemoryPoolTest.h>
 #include <djvCoreTest/MemoryTest.h>
 #include <djvCoreTest/RangeTest.h>
 #include <djvCoreTest/SequenceTest.h>
@@ -66,6 +69,9 @@
 #include <djvCoreTest/UserTest.h>
 #include <djvCoreTest/VectorUtilTest.h>
 
+#include <djvViewLibTest/FileCacheCompressTest.h>
+#include <djvViewLibTest/FileGroupTest.h>
+
 #include <djvCore/CoreContext.h>
 
 #include <QApplication>
@@ -82,20 +88,22 @@ int main(int argc, char ** argv)
         QApplication app(argc, argv);
         
         QVector<TestLib::AbstractTest *> tests = QVector<TestLib::AbstractTest *>() <<
+            new CoreTest::FileInfoUtilTest <<
+            new CoreTest::FrameListTest <<
+            new CoreTest::MemoryPoolTest <<
+            new CoreTest::SequenceTest <<
             /*new CoreTest::BoxTest <<
             new CoreTest::BoxUtilTest <<
             new CoreTest::CoreContextTest <<
             new CoreTest::DebugTest <<
             new CoreTest::ErrorTest <<
             new CoreTest::FileInfoTest <<
-            new CoreTest::FileInfoUtilTest <<
             new CoreTest::FileIOTest <<
             new CoreTest::FileIOUtilTest <<
             new CoreTest::ListUtilTest <<
             new CoreTest::MathTest <<
             new CoreTest::MemoryTest <<
             new CoreTest::RangeTest <<
-            new CoreTest::SequenceTest <<
             new CoreTest::SignalBlockerTest <<
             new CoreTest::SpeedTest <<
             new CoreTest::StringUtilTest <<
@@ -106,20 +114,24 @@ int main(int argc, char ** argv)
             new CoreTest::VectorUtilTest <<*/
 
             new AVTest::AudioDataTest <<
-            new AVTest::AudioTest/* <<
-            new AVTest::AVContextTest <<
+            new AVTest::AudioTest <<
+            new AVTest::CPUImageTest <<
+            new AVTest::ImageIOFormatsTest <<
+            new AVTest::PixelDataUtilTest <<
+            new AVTest::PixelTest <<
+            /*new AVTest::AVContextTest <<
             new AVTest::ColorProfileTest <<
             new AVTest::ColorTest <<
             new AVTest::ColorUtilTest <<
-            new AVTest::ImageIOFormatsTest <<
             new AVTest::ImageIOTest <<
             new AVTest::ImageTest <<
             new AVTest::OpenGLImageTest <<
             new AVTest::OpenGLTest <<
             new AVTest::PixelDataTest <<
-            new AVTest::PixelDataUtilTest <<
-            new AVTest::PixelTest <<
-            new AVTest::TagsTest*/;
+            new AVTest::TagsTest <<*/
+
+            new ViewLibTest::FileCacheCompressTest <<
+            new ViewLibTest::FileGroupTest;
 
         for (int i = 0; i < tests.count(); ++i)
         {
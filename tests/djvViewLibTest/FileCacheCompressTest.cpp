@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvViewLibTest/FileCacheCompressTest.h>
+
+#include <djvViewLib/FileCacheCompress.h>
+
+#include <djvCore/Assert.h>
+#include <djvCore/Debug.h>
+
+#include <QVector>
+
+#include <string.h>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace ViewLibTest
+    {
+        void FileCacheCompressTest::run(int &, char **)
+        {
+            DJV_DEBUG("FileCacheCompressTest::run");
+            compress();
+        }
+
+        void FileCacheCompressTest::compress()
+        {
+            DJV_DEBUG("FileCacheCompressTest::compress");
+            const QVector<glm::ivec2> sizes = QVector<glm::ivec2>() <<
+                glm::ivec2(1, 1) <<
+                glm::ivec2(11, 7) <<
+                glm::ivec2(64, 32);
+            for (int i = 0; i < AV::Pixel::PIXEL_COUNT; ++i)
+            {
+                const AV::Pixel::PIXEL pixel = static_cast<AV::Pixel::PIXEL>(i);
+                for (const auto & size : sizes)
+                {
+                    AV::Image image(AV::PixelDataInfo(size, pixel));
+                    image.tags["Test"] = "Value";
+                    image.colorProfile.type = AV::ColorProfile::GAMMA;
+                    image.colorProfile.gamma = 2.f;
+
+                    // Fill the image with a gradient and some noise so that both
+                    // the predictor and the raw bytes are exercised.
+                    quint8 * p = image.data();
+                    quint32 seed = 1;
+                    for (quint64 j = 0; j < image.dataByteCount(); ++j)
+                    {
+                        seed = seed * 1103515245 + 12345;
+                        p[j] = static_cast<quint8>(j / 3 + ((seed >> 16) & 0x7));
+                    }
+                    DJV_DEBUG_PRINT("image = " << image);
+
+                    const auto data = ViewLib::FileCacheCompress::compress(image);
+                    DJV_ASSERT(data);
+                    const auto out = ViewLib::FileCacheCompress::decompress(*data);
+                    DJV_ASSERT(out);
+                    DJV_ASSERT(out->info() == image.info());
+                    DJV_ASSERT(out->tags == image.tags);
+                    DJV_ASSERT(out->colorProfile == image.colorProfile);
+                    DJV_ASSERT(0 == memcmp(out->data(), image.data(), image.dataByteCount()));
+
+                    // Data that does not match the image is rejected.
+                    ViewLib::FileCacheCompressData bad = *data;
+                    bad.data = qCompress(QByteArray(1, 0));
+                    DJV_ASSERT(!ViewLib::FileCacheCompress::decompress(bad));
+                }
+            }
+        }
+
+    } // namespace ViewLibTest
+} // namespace djv
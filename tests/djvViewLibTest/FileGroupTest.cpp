@@ -0,0 +1,94 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2018 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvViewLibTest/FileGroupTest.h>
+
+#include <djvViewLib/FileGroup.h>
+#include <djvViewLib/ViewContext.h>
+
+#include <djvAV/IO.h>
+#include <djvAV/Image.h>
+
+#include <djvCore/Assert.h>
+#include <djvCore/Debug.h>
+#include <djvCore/FileInfoUtil.h>
+
+#include <QTemporaryDir>
+#include <QThread>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace ViewLibTest
+    {
+        void FileGroupTest::run(int & argc, char ** argv)
+        {
+            DJV_DEBUG("FileGroupTest::run");
+            reopen(argc, argv);
+        }
+
+        void FileGroupTest::reopen(int & argc, char ** argv)
+        {
+            DJV_DEBUG("FileGroupTest::reopen");
+            ViewLib::ViewContext context(argc, argv);
+            QTemporaryDir dir;
+            DJV_ASSERT(dir.isValid());
+            const QString fileName = dir.path() + "/FileGroupTest.ppm";
+            auto write = [&context, &fileName](quint8 value)
+            {
+                AV::Image image(AV::PixelDataInfo(1, 1, AV::Pixel::L_U8));
+                image.data()[0] = value;
+                auto save = context.ioFactory()->save(fileName, AV::IOInfo(image.info()));
+                save->write(image);
+                save->close();
+            };
+
+            // Open a file and cache the first frame.
+            write(0);
+            ViewLib::FileGroup fileGroup(nullptr, nullptr, &context);
+            fileGroup.setCacheEnabled(true);
+            fileGroup.open(FileInfoUtil::parse(fileName, Sequence::FORMAT_OFF));
+            auto image = fileGroup.image(0);
+            DJV_ASSERT(image && image->isValid());
+            DJV_ASSERT(0 == image->data()[0]);
+
+            // Rewrite the file and open it again, the cached frame of the old
+            // file should not be used. File times have a resolution of one
+            // second.
+            QThread::msleep(1100);
+            write(255);
+            fileGroup.open(FileInfoUtil::parse(fileName, Sequence::FORMAT_OFF));
+            image = fileGroup.image(0);
+            DJV_ASSERT(image && image->isValid());
+            DJV_ASSERT(255 == image->data()[0]);
+        }
+
+    } // namespace ViewLibTest
+} // namespace djv
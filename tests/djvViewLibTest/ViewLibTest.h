@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <djvTestLib/AbstractTest.h>
+
 namespace djv
 {
     namespace ViewLibTest